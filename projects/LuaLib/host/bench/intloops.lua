@@ -0,0 +1,15 @@
+-- Integer loop counters and arithmetic, as in pixel and handle code.
+local W, H = 320, 240
+
+return function()
+  local sum = 0
+  for frame = 1, 30 do
+    for y = 0, H - 1 do
+      local row = y * W
+      for x = 0, W - 1 do
+        sum = (sum + row + x * frame) % 65521
+      end
+    end
+  end
+  return sum
+end
@@ -0,0 +1,32 @@
+-- Nested arrays indexed by integer arithmetic: matrix multiply.
+local N = 100
+
+local function matrix(seed)
+  local m = {}
+  for i = 1, N do
+    local row = {}
+    for j = 1, N do
+      row[j] = (i * seed + j) % 17
+    end
+    m[i] = row
+  end
+  return m
+end
+
+local a, b = matrix(3), matrix(7)
+
+return function()
+  local c = {}
+  for i = 1, N do
+    local ai, ci = a[i], {}
+    for j = 1, N do
+      local s = 0
+      for k = 1, N do
+        s = s + ai[k] * b[k][j]
+      end
+      ci[j] = s
+    end
+    c[i] = ci
+  end
+  return c
+end
@@ -0,0 +1,44 @@
+-- Heap size of table-heavy data, in KB, for comparing value layouts.
+-- Usage: lua memory.lua
+
+local function measure(name, build)
+  collectgarbage()
+  collectgarbage()
+  local before = collectgarbage("count")
+  local data = build()
+  collectgarbage()
+  print(string.format("%s %.1f", name, collectgarbage("count") - before))
+  return data
+end
+
+-- Array part: one value per element.
+measure("array100k", function()
+  local t = {}
+  for i = 1, 100000 do
+    t[i] = i * 0.5
+  end
+  return t
+end)
+
+-- Hash part: one node per entry. The keys are created first, so that
+-- only the nodes are measured.
+local keys = {}
+for i = 1, 10000 do
+  keys[i] = "key" .. i
+end
+measure("map10k", function()
+  local t = {}
+  for i = 1, 10000 do
+    t[keys[i]] = i
+  end
+  return t
+end)
+
+-- Many small records, as in a scene graph or a list of widgets.
+measure("records10k", function()
+  local list = {}
+  for i = 1, 10000 do
+    list[i] = { x = i, y = -i, width = 32, height = 16, visible = true }
+  end
+  return list
+end)
@@ -0,0 +1,28 @@
+-- Method calls on objects with a metatable.
+local Point = {}
+Point.__index = Point
+
+function Point.new(x, y)
+  return setmetatable({ x = x, y = y }, Point)
+end
+
+function Point:add(other)
+  self.x = self.x + other.x
+  self.y = self.y + other.y
+  return self
+end
+
+function Point:length2()
+  return self.x * self.x + self.y * self.y
+end
+
+return function()
+  local p = Point.new(0, 0)
+  local d = Point.new(1, 2)
+  local sum = 0
+  for i = 1, 300000 do
+    p:add(d)
+    sum = sum + p:length2() % 7
+  end
+  return sum
+end
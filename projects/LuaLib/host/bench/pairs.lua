@@ -0,0 +1,48 @@
+-- Traversal of tables with 10, 1k and 100k string keys, for comparing
+-- the generic for over pairs with stepping through next(t, k), which
+-- looks up the previous key on every step.
+-- Usage: lua pairs.lua pairs|next
+
+local REPEATS = 5
+local STEPS = 2000000  -- elements visited per timing
+
+local mode = arg[1] or "pairs"
+
+local function traverse(t, rounds)
+  local count = 0
+  if mode == "pairs" then
+    for round = 1, rounds do
+      for k, v in pairs(t) do
+        count = count + v
+      end
+    end
+  else
+    for round = 1, rounds do
+      local k, v = next(t)
+      while k ~= nil do
+        count = count + v
+        k, v = next(t, k)
+      end
+    end
+  end
+  return count
+end
+
+local function measure(name, size)
+  local t = {}
+  for i = 1, size do
+    t["key" .. i] = 1
+  end
+  local rounds = STEPS / size
+  local best = math.huge
+  for i = 1, REPEATS do
+    local start = os.clock()
+    assert(traverse(t, rounds) == STEPS)
+    best = math.min(best, os.clock() - start)
+  end
+  print(string.format("%s %.4f", name, best))
+end
+
+measure("keys10", 10)
+measure("keys1k", 1000)
+measure("keys100k", 100000)
@@ -0,0 +1,135 @@
+-- Tables built element by element, compared with the same tables built
+-- with table.new, table.reserve and table.clear. Prints the number of
+-- rehashes and the best time of each way.
+-- Usage: lua rehash.lua
+
+local REPEATS = 5
+
+local cases = {}
+
+local keys = {}
+for i = 1, 5000 do
+  keys[i] = "key" .. i
+end
+
+-- A buffer of sensor samples, new for every round.
+cases[#cases + 1] = {
+  name = "samples",
+  grow = function()
+    for round = 1, 2000 do
+      local samples = {}
+      for i = 1, 1000 do
+        samples[i] = i * 0.5
+      end
+    end
+  end,
+  presized = function()
+    for round = 1, 2000 do
+      local samples = table.new(1000, 0)
+      for i = 1, 1000 do
+        samples[i] = i * 0.5
+      end
+    end
+  end
+}
+
+-- A list of widgets with their fields set one by one.
+cases[#cases + 1] = {
+  name = "widgets",
+  grow = function()
+    local list = {}
+    for i = 1, 20000 do
+      local widget = {}
+      widget.x = i
+      widget.y = -i
+      widget.width = 32
+      widget.height = 16
+      widget.visible = true
+      list[i] = widget
+    end
+  end,
+  presized = function()
+    local list = table.new(20000, 0)
+    for i = 1, 20000 do
+      local widget = table.new(0, 5)
+      widget.x = i
+      widget.y = -i
+      widget.width = 32
+      widget.height = 16
+      widget.visible = true
+      list[i] = widget
+    end
+  end
+}
+
+-- A lookup table filled again in every frame.
+cases[#cases + 1] = {
+  name = "reuse",
+  grow = function()
+    for frame = 1, 1000 do
+      local seen = {}
+      for i = 1, 500 do
+        seen[keys[i % 100 + 1]] = i
+        seen[i] = true
+      end
+    end
+  end,
+  presized = function()
+    local seen = {}
+    for frame = 1, 1000 do
+      table.clear(seen)
+      for i = 1, 500 do
+        seen[keys[i % 100 + 1]] = i
+        seen[i] = true
+      end
+    end
+  end
+}
+
+-- A map that gets a known number of new entries.
+cases[#cases + 1] = {
+  name = "merge",
+  grow = function()
+    for round = 1, 50 do
+      local map = { first = 1, second = 2, third = 3 }
+      for i = 1, #keys do
+        map[keys[i]] = i
+      end
+    end
+  end,
+  presized = function()
+    for round = 1, 50 do
+      local map = { first = 1, second = 2, third = 3 }
+      table.reserve(map, 0, 3 + #keys)
+      for i = 1, #keys do
+        map[keys[i]] = i
+      end
+    end
+  end
+}
+
+local function measure(kernel)
+  collectgarbage()
+  collectgarbage("rehashcount", 1)
+  kernel()
+  local rehashes = collectgarbage("rehashcount")
+  local best = math.huge
+  for i = 1, REPEATS do
+    collectgarbage()
+    local start = os.clock()
+    kernel()
+    best = math.min(best, os.clock() - start)
+  end
+  return rehashes, best
+end
+
+print(string.format("%-10s %21s %19s", "", "rehashes", "time"))
+print(string.format("%-10s %10s %10s %9s %9s %8s", "kernel", "grow",
+  "presized", "grow", "presized", "speedup"))
+for _, case in ipairs(cases) do
+  local growRehashes, growTime = measure(case.grow)
+  local presizedRehashes, presizedTime = measure(case.presized)
+  print(string.format("%-10s %10d %10d %8.3fs %8.3fs %7.2fx", case.name,
+    growRehashes, presizedRehashes, growTime, presizedTime,
+    growTime / presizedTime))
+end
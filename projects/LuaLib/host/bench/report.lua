@@ -0,0 +1,37 @@
+-- Compare the results of two builds of the interpreter, the times of
+-- run.lua or the sizes of memory.lua.
+-- Usage: lua report.lua bench_base.txt bench_new.txt [unit]
+-- The columns are named after the files, without bench_ and .txt. The
+-- unit is s (the default) or KB.
+
+local function readTimes(fileName)
+  local times = {}
+  local names = {}
+  for line in io.lines(fileName) do
+    local name, time = line:match("^(%S+) (%S+)$")
+    if name then
+      names[#names + 1] = name
+      times[name] = tonumber(time)
+    end
+  end
+  return names, times
+end
+
+local function label(fileName)
+  return fileName:match("([^/]+)%.txt$"):gsub("^bench_", "")
+end
+
+local names, base = readTimes(arg[1])
+local _, new = readTimes(arg[2])
+local unit = arg[3] or "s"
+local format = (unit == "s") and "%-10s %9.3fs %9.3fs %7.2fx"
+  or "%-10s %8.1f" .. unit .. " %8.1f" .. unit .. " %7.2fx"
+
+print(string.format("%-10s %10s %10s %8s", "kernel", label(arg[1]),
+  label(arg[2]), (unit == "s") and "speedup" or "ratio"))
+for _, name in ipairs(names) do
+  if new[name] then
+    print(string.format(format, name, base[name], new[name],
+      base[name] / new[name]))
+  end
+end
@@ -0,0 +1,16 @@
+-- Run benchmark kernels and print the best time of each.
+-- Usage: lua run.lua kernel.lua ...
+-- A kernel file returns the function to time.
+
+local REPEATS = 5
+
+for _, fileName in ipairs(arg) do
+  local kernel = assert(loadfile(fileName))()
+  local best = math.huge
+  for i = 1, REPEATS do
+    local start = os.clock()
+    kernel()
+    best = math.min(best, os.clock() - start)
+  end
+  print(string.format("%s %.4f", fileName:match("([^/]+)%.lua$"), best))
+end
@@ -0,0 +1,16 @@
+-- Array indexing with integer keys: sieve of Eratosthenes.
+local N = 1000000
+
+return function()
+  local composite = {}
+  local count = 0
+  for i = 2, N do
+    if not composite[i] then
+      count = count + 1
+      for j = i * i, N, i do
+        composite[j] = true
+      end
+    end
+  end
+  return count
+end
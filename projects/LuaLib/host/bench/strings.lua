@@ -0,0 +1,16 @@
+-- String library calls and concatenation.
+return function()
+  local count = 0
+  for round = 1, 2000 do
+    local s = "line " .. round .. ": the quick brown fox"
+    s = s:upper():lower()
+    for word in s:gmatch("%a+") do
+      count = count + #word
+    end
+    count = count + #string.format("%d %s", round, s:sub(1, 10))
+    if s:find("fox", 1, true) then
+      count = count + 1
+    end
+  end
+  return count
+end
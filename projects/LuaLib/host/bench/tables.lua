@@ -0,0 +1,21 @@
+-- Array and hash reads and writes in loops.
+return function()
+  local sum = 0
+  for round = 1, 20 do
+    local array = {}
+    for i = 1, 20000 do
+      array[i] = i * 2
+    end
+    for i = 1, #array do
+      sum = sum + array[i]
+    end
+    local hash = {}
+    for i = 1, 5000 do
+      hash["k" .. (i % 500)] = i
+    end
+    for k, v in pairs(hash) do
+      sum = sum + v
+    end
+  end
+  return sum
+end
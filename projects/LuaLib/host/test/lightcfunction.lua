@@ -0,0 +1,66 @@
+-- Errors, hooks and tracebacks in light C functions, such as next and
+-- the functions bound by tolua, which have no closure.
+-- Usage: lua lightcfunction.lua
+
+local function check(cond, message)
+  if not cond then
+    error(message, 2)
+  end
+end
+
+assert(debug.getinfo(next).what == "C")
+
+-- An argument error names the function and has no Lua position.
+local ok, message = pcall(next, "x")
+check(not ok and message:find("bad argument #1 to 'next'", 1, true),
+  "error message: " .. tostring(message))
+
+-- The traceback of an error in a light function lists it as a C frame
+-- above the Lua function that called it.
+local function fail()
+  next(nil)
+end
+local trace
+xpcall(fail, function(m)
+  trace = debug.traceback(m)
+  return m
+end)
+check(trace:find("[C]: in function 'next'", 1, true), trace)
+check(trace:find("in function 'fail'", 1, true)
+  or trace:find("in function <", 1, true), trace)
+
+-- Call and return hooks see light functions, also when they fail.
+local calls, returns = 0, 0
+debug.sethook(function(event)
+  local info = debug.getinfo(2, "f")
+  if info and info.func == next then
+    if event == "call" then
+      calls = calls + 1
+    else
+      returns = returns + 1
+    end
+  end
+end, "cr")
+next({})
+pcall(next, 1)
+xpcall(fail, debug.traceback)
+debug.sethook()
+check(calls == 3, "calls: " .. calls)
+check(returns == 1, "returns: " .. returns)
+
+-- A line hook that walks the stack while a light function is running.
+local levels
+debug.sethook(function()
+  local info = debug.getinfo(2, "f")
+  if info and info.func == next then
+    levels = 0
+    while debug.getinfo(levels + 1, "l") do
+      levels = levels + 1
+    end
+  end
+end, "c")
+next({})
+debug.sethook()
+check(levels and levels >= 3, "levels: " .. tostring(levels))
+
+print("lightcfunction ok")
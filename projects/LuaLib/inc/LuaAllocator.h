@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MOBILELUA_LUAALLOCATOR_H
+#define MOBILELUA_LUAALLOCATOR_H
+
+#include <maheap.h>
+
+namespace MobileLua
+{
+
+/**
+ * Statistics for one size class of an allocator.
+ */
+struct LuaAllocatorStats
+{
+	/**
+	 * Size in bytes of the blocks in this class.
+	 */
+	int blockSize;
+
+	/**
+	 * Number of allocations served from the free list.
+	 */
+	int hits;
+
+	/**
+	 * Number of allocations that had to grow the pool.
+	 */
+	int misses;
+
+	/**
+	 * Number of blocks currently handed out to Lua.
+	 */
+	int blocksInUse;
+};
+
+/**
+ * Memory allocation policy for a Lua engine. This default
+ * implementation forwards all requests to realloc and free.
+ * Subclass to use a different memory management strategy.
+ */
+class LuaAllocator
+{
+public:
+	/**
+	 * Destructor.
+	 */
+	virtual ~LuaAllocator();
+
+	/**
+	 * Allocate, resize or free a block. Has the semantics of
+	 * lua_Alloc: a newSize of zero frees the block, a NULL ptr
+	 * allocates a new block.
+	 * @param ptr The block, or NULL.
+	 * @param oldSize Size of the block, zero if ptr is NULL.
+	 * @param newSize Requested size of the block.
+	 * @return The new block, or NULL if newSize is zero or
+	 * the request could not be met.
+	 */
+	virtual void* reallocate(void* ptr, size_t oldSize, size_t newSize);
+
+	/**
+	 * @return The number of size classes, zero for allocators
+	 * that do not pool blocks.
+	 */
+	virtual int getNumberOfSizeClasses();
+
+	/**
+	 * Get statistics for a size class.
+	 * @param index Index of the size class.
+	 * @param stats Filled in with the statistics.
+	 */
+	virtual void getSizeClassStats(int index, LuaAllocatorStats* stats);
+};
+
+/**
+ * Allocator that serves small blocks from free lists with
+ * one list per size class. Most Lua objects (strings, tables,
+ * upvalues, small closures) are small, and pooling them avoids
+ * fragmenting the heap. Larger blocks go to realloc and free.
+ *
+ * Memory in the pool is kept until the allocator is deleted,
+ * and an allocator must outlive the engines that use it.
+ */
+class LuaPoolAllocator : public LuaAllocator
+{
+public:
+	/**
+	 * Blocks up to this size are pooled.
+	 */
+	enum { MAX_POOLED_SIZE = 64 };
+
+	/**
+	 * Granularity of the size classes.
+	 */
+	enum { SIZE_CLASS_STEP = 8 };
+
+	/**
+	 * Number of size classes.
+	 */
+	enum { NUMBER_OF_SIZE_CLASSES = MAX_POOLED_SIZE / SIZE_CLASS_STEP };
+
+	/**
+	 * Size of the pages the pool is grown with.
+	 */
+	enum { PAGE_SIZE = 2048 };
+
+	/**
+	 * Constructor.
+	 */
+	LuaPoolAllocator();
+
+	/**
+	 * Destructor. Frees all pages.
+	 */
+	virtual ~LuaPoolAllocator();
+
+	virtual void* reallocate(void* ptr, size_t oldSize, size_t newSize);
+
+	virtual int getNumberOfSizeClasses();
+
+	virtual void getSizeClassStats(int index, LuaAllocatorStats* stats);
+
+protected:
+	/**
+	 * Allocate a block from a size class.
+	 */
+	void* allocateBlock(int sizeClass);
+
+	/**
+	 * Return a block to its size class.
+	 */
+	void freeBlock(int sizeClass, void* block);
+
+	/**
+	 * Add a new page of blocks to a size class.
+	 * @return Non-zero if successful, zero if out of memory.
+	 */
+	int growSizeClass(int sizeClass);
+
+	/**
+	 * @return Non-zero if the block is in a page of the pool.
+	 */
+	int isPoolBlock(void* block);
+
+	/**
+	 * Free lists, one per size class.
+	 */
+	void* mFreeLists[NUMBER_OF_SIZE_CLASSES];
+
+	/**
+	 * Statistics, one per size class.
+	 */
+	LuaAllocatorStats mStats[NUMBER_OF_SIZE_CLASSES];
+
+	/**
+	 * Linked list of all pages.
+	 */
+	void* mPages;
+
+	/**
+	 * Number of blocks of at most MAX_POOLED_SIZE bytes that are
+	 * on the heap. A heap block that shrinks into a size class
+	 * with no free block stays on the heap, since a shrink must
+	 * not fail. While there are such blocks, small blocks are
+	 * looked up in the pages to tell where they are.
+	 */
+	int mSmallHeapBlocks;
+};
+
+}
+
+#endif
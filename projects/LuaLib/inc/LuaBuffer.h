@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MOBILELUA_LUABUFFER_H
+#define MOBILELUA_LUABUFFER_H
+
+struct lua_State;
+
+namespace MobileLua
+{
+
+/**
+ * Register the Buffer type and its Lua functions. A Buffer is
+ * a full userdata that holds the bytes of the buffer, so it can
+ * be passed to any MoSync function that takes a pointer. It
+ * knows its size and is freed by the garbage collector.
+ * @param L The Lua state.
+ */
+void luaOpenBuffer(lua_State* L);
+
+/**
+ * Create a zero filled buffer and push it onto the Lua stack.
+ * @param L The Lua state.
+ * @param size Size of the buffer in bytes.
+ * @return Pointer to the bytes of the buffer.
+ */
+void* luaPushNewBuffer(lua_State* L, int size);
+
+/**
+ * Get the bytes of a buffer or buffer view.
+ * @param L The Lua state.
+ * @param index Stack index of the value.
+ * @param size Set to the size of the buffer in bytes, if the
+ * value is a buffer.
+ * @return Pointer to the bytes, NULL if the value is not
+ * a buffer or buffer view.
+ */
+void* luaToBuffer(lua_State* L, int index, int* size);
+
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include <MAUtil/String.h>
 #include <MAUI/Font.h>
 
+#include "LuaAllocator.h"
 #include "LuaErrorListener.h"
 
 namespace MobileLua
@@ -40,6 +41,34 @@ class LuaEngine
 {
 public:
 
+	/**
+	 * Slots for the event handlers of the native event loop.
+	 * Slot EVENT_HANDLER_ANY holds the handler that gets all
+	 * events, the other slots are indexed by event type.
+	 */
+	enum
+	{
+		EVENT_HANDLER_ANY = 0,
+		MAX_EVENT_HANDLERS = 64
+	};
+
+	/**
+	 * Max number of events held back for coalescing, one per
+	 * touch id for drag events and one per sensor type.
+	 */
+	enum
+	{
+		MAX_COALESCED_EVENTS = 8
+	};
+
+	/**
+	 * Max number of sensor samples in a batch.
+	 */
+	enum
+	{
+		MAX_SENSOR_BATCH = 128
+	};
+
 	/**
 	 * Constructor.
 	 */
@@ -74,9 +103,24 @@ public:
 
 	/**
 	 * Initialize the Lua engine.
+	 * @param allocator Allocator used for all memory of the engine,
+	 * NULL to use realloc and free. The allocator is not deleted
+	 * by the engine and must outlive it.
 	 * @return Non-zero if successful, zero on error.
 	 */
-	virtual int initialize();
+	virtual int initialize(LuaAllocator* allocator = NULL);
+
+	/**
+	 * Turn lazy binding of the MoSync API on or off. When on,
+	 * which is the default, a ma* function or constant becomes
+	 * a global the first time it is accessed, which makes
+	 * initialize faster and the engine smaller. Turn it off to
+	 * have all of them in the globals table from the start, for
+	 * example to list them with pairs. Takes effect when the
+	 * engine is initialized.
+	 * @param lazy true for lazy binding.
+	 */
+	virtual void setLazyBindings(bool lazy);
 
 	/**
 	 * Shutdown the Lua engine.
@@ -92,13 +136,243 @@ public:
 
 	/**
 	 * Helper method that evaluates a Lua script contained in
-	 * a resource handle.
+	 * a resource handle. The script can be either Lua source
+	 * code or bytecode precompiled with luac.
 	 * @param scriptResourceId Handle to data object with Lua code,
 	 * typically a resource id.
 	 * @return Non-zero if successful, zero on error.
 	 */
 	virtual int eval(MAHandle scriptResourceId);
 
+	/**
+	 * Evaluate a Lua script stored in a file. The script can be
+	 * either Lua source code or bytecode precompiled with luac.
+	 * @param path Full path of the file.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int evalFile(const char* path);
+
+	/**
+	 * Run the chunk that was pushed onto the stack by a load
+	 * function, and report any error (for private use, really).
+	 * @param status The result of the load, zero if successful.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int evalLoadedChunk(int status);
+
+	/**
+	 * Get the number of bytes currently allocated by Lua.
+	 */
+	virtual int getMemoryInUse();
+
+	/**
+	 * Get the highest number of bytes allocated by Lua since
+	 * the engine was initialized or resetMemoryPeak was called.
+	 */
+	virtual int getMemoryPeak();
+
+	/**
+	 * Start a new high-water mark measurement from the
+	 * current memory usage.
+	 */
+	virtual void resetMemoryPeak();
+
+	/**
+	 * Set the maximum number of bytes Lua may allocate.
+	 * When the usage gets close to the budget, the garbage
+	 * collector does a full collection. An allocation that goes
+	 * over the budget still succeeds, but if the usage is over
+	 * the budget after the next full collection, the running
+	 * script fails with a memory error ("not enough memory").
+	 * Can be called before or after initialize.
+	 * @param budget The budget in bytes, zero for no limit.
+	 */
+	virtual void setMemoryBudget(int budget);
+
+	/**
+	 * Get the memory budget in bytes, zero if there is no limit.
+	 */
+	virtual int getMemoryBudget();
+
+	/**
+	 * Get the number of allocations that went over the
+	 * memory budget.
+	 */
+	virtual int getMemoryBudgetHits();
+
+	/**
+	 * Set the pause of the garbage collector, the percentage
+	 * the memory usage may grow after a collection before a new
+	 * cycle starts. The default is 200. Can be called before
+	 * or after initialize.
+	 * @param percent The pause in percent.
+	 */
+	virtual void setGarbageCollectorPause(int percent);
+
+	/**
+	 * Set the step multiplier of the garbage collector, the speed
+	 * of the collector relative to memory allocation in percent.
+	 * The default is 200. Can be called before or after initialize.
+	 * @param percent The step multiplier in percent.
+	 */
+	virtual void setGarbageCollectorStepMultiplier(int percent);
+
+	/**
+	 * Set the amount of garbage collection done each time the
+	 * event loop runs out of pending events. Doing the collector
+	 * work while the application is idle makes the pauses during
+	 * event handling shorter.
+	 * @param kbytes The step size in kilobytes, zero to
+	 * turn off idle collection.
+	 */
+	virtual void setIdleGarbageCollectionStep(int kbytes);
+
+	/**
+	 * Get the idle step size in kilobytes, zero if idle
+	 * collection is turned off.
+	 */
+	virtual int getIdleGarbageCollectionStep();
+
+	/**
+	 * Called by the event loop when there are no pending events.
+	 * Runs a garbage collection step if idle collection is on.
+	 */
+	virtual void onIdle();
+
+	/**
+	 * Get the number of garbage collector pauses since the
+	 * engine was initialized or the statistics were reset.
+	 */
+	virtual int getGarbageCollectorPauseCount();
+
+	/**
+	 * Get the total time in milliseconds spent in garbage
+	 * collector pauses.
+	 */
+	virtual int getGarbageCollectorPauseTime();
+
+	/**
+	 * Get the longest garbage collector pause in milliseconds.
+	 */
+	virtual int getGarbageCollectorPauseMax();
+
+	/**
+	 * Start a new measurement of garbage collector pauses.
+	 */
+	virtual void resetGarbageCollectorPauses();
+
+	/**
+	 * Set the Lua function called for events of a given type
+	 * (for private use, really).
+	 * @param eventType The event type, or EVENT_HANDLER_ANY
+	 * for a function that gets all events.
+	 * @param functionRef Registry reference to the function,
+	 * created with luaL_ref, or LUA_NOREF to remove the handler.
+	 * The engine releases the reference when it is replaced.
+	 */
+	virtual void setEventHandler(int eventType, int functionRef);
+
+	/**
+	 * Run the event loop. Events are decoded natively and passed
+	 * to the handlers as numbers, see SysEventLoopSetHandler in
+	 * lua_systemapi.h. The loop exits on EVENT_TYPE_CLOSE,
+	 * when exitEventLoop is called, or on a Lua error.
+	 * @param waitTime The time to wait in maWait.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int runEventLoop(int waitTime = 0);
+
+	/**
+	 * Make the event loop exit after the current event.
+	 */
+	virtual void exitEventLoop();
+
+	/**
+	 * Turn event coalescing on or off. When on, the event loop
+	 * merges the drag events of a touch id, and the sensor
+	 * events of a sensor type, that arrive between two waits.
+	 * Only the latest event of each is passed to Lua. Other
+	 * events are delivered in order, after the merged events
+	 * that arrived before them.
+	 * @param dragEvents true to merge EVENT_TYPE_POINTER_DRAGGED.
+	 * @param sensorEvents true to merge EVENT_TYPE_SENSOR.
+	 */
+	virtual void setEventCoalescing(bool dragEvents, bool sensorEvents);
+
+	/**
+	 * Get the number of drag events dropped by coalescing.
+	 */
+	virtual int getMergedDragEvents();
+
+	/**
+	 * Get the number of sensor events dropped by coalescing.
+	 */
+	virtual int getMergedSensorEvents();
+
+	/**
+	 * Set a Lua function that gets sensor events in batches
+	 * (for private use, really). While it is set, sensor events
+	 * are collected natively and passed to the function as a
+	 * flat table of sensor type and values, instead of going to
+	 * the sensor event handler. The table is reused for every
+	 * batch.
+	 * @param functionRef Registry reference to the function,
+	 * created with luaL_ref, or LUA_NOREF to stop batching.
+	 * @param samples Deliver a batch when it has this many
+	 * samples, at most MAX_SENSOR_BATCH.
+	 * @param milliseconds Deliver a batch when its first sample
+	 * is this old, zero for no time limit.
+	 */
+	virtual void setSensorBatchHandler(
+		int functionRef,
+		int samples,
+		int milliseconds);
+
+	/**
+	 * Pass the collected sensor samples to the batch handler.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int deliverSensorBatch();
+
+	/**
+	 * Pass an event on to Lua, or hold it back to be merged with
+	 * later events if coalescing is on. This is what the event
+	 * loop does for each event.
+	 * @param event The event.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int postEvent(const MAEvent& event);
+
+	/**
+	 * Pass the events held back for coalescing on to Lua, and
+	 * the sensor batch if it is old enough. The event loop does
+	 * this when there are no more pending events.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int flushEvents();
+
+	/**
+	 * Pass an event to its Lua handlers.
+	 * @param event The event.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int dispatchEvent(const MAEvent& event);
+
+	/**
+	 * Call a Lua event handler and report any error
+	 * (for private use, really).
+	 * @param numberOfArgs Number of arguments on the stack
+	 * after the handler.
+	 * @return Non-zero if successful, zero on error.
+	 */
+	virtual int callEventHandler(int numberOfArgs);
+
+	/**
+	 * Pop the error message on top of the Lua stack and
+	 * report it (for private use, really).
+	 */
+	virtual void reportLuaErrorOnStack();
+
 	/**
 	 * Set a listener that will get notified when there is a
 	 * Lua error.
@@ -127,6 +401,135 @@ public:
 	 * Listener called when a Lua error occurs.
 	 */
 	LuaErrorListener* mLuaErrorListener;
+
+	/**
+	 * Allocator used by the Lua state.
+	 */
+	LuaAllocator* mAllocator;
+
+	/**
+	 * Allocator used when none is given to initialize.
+	 */
+	LuaAllocator mDefaultAllocator;
+
+	/**
+	 * Number of bytes allocated by Lua.
+	 */
+	int mMemoryInUse;
+
+	/**
+	 * High-water mark of mMemoryInUse.
+	 */
+	int mMemoryPeak;
+
+	/**
+	 * Maximum value of mMemoryInUse, zero for no limit.
+	 */
+	int mMemoryBudget;
+
+	/**
+	 * Number of allocations that went over the budget.
+	 */
+	int mMemoryBudgetHits;
+
+	/**
+	 * Garbage collector pause in percent.
+	 */
+	int mGCPause;
+
+	/**
+	 * Garbage collector step multiplier in percent.
+	 */
+	int mGCStepMultiplier;
+
+	/**
+	 * Kilobytes to collect when idle, zero for no idle collection.
+	 */
+	int mIdleGCStep;
+
+	/**
+	 * True if the MoSync API is bound on first access.
+	 */
+	bool mLazyBindings;
+
+	/**
+	 * Registry references to the event handlers, LUA_NOREF
+	 * for no handler.
+	 */
+	int mEventHandlers[MAX_EVENT_HANDLERS];
+
+	/**
+	 * True while the event loop runs.
+	 */
+	bool mEventLoopRunning;
+
+	/**
+	 * True to merge drag events.
+	 */
+	bool mCoalesceDragEvents;
+
+	/**
+	 * True to merge sensor events.
+	 */
+	bool mCoalesceSensorEvents;
+
+	/**
+	 * Events held back for coalescing, in arrival order.
+	 */
+	MAEvent mCoalescedEvents[MAX_COALESCED_EVENTS];
+
+	/**
+	 * Number of events in mCoalescedEvents.
+	 */
+	int mNumberOfCoalescedEvents;
+
+	/**
+	 * Number of drag events replaced by later ones.
+	 */
+	int mMergedDragEvents;
+
+	/**
+	 * Number of sensor events replaced by later ones.
+	 */
+	int mMergedSensorEvents;
+
+	/**
+	 * Registry reference to the sensor batch handler,
+	 * LUA_NOREF when sensor events are not batched.
+	 */
+	int mSensorBatchHandler;
+
+	/**
+	 * Registry reference to the table that batches
+	 * are delivered in.
+	 */
+	int mSensorBatchTable;
+
+	/**
+	 * Number of samples that triggers a batch delivery.
+	 */
+	int mSensorBatchSize;
+
+	/**
+	 * Age in milliseconds that triggers a batch delivery,
+	 * zero for no time limit.
+	 */
+	int mSensorBatchTime;
+
+	/**
+	 * Time of the first sample in the current batch.
+	 */
+	int mSensorBatchStart;
+
+	/**
+	 * The current batch.
+	 */
+	MASensor mSensorSamples[MAX_SENSOR_BATCH];
+
+	/**
+	 * Number of samples in mSensorSamples.
+	 */
+	int mNumberOfSensorSamples;
 };
 
 }
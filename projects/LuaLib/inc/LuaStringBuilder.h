@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MOBILELUA_LUASTRINGBUILDER_H
+#define MOBILELUA_LUASTRINGBUILDER_H
+
+struct lua_State;
+
+namespace MobileLua
+{
+
+/**
+ * Register the StringBuilder type and the Lua function
+ * SysStringBuilderCreate. A string builder collects strings,
+ * numbers and bytes in a buffer that grows by doubling, so
+ * building a string of n bytes takes O(n) time, unlike
+ * concatenation with .. in a loop. The bindings pass the bytes
+ * of a builder to MoSync functions, so a builder can be written
+ * to a connection without making a string of it first.
+ * @param L The Lua state.
+ */
+void luaOpenStringBuilder(lua_State* L);
+
+/**
+ * Get the bytes of a string builder.
+ * @param L The Lua state.
+ * @param index Stack index of the value.
+ * @param size Set to the number of bytes in the builder, if
+ * the value is a string builder.
+ * @return Pointer to the bytes, NULL if the value is not a
+ * string builder.
+ */
+void* luaToStringBuilder(lua_State* L, int index, int* size);
+
+}
+
+#endif
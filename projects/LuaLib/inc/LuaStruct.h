@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MOBILELUA_LUASTRUCT_H
+#define MOBILELUA_LUASTRUCT_H
+
+struct lua_State;
+
+namespace MobileLua
+{
+
+struct LuaAllocatorStats;
+
+/**
+ * Byte offset of a member in a struct. The member may be
+ * a member of a nested struct, such as point.x.
+ */
+#define LUA_STRUCT_OFFSET(type, member) \
+	((int) ((char*) &(((type*) 0)->member) - (char*) 0))
+
+/**
+ * C types of struct fields, see lua_fielddesc in lua.h.
+ */
+enum LuaStructFieldType
+{
+	LUA_STRUCT_INT,
+	LUA_STRUCT_UINT,
+	LUA_STRUCT_FLOAT,
+	LUA_STRUCT_DOUBLE,
+	LUA_STRUCT_POINTER
+};
+
+/**
+ * A field of a struct, as seen from Lua.
+ */
+struct LuaStructField
+{
+	const char* name;
+	int offset;
+	LuaStructFieldType type;
+};
+
+/**
+ * The layout of a C struct. The field list ends with
+ * a field that has a NULL name.
+ */
+struct LuaStructLayout
+{
+	const char* name;
+	int size;
+	const LuaStructField* fields;
+};
+
+/**
+ * Register the struct types of the MoSync API (MAEvent,
+ * MAPoint2d, MARect, MACopyData, MALocation and
+ * MAWidgetEventData) and the Lua functions SysStructCreate,
+ * SysStructView and SysStructGetPoolStats. SysEventCreate,
+ * SysPointCreate, SysRectCreate and SysCopyDataCreate are
+ * replaced by functions that create pooled structs.
+ * @param L The Lua state.
+ */
+void luaOpenStructs(lua_State* L);
+
+/**
+ * Register a struct type. Lua code then reads and writes the
+ * fields of its structs by name, event.x. The Lua core goes
+ * straight to the memory of the field, through the __fields
+ * table of the metatable, with no call.
+ * @param L The Lua state.
+ * @param layout The layout of the struct. It must stay
+ * valid as long as the Lua state.
+ */
+void luaRegisterStruct(lua_State* L, const LuaStructLayout* layout);
+
+/**
+ * Create a zero filled struct of a registered type and push it
+ * onto the Lua stack. The struct is a full userdata that holds
+ * the struct itself, so it can be passed to any MoSync function
+ * that takes a pointer to the struct. It is freed by the garbage
+ * collector.
+ * @param L The Lua state.
+ * @param name Name of the struct type.
+ * @return Pointer to the struct, NULL if there is no struct
+ * type with the name.
+ */
+void* luaPushNewStruct(lua_State* L, const char* name);
+
+/**
+ * Create a zero filled struct from the pool of its type and
+ * push it onto the Lua stack. The struct is a full userdata
+ * that points to a block of the pool, and the garbage collector
+ * returns the block to the pool. The bindings pass the block to
+ * MoSync functions. Pools are shared by all Lua states and are
+ * never freed.
+ * @param L The Lua state.
+ * @param name Name of the struct type, MAEvent, MAPoint2d,
+ * MARect or MACopyData.
+ * @return Pointer to the struct, NULL if the type has no pool
+ * or if out of memory.
+ */
+void* luaPushPooledStruct(lua_State* L, const char* name);
+
+/**
+ * Get the statistics of a struct pool.
+ * @param name Name of the struct type.
+ * @param stats Filled in with the statistics. Hits and misses
+ * count allocations from the free list and allocations that
+ * grew the pool, blocksInUse the structs not yet collected.
+ * @return Non-zero if successful, zero if the type has no pool.
+ */
+int luaGetStructPoolStats(const char* name, LuaAllocatorStats* stats);
+
+/**
+ * Push a view of a struct in memory that Lua does not own.
+ * A view has the fields of the struct, and the bindings pass
+ * the pointer of the view to MoSync functions.
+ * @param L The Lua state.
+ * @param name Name of the struct type.
+ * @param data Pointer to the struct.
+ * @return Non-zero if successful, zero if there is no struct
+ * type with the name.
+ */
+int luaPushStructView(lua_State* L, const char* name, void* data);
+
+}
+
+#endif
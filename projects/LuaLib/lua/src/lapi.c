@@ -60,13 +60,19 @@ static TValue *index2adr (lua_State *L, int idx) {
   else switch (idx) {  /* pseudo-indices */
     case LUA_REGISTRYINDEX: return registry(L);
     case LUA_ENVIRONINDEX: {
-      Closure *func = curr_func(L);
+      Closure *func;
+      if (ttislcf(L->ci->func))  /* light C function? */
+        return gt(L);
+      func = curr_func(L);
       sethvalue(L, &L->env, func->c.env);
       return &L->env;
     }
     case LUA_GLOBALSINDEX: return gt(L);
     default: {
-      Closure *func = curr_func(L);
+      Closure *func;
+      if (ttislcf(L->ci->func))  /* light C functions have no upvalues */
+        return cast(TValue *, luaO_nilobject);
+      func = curr_func(L);
       idx = LUA_GLOBALSINDEX - idx;
       return (idx <= func->c.nupvalues)
                 ? &func->c.upvalue[idx-1]
@@ -77,7 +83,7 @@ static TValue *index2adr (lua_State *L, int idx) {
 
 
 static Table *getcurrenv (lua_State *L) {
-  if (L->ci == L->base_ci)  /* no enclosing function? */
+  if (L->ci == L->base_ci || ttislcf(L->ci->func))  /* no environment? */
     return hvalue(gt(L));  /* use global table as environment */
   else {
     Closure *func = curr_func(L);
@@ -210,10 +216,14 @@ LUA_API void lua_replace (lua_State *L, int idx) {
   o = index2adr(L, idx);
   api_checkvalidindex(L, o);
   if (idx == LUA_ENVIRONINDEX) {
-    Closure *func = curr_func(L);
-    api_check(L, ttistable(L->top - 1)); 
-    func->c.env = hvalue(L->top - 1);
-    luaC_barrier(L, func, L->top - 1);
+    /* a light C function has no environment to replace */
+    api_check(L, ttisclosure(L->ci->func));
+    if (ttisclosure(L->ci->func)) {
+      Closure *func = curr_func(L);
+      api_check(L, ttistable(L->top - 1)); 
+      func->c.env = hvalue(L->top - 1);
+      luaC_barrier(L, func, L->top - 1);
+    }
   }
   else {
     setobj(L, o, L->top - 1);
@@ -241,7 +251,7 @@ LUA_API void lua_pushvalue (lua_State *L, int idx) {
 
 LUA_API int lua_type (lua_State *L, int idx) {
   StkId o = index2adr(L, idx);
-  return (o == luaO_nilobject) ? LUA_TNONE : ttype(o);
+  return (o == luaO_nilobject) ? LUA_TNONE : ttypebasic(o);
 }
 
 
@@ -323,7 +333,9 @@ LUA_API lua_Number lua_tonumber (lua_State *L, int idx) {
 LUA_API lua_Integer lua_tointeger (lua_State *L, int idx) {
   TValue n;
   const TValue *o = index2adr(L, idx);
-  if (tonumber(o, &n)) {
+  if (ttisint(o))
+    return ivalue(o);
+  else if (tonumber(o, &n)) {
     lua_Integer res;
     lua_Number num = nvalue(o);
     lua_number2integer(res, num);
@@ -364,6 +376,7 @@ LUA_API size_t lua_objlen (lua_State *L, int idx) {
     case LUA_TSTRING: return tsvalue(o)->len;
     case LUA_TUSERDATA: return uvalue(o)->len;
     case LUA_TTABLE: return luaH_getn(hvalue(o));
+    case LUA_TINT:
     case LUA_TNUMBER: {
       size_t l;
       lua_lock(L);  /* `luaV_tostring' may create a new string */
@@ -378,6 +391,8 @@ LUA_API size_t lua_objlen (lua_State *L, int idx) {
 
 LUA_API lua_CFunction lua_tocfunction (lua_State *L, int idx) {
   StkId o = index2adr(L, idx);
+  if (ttislcf(o))
+    return fvalue(o);
   return (!iscfunction(o)) ? NULL : clvalue(o)->c.f;
 }
 
@@ -403,6 +418,7 @@ LUA_API const void *lua_topointer (lua_State *L, int idx) {
   switch (ttype(o)) {
     case LUA_TTABLE: return hvalue(o);
     case LUA_TFUNCTION: return clvalue(o);
+    case LUA_TLCF: return cast(void *, cast(size_t, fvalue(o)));
     case LUA_TTHREAD: return thvalue(o);
     case LUA_TUSERDATA:
     case LUA_TLIGHTUSERDATA:
@@ -436,7 +452,12 @@ LUA_API void lua_pushnumber (lua_State *L, lua_Number n) {
 
 LUA_API void lua_pushinteger (lua_State *L, lua_Integer n) {
   lua_lock(L);
-  setnvalue(L->top, cast_num(n));
+  if (n == cast_int(n)) {
+    setivalue(L->top, cast_int(n));
+  }
+  else {
+    setnvalue(L->top, cast_num(n));
+  }
   api_incr_top(L);
   lua_unlock(L);
 }
@@ -483,6 +504,22 @@ LUA_API const char *lua_pushfstring (lua_State *L, const char *fmt, ...) {
 }
 
 
+LUA_API void lua_pushlightcfunction (lua_State *L, lua_CFunction fn) {
+  lua_lock(L);
+  setfvalue(L->top, fn);
+  api_incr_top(L);
+  lua_unlock(L);
+}
+
+
+LUA_API void lua_pushnext (lua_State *L) {
+  lua_lock(L);
+  setfvalue(L->top, luaV_next);
+  api_incr_top(L);
+  lua_unlock(L);
+}
+
+
 LUA_API void lua_pushcclosure (lua_State *L, lua_CFunction fn, int n) {
   Closure *cl;
   lua_lock(L);
@@ -584,6 +621,27 @@ LUA_API void lua_createtable (lua_State *L, int narray, int nrec) {
 }
 
 
+LUA_API void lua_reservetable (lua_State *L, int idx, int narray, int nrec) {
+  StkId t;
+  lua_lock(L);
+  luaC_checkGC(L);
+  t = index2adr(L, idx);
+  api_check(L, ttistable(t));
+  luaH_reserve(L, hvalue(t), narray, nrec);
+  lua_unlock(L);
+}
+
+
+LUA_API void lua_cleartable (lua_State *L, int idx) {
+  StkId t;
+  lua_lock(L);
+  t = index2adr(L, idx);
+  api_check(L, ttistable(t));
+  luaH_clear(hvalue(t));
+  lua_unlock(L);
+}
+
+
 LUA_API int lua_getmetatable (lua_State *L, int objindex) {
   const TValue *obj;
   Table *mt = NULL;
@@ -598,7 +656,7 @@ LUA_API int lua_getmetatable (lua_State *L, int objindex) {
       mt = uvalue(obj)->metatable;
       break;
     default:
-      mt = G(L)->mt[ttype(obj)];
+      mt = G(L)->mt[ttypebasic(obj)];
       break;
   }
   if (mt == NULL)
@@ -622,6 +680,9 @@ LUA_API void lua_getfenv (lua_State *L, int idx) {
     case LUA_TFUNCTION:
       sethvalue(L, L->top, clvalue(o)->c.env);
       break;
+    case LUA_TLCF:
+      setobj2s(L, L->top, gt(L));
+      break;
     case LUA_TUSERDATA:
       sethvalue(L, L->top, uvalue(o)->env);
       break;
@@ -721,7 +782,7 @@ LUA_API int lua_setmetatable (lua_State *L, int objindex) {
       break;
     }
     default: {
-      G(L)->mt[ttype(obj)] = mt;
+      G(L)->mt[ttypebasic(obj)] = mt;
       break;
     }
   }
@@ -949,6 +1010,41 @@ LUA_API int lua_gc (lua_State *L, int what, int data) {
       g->gcstepmul = data;
       break;
     }
+    case LUA_GCSETLIMIT: {
+      res = cast_int(g->GClimit);
+      g->GClimit = cast(lu_mem, data);
+      if (g->GClimit != 0 && g->GCthreshold > g->GClimit)
+        g->GCthreshold = g->GClimit;
+      break;
+    }
+    case LUA_GCSETBUDGET: {
+      res = cast_int(g->GCbudget);
+      g->GCbudget = cast(lu_mem, data);
+      break;
+    }
+    case LUA_GCPAUSECOUNT: {
+      res = g->gcpausecount;
+      break;
+    }
+    case LUA_GCPAUSETIME: {
+      res = g->gcpausetime;
+      break;
+    }
+    case LUA_GCPAUSEMAX: {
+      res = g->gcpausemax;
+      if (data != 0) {  /* reset the pause statistics */
+        g->gcpausecount = 0;
+        g->gcpausetime = 0;
+        g->gcpausemax = 0;
+      }
+      break;
+    }
+    case LUA_GCREHASHCOUNT: {
+      res = g->rehashcount;
+      if (data != 0)  /* reset the count */
+        g->rehashcount = 0;
+      break;
+    }
     default: res = -1;  /* invalid option */
   }
   lua_unlock(L);
@@ -1039,7 +1135,7 @@ LUA_API void *lua_newuserdata (lua_State *L, size_t size) {
 
 static const char *aux_upvalue (StkId fi, int n, TValue **val) {
   Closure *f;
-  if (!ttisfunction(fi)) return NULL;
+  if (!ttisclosure(fi)) return NULL;
   f = clvalue(fi);
   if (f->c.isC) {
     if (!(1 <= n && n <= f->c.nupvalues)) return NULL;
@@ -261,7 +261,7 @@ static int addk (FuncState *fs, TValue *k, TValue *v) {
     return cast_int(nvalue(idx));
   }
   else {  /* constant not found; create a new entry */
-    setnvalue(idx, cast_num(fs->nk));
+    setivalue(idx, fs->nk);
     LUAI_ERRORCHECK(0)
     luaM_growvector(L, f->k, fs->nk, f->sizek, TValue,
                     MAXARG_Bx, "constant table overflow");
@@ -290,7 +290,7 @@ int luaK_stringK (FuncState *fs, TString *s) {
 
 int luaK_numberK (FuncState *fs, lua_Number r) {
   TValue o;
-  setnvalue(&o, r);
+  luaO_setnumber(&o, r);
   LUAI_ERRORCHECK(0)
   return addk(fs, &o, &o);
 }
@@ -89,7 +89,7 @@ LUA_API int lua_getstack (lua_State *L, int level, lua_Debug *ar) {
   lua_lock(L);
   for (ci = L->ci; level > 0 && ci > L->base_ci; ci--) {
     level--;
-    if (f_isLua(ci))  /* Lua function? */
+    if (isLua(ci))  /* Lua function? */
       level -= ci->tailcalls;  /* skip lost tail calls */
   }
   if (level == 0 && ci > L->base_ci) {  /* level found? */
@@ -157,7 +157,7 @@ LUA_API const char *lua_setlocal (lua_State *L, const lua_Debug *ar, int n) {
 
 
 static void funcinfo (lua_Debug *ar, Closure *cl) {
-  if (cl->c.isC) {
+  if (cl == NULL || cl->c.isC) {  /* light or closure C function? */
     ar->source = "=[C]";
     ar->linedefined = -1;
     ar->lastlinedefined = -1;
@@ -205,12 +205,14 @@ static void collectvalidlines (lua_State *L, Closure *f) {
 
 
 static int auxgetinfo (lua_State *L, const char *what, lua_Debug *ar,
-                    Closure *f, CallInfo *ci) {
+                    const TValue *func, CallInfo *ci) {
   int status = 1;
-  if (f == NULL) {
+  Closure *f;
+  if (func == NULL) {
     info_tailcall(ar);
     return status;
   }
+  f = ttisclosure(func) ? clvalue(func) : NULL;  /* NULL if light */
   for (; *what; what++) {
     switch (*what) {
       case 'S': {
@@ -222,7 +224,7 @@ static int auxgetinfo (lua_State *L, const char *what, lua_Debug *ar,
         break;
       }
       case 'u': {
-        ar->nups = f->c.nupvalues;
+        ar->nups = (f == NULL) ? 0 : f->c.nupvalues;
         break;
       }
       case 'n': {
@@ -246,15 +248,15 @@ static int auxgetinfo (lua_State *L, const char *what, lua_Debug *ar,
 
 LUA_API int lua_getinfo (lua_State *L, const char *what, lua_Debug *ar) {
   int status;
-  Closure *f = NULL;
+  TValue func;  /* function, with a nil tag for a tail call */
   CallInfo *ci = NULL;
   lua_lock(L);
+  setobj(L, &func, luaO_nilobject);
   if (*what == '>') {
-    StkId func = L->top - 1;
-    luai_apicheck(L, ttisfunction(func));
+    luai_apicheck(L, ttisfunction(L->top - 1));
     LUAI_ERRORCHECK(0)
     what++;  /* skip the '>' */
-    f = clvalue(func);
+    setobj(L, &func, L->top - 1);
     LUAI_ERRORCHECK(0)
     L->top--;  /* pop function */
   }
@@ -262,19 +264,18 @@ LUA_API int lua_getinfo (lua_State *L, const char *what, lua_Debug *ar) {
     ci = L->base_ci + ar->i_ci;
     lua_assert(ttisfunction(ci->func));
     LUAI_ERRORCHECK(0)
-    f = clvalue(ci->func);
+    setobj(L, &func, ci->func);
     LUAI_ERRORCHECK(0)
   }
-  status = auxgetinfo(L, what, ar, f, ci);
+  status = auxgetinfo(L, what, ar, ttisnil(&func) ? NULL : &func, ci);
   LUAI_ERRORCHECK(0)
   if (strchr(what, 'f')) {
-    if (f == NULL) setnilvalue(L->top);
-    else setclvalue(L, L->top, f);
+    setobj2s(L, L->top, &func);
     LUAI_ERRORCHECK(0)
     incr_top(L);
   }
   if (strchr(what, 'L'))
-    collectvalidlines(L, f);
+    collectvalidlines(L, ttisclosure(&func) ? clvalue(&func) : NULL);
   LUAI_ERRORCHECK(0)
   lua_unlock(L);
   return status;
@@ -588,7 +589,7 @@ static int isinstack (CallInfo *ci, const TValue *o) {
 
 void luaG_typeerror (lua_State *L, const TValue *o, const char *op) {
   const char *name = NULL;
-  const char *t = luaT_typenames[ttype(o)];
+  const char *t = luaT_typenames[ttypebasic(o)];
   const char *kind = (isinstack(L->ci, o)) ?
                          getobjname(L, L->ci, cast_int(o - L->base), &name) :
                          NULL;
@@ -617,8 +618,8 @@ void luaG_aritherror (lua_State *L, const TValue *p1, const TValue *p2) {
 
 
 int luaG_ordererror (lua_State *L, const TValue *p1, const TValue *p2) {
-  const char *t1 = luaT_typenames[ttype(p1)];
-  const char *t2 = luaT_typenames[ttype(p2)];
+  const char *t1 = luaT_typenames[ttypebasic(p1)];
+  const char *t2 = luaT_typenames[ttypebasic(p2)];
   if (t1[2] == t2[2])
     luaG_runerror(L, "attempt to compare two %s values", t1);
   else
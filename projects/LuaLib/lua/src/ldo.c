@@ -108,13 +108,17 @@ static void resetstack (lua_State *L, int status) {
 
 void luaD_throw (lua_State *L, int errcode) {
   if (L->errorJmp) {
+#ifdef MOSYNC
 	lprintfln("luaD_throw errcode: %i\n", errcode);
+#endif
 	//maPanic(0, "trhow");
     L->errorJmp->status = errcode;
     LUAI_THROW(L, L->errorJmp);
   }
   else {
+#ifdef MOSYNC
 	lprintfln("luaD_throw exit errcode: %i\n", errcode);
+#endif
     L->status = cast_byte(errcode);
     if (G(L)->panic) {
       resetstack(L, errcode);
@@ -240,7 +244,7 @@ static StkId adjust_varargs (lua_State *L, Proto *p, int actual) {
     for (i=0; i<nvar; i++)  /* put extra arguments into `arg' table */
       setobj2n(L, luaH_setnum(L, htab, i+1), L->top - nvar + i);
     /* store counter in field `n' */
-    setnvalue(luaH_setstr(L, htab, luaS_newliteral(L, "n")), cast_num(nvar));
+    setivalue(luaH_setstr(L, htab, luaS_newliteral(L, "n")), nvar);
   }
 #endif
   /* move fixed parameters to final position */
@@ -288,12 +292,13 @@ int luaD_precall (lua_State *L, StkId func, int nresults) {
     func = tryfuncTM(L, func);  /* check the `function' tag method */
   LUAI_ERRORCHECK(-1)
   funcr = savestack(L, func);
-  cl = &clvalue(func)->l;
   L->ci->savedpc = L->savedpc;
-  if (!cl->isC) {  /* Lua function? prepare its call */
+  if (ttisclosure(func) && !clvalue(func)->l.isC) {  /* Lua function? */
     CallInfo *ci;
     StkId st, base;
-    Proto *p = cl->p;
+    Proto *p;
+    cl = &clvalue(func)->l;
+    p = cl->p;
     luaD_checkstack(L, p->maxstacksize);
     func = restorestack(L, funcr);
     if (!p->is_vararg) {  /* no varargs? */
@@ -327,6 +332,7 @@ int luaD_precall (lua_State *L, StkId func, int nresults) {
   }
   else {  /* if is a C function, call it */
     CallInfo *ci;
+    lua_CFunction f;
     int n;
     luaD_checkstack(L, LUA_MINSTACK);  /* ensure minimum stack size */
     ci = inc_ci(L);  /* now `enter' new function */
@@ -338,8 +344,9 @@ int luaD_precall (lua_State *L, StkId func, int nresults) {
     if (L->hookmask & LUA_MASKCALL)
       luaD_callhook(L, LUA_HOOKCALL, -1);
     LUAI_ERRORCHECK(-1)
+    f = ttislcf(ci->func) ? fvalue(ci->func) : curr_func(L)->c.f;
     lua_unlock(L);
-    n = (*curr_func(L)->c.f)(L);  /* do the actual call */
+    n = (*f)(L);  /* do the actual call */
     LUAI_ERRORCHECK(-1)
     lua_lock(L);
     if (n < 0)  /* yielding? */
@@ -355,7 +362,7 @@ int luaD_precall (lua_State *L, StkId func, int nresults) {
 static StkId callrethooks (lua_State *L, StkId firstResult) {
   ptrdiff_t fr = savestack(L, firstResult);  /* next call may change stack */
   luaD_callhook(L, LUA_HOOKRET, -1);
-  if (f_isLua(L->ci)) {  /* Lua function? */
+  if (isLua(L->ci)) {  /* Lua function? */
     while ((L->hookmask & LUA_MASKRET) && L->ci->tailcalls--) /* tail calls */
       luaD_callhook(L, LUA_HOOKTAILRET, -1);
   }
@@ -420,7 +427,7 @@ static void resume (lua_State *L, void *ud) {
   else {  /* resuming from previous yield */
     lua_assert(L->status == LUA_YIELD);
     L->status = 0;
-    if (!f_isLua(ci)) {  /* `common' yield? */
+    if (!isLua(ci)) {  /* `common' yield? */
       /* finish interrupted execution of `OP_CALL' */
       lua_assert(GET_OPCODE(*((ci-1)->savedpc - 1)) == OP_CALL ||
                  GET_OPCODE(*((ci-1)->savedpc - 1)) == OP_TAILCALL);
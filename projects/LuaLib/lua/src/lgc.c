@@ -56,7 +56,13 @@
 		reallymarkobject(g, obj2gco(t)); }
 
 
-#define setthreshold(g)  (g->GCthreshold = (g->estimate/100) * g->gcpause)
+/*
+** the next cycle starts no later than at the memory limit, unless
+** the live data alone is already above it
+*/
+#define setthreshold(g)  { g->GCthreshold = (g->estimate/100) * g->gcpause; \
+  if (g->GClimit > g->estimate && g->GCthreshold > g->GClimit) \
+    g->GCthreshold = g->GClimit; }
 
 
 static void removeentry (Node *n) {
@@ -608,7 +614,19 @@ static l_mem singlestep (lua_State *L) {
 }
 
 
-void luaC_step (lua_State *L) {
+/*
+** Record the duration of one collector pause (in milliseconds)
+*/
+static void recordpause (global_State *g, int start) {
+  int pause = luai_gcclock() - start;
+  g->gcpausecount++;
+  g->gcpausetime += pause;
+  if (pause > g->gcpausemax)
+    g->gcpausemax = pause;
+}
+
+
+static void step (lua_State *L) {
   global_State *g = G(L);
   l_mem lim = (GCSTEPSIZE/100) * g->gcstepmul;
   if (lim == 0)
@@ -634,7 +652,7 @@ void luaC_step (lua_State *L) {
 }
 
 
-void luaC_fullgc (lua_State *L) {
+static void fullgc (lua_State *L) {
   global_State *g = G(L);
   if (g->gcstate <= GCSpropagate) {
     /* reset sweep marks to sweep all elements (returning them to white) */
@@ -660,11 +678,34 @@ void luaC_fullgc (lua_State *L) {
 }
 
 
+void luaC_step (lua_State *L) {
+  global_State *g = G(L);
+  int start = luai_gcclock();
+  if ((g->GClimit != 0 && g->totalbytes >= g->GClimit) ||
+      (g->GCbudget != 0 && g->totalbytes > g->GCbudget)) {
+    fullgc(L);  /* close to the memory limit: collect all now */
+    recordpause(g, start);
+    if (g->GCbudget != 0 && g->totalbytes > g->GCbudget)
+      luaD_throw(L, LUA_ERRMEM);  /* still over the budget */
+    return;
+  }
+  step(L);
+  recordpause(g, start);
+}
+
+
+void luaC_fullgc (lua_State *L) {
+  int start = luai_gcclock();
+  fullgc(L);
+  recordpause(G(L), start);
+}
+
+
 void luaC_barrierf (lua_State *L, GCObject *o, GCObject *v) {
   global_State *g = G(L);
   lua_assert(isblack(o) && iswhite(v) && !isdead(g, v) && !isdead(g, o));
   lua_assert(g->gcstate != GCSfinalize && g->gcstate != GCSpause);
-  lua_assert(ttype(&o->gch) != LUA_TTABLE);
+  lua_assert(o->gch.tt != LUA_TTABLE);
   /* must keep invariant? */
   if (g->gcstate == GCSpropagate)
     reallymarkobject(g, v);  /* restore invariant */
@@ -116,7 +116,8 @@ static int io_pclose (lua_State *L) {
   FILE **p = tofilep(L);
   int ok = lua_pclose(L, *p);
   *p = NULL;
-  r
+  return pushresult(L, ok, NULL);
+}
 #endif
 
 #ifndef MOSYNC
@@ -84,13 +84,27 @@ static int math_atan2 (lua_State *L) {
   return 1;
 }
 
+/*
+** Push a whole number as an integer, so that it keeps the int subtype
+** of the core (see LUA_USE_INTSUBTYPE). Zero is pushed as a number,
+** since it may be -0.
+*/
+static void pushwhole (lua_State *L, lua_Number d) {
+  lua_Integer n;
+  lua_number2integer(n, d);
+  if (n != 0 && (lua_Number)n == d)
+    lua_pushinteger(L, n);
+  else
+    lua_pushnumber(L, d);
+}
+
 static int math_ceil (lua_State *L) {
-  lua_pushnumber(L, ceil(luaL_checknumber(L, 1)));
+  pushwhole(L, ceil(luaL_checknumber(L, 1)));
   return 1;
 }
 
 static int math_floor (lua_State *L) {
-  lua_pushnumber(L, floor(luaL_checknumber(L, 1)));
+  pushwhole(L, floor(luaL_checknumber(L, 1)));
   return 1;
 }
 
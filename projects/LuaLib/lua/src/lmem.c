@@ -14,6 +14,7 @@
 
 #include "ldebug.h"
 #include "ldo.h"
+#include "lgc.h"
 #include "lmem.h"
 #include "lobject.h"
 #include "lstate.h"
@@ -77,11 +78,15 @@ void *luaM_realloc_ (lua_State *L, void *block, size_t osize, size_t nsize) {
   global_State *g = G(L);
   lua_assert((osize == 0) == (block == NULL));
   block = (*g->frealloc)(g->ud, block, osize, nsize);
-  if (block == NULL && nsize > 0)
+  if (block == NULL && nsize > 0) {
     luaD_throw(L, LUA_ERRMEM);
-  LUAI_ERRORCHECK()
+    return NULL;
+  }
   lua_assert((nsize == 0) == (block == NULL));
   g->totalbytes = (g->totalbytes - osize) + nsize;
+  if (g->GCbudget != 0 && nsize > osize && g->totalbytes > g->GCbudget &&
+      g->gcstate != GCSfinalize)  /* not from a finalizer of the collector */
+    g->GCthreshold = 0;  /* over the budget: full collection at next check */
   return block;
 }
 
@@ -24,7 +24,7 @@
 
 
 
-const TValue luaO_nilobject_ = {{NULL}, LUA_TNIL};
+const TValue luaO_nilobject_ = {NILCONSTANT};
 
 
 /*
@@ -70,16 +70,22 @@ int luaO_log2 (unsigned int x) {
 
 
 int luaO_rawequalObj (const TValue *t1, const TValue *t2) {
-  if (ttype(t1) != ttype(t2)) return 0;
+  if (ttype(t1) != ttype(t2))  /* an int may equal a float */
+    return ttisnumber(t1) && ttisnumber(t2) &&
+           luai_numeq(nvalue(t1), nvalue(t2));
   else switch (ttype(t1)) {
     case LUA_TNIL:
       return 1;
     case LUA_TNUMBER:
       return luai_numeq(nvalue(t1), nvalue(t2));
+    case LUA_TINT:
+      return ivalue(t1) == ivalue(t2);
     case LUA_TBOOLEAN:
       return bvalue(t1) == bvalue(t2);  /* boolean true must be 1 !! */
     case LUA_TLIGHTUSERDATA:
       return pvalue(t1) == pvalue(t2);
+    case LUA_TLCF:
+      return fvalue(t1) == fvalue(t2);
     default:
       lua_assert(iscollectable(t1));
       return gcvalue(t1) == gcvalue(t2);
@@ -87,6 +93,24 @@ int luaO_rawequalObj (const TValue *t1, const TValue *t2) {
 }
 
 
+/*
+** Store a number, as an int if it has an exact int value. Negative zero
+** stays a float, so that it still prints as -0.
+*/
+void luaO_setnumber (TValue *o, lua_Number n) {
+  int i;
+  lua_number2int(i, n);
+  if (luai_numeq(cast_num(i), n)) {
+    lua_Number zero = 0;
+    if (i != 0 || memcmp(&n, &zero, sizeof(n)) == 0) {
+      setivalue(o, i);
+      return;
+    }
+  }
+  setnvalue(o, n);
+}
+
+
 int luaO_str2d (const char *s, lua_Number *result) {
   char *endptr;
   *result = lua_str2number(s, &endptr);
@@ -131,7 +155,7 @@ const char *luaO_pushvfstring (lua_State *L, const char *fmt, va_list argp) {
         break;
       }
       case 'd': {
-        setnvalue(L->top, cast_num(va_arg(argp, int)));
+        setivalue(L->top, va_arg(argp, int));
         incr_top(L);
         break;
       }
@@ -30,6 +30,24 @@
 #define LUA_TDEADKEY	(LAST_TAG+3)
 
 
+/*
+** Tag for light C functions: C functions without upvalues, stored as
+** a bare lua_CFunction so that they need no Closure object. Lua code
+** and the API see them as functions; they have no environment of their
+** own and use the globals table. The tag is negative so that they are
+** not collectable.
+*/
+#define LUA_TLCF	(-2)
+
+
+/*
+** Tag for numbers that hold an int, see LUA_USE_INTSUBTYPE. Lua code
+** and the API see them as numbers. Without LUA_USE_INTSUBTYPE no value
+** has this tag, and ttisint is a constant 0.
+*/
+#define LUA_TINT	(-3)
+
+
 /*
 ** Union of all collectable objects
 */
@@ -53,6 +71,8 @@ typedef struct GCheader {
 
 
 
+#if !defined(LUA_USE_NANBOXING)
+
 /*
 ** Union of all Lua values
 */
@@ -60,7 +80,9 @@ typedef union {
   GCObject *gc;
   void *p;
   lua_Number n;
+  int i;
   int b;
+  lua_CFunction f;
 } Value;
 
 
@@ -70,35 +92,124 @@ typedef union {
 
 #define TValuefields	Value value; int tt
 
+#define NILCONSTANT	{NULL}, LUA_TNIL
+
+/* raw access to the tag and the value, used by the macros below */
+#define rawtt(o)	((o)->tt)
+#define checktag(o,t)	(rawtt(o) == (t))
+#define ttype(o)	rawtt(o)
+#define settt_(o,t)	((o)->tt=(t))
+#define gcval_(o)	((o)->value.gc)
+#define pval_(o)	((o)->value.p)
+#define nval_(o)	((o)->value.n)
+#define ival_(o)	((o)->value.i)
+#define fval_(o)	((o)->value.f)
+#define setgcval_(o,x)	((o)->value.gc=(x))
+#define setpval_(o,x)	((o)->value.p=(x))
+#define setnval_(o,x)	((o)->value.n=(x))
+#define setival_(o,x)	((o)->value.i=(x))
+#define setfval_(o,x)	((o)->value.f=(x))
+#define copyval_(o1,o2)	((o1)->value = (o2)->value, (o1)->tt = (o2)->tt)
+
+#else
+
+/*
+** NaN-boxed values, see LUA_USE_NANBOXING. A value is a lua_Number,
+** unless the high word of the double is NBMARK plus a tag: then it is
+** a NaN that arithmetic never produces, and the low word holds the
+** value, a pointer, C function, int or boolean. Numbers that would look
+** like a tag are stored as the NaN NBNAN.
+*/
+typedef lu_int32 Value;
+
+#if defined(LUAI_NANBOX_BIGENDIAN)
+#define TValuefields \
+	union { struct { lu_int32 tt; Value v; } i; lua_Number n; } u
+#define NILCONSTANT	{{NBTAG(LUA_TNIL), 0}}
+#else
+#define TValuefields \
+	union { struct { Value v; lu_int32 tt; } i; lua_Number n; } u
+#define NILCONSTANT	{{0, NBTAG(LUA_TNIL)}}
+#endif
+
+#define NBMARK		0x7FF7A500
+#define NBMASK		0x7FFFFF00
+#define NBNAN		0x7FF80000
+#define NBTAG(t)	(NBMARK | cast(lu_byte, (t) + 8))  /* tags from -8 */
+
+#define rawtt(o)	(cast_int((o)->u.i.tt & 0xFF) - 8)
+#define checktag(o,t)	((o)->u.i.tt == NBTAG(t))
+#define ttype(o)	(ttisfloat(o) ? LUA_TNUMBER : rawtt(o))
+#define settt_(o,t)	((o)->u.i.tt=NBTAG(t))
+#define topointer_(o)	cast(void *, cast(size_t, (o)->u.i.v))
+#define gcval_(o)	cast(GCObject *, topointer_(o))
+#define pval_(o)	topointer_(o)
+#define nval_(o)	((o)->u.n)
+#define ival_(o)	cast_int((o)->u.i.v)
+#define fval_(o)	cast(lua_CFunction, cast(size_t, (o)->u.i.v))
+#define setpointer_(o,x) \
+	(lua_assert(cast(size_t, (x)) <= 0xFFFFFFFFu), \
+	 (o)->u.i.v=cast(Value, cast(size_t, (x))))
+#define setgcval_(o,x)	setpointer_(o,x)
+#define setpval_(o,x)	setpointer_(o,x)
+#define setnval_(o,x) \
+	((o)->u.n=(x), \
+	 (void)(ttisfloat(o) || ((o)->u.i.tt=NBNAN, (o)->u.i.v=0)))
+#define setival_(o,x)	((o)->u.i.v=cast(Value, (x)))
+#define setfval_(o,x)	setpointer_(o,x)
+/* copy the words, a NaN-boxed value may not survive a float load */
+#define copyval_(o1,o2)	((o1)->u.i = (o2)->u.i)
+
+#endif
+
+
 typedef struct lua_TValue {
   TValuefields;
 } TValue;
 
 
 /* Macros to test type */
-#define ttisnil(o)	(ttype(o) == LUA_TNIL)
-#define ttisnumber(o)	(ttype(o) == LUA_TNUMBER)
-#define ttisstring(o)	(ttype(o) == LUA_TSTRING)
-#define ttistable(o)	(ttype(o) == LUA_TTABLE)
-#define ttisfunction(o)	(ttype(o) == LUA_TFUNCTION)
-#define ttisboolean(o)	(ttype(o) == LUA_TBOOLEAN)
-#define ttisuserdata(o)	(ttype(o) == LUA_TUSERDATA)
-#define ttisthread(o)	(ttype(o) == LUA_TTHREAD)
-#define ttislightuserdata(o)	(ttype(o) == LUA_TLIGHTUSERDATA)
+#define ttisnil(o)	checktag(o, LUA_TNIL)
+#if !defined(LUA_USE_NANBOXING)
+#define ttisfloat(o)	checktag(o, LUA_TNUMBER)
+#else
+#define ttisfloat(o)	(((o)->u.i.tt & NBMASK) != NBMARK)
+#endif
+#if defined(LUA_USE_INTSUBTYPE)
+#define ttisint(o)	checktag(o, LUA_TINT)
+#define ttisnumber(o)	(ttisfloat(o) || ttisint(o))
+#else
+#define ttisint(o)	0
+#define ttisnumber(o)	ttisfloat(o)
+#endif
+#define ttisstring(o)	checktag(o, LUA_TSTRING)
+#define ttistable(o)	checktag(o, LUA_TTABLE)
+#define ttisclosure(o)	checktag(o, LUA_TFUNCTION)
+#define ttislcf(o)	checktag(o, LUA_TLCF)
+#define ttisfunction(o)	(ttisclosure(o) || ttislcf(o))
+#define ttisboolean(o)	checktag(o, LUA_TBOOLEAN)
+#define ttisuserdata(o)	checktag(o, LUA_TUSERDATA)
+#define ttisthread(o)	checktag(o, LUA_TTHREAD)
+#define ttislightuserdata(o)	checktag(o, LUA_TLIGHTUSERDATA)
 
 /* Macros to access values */
-#define ttype(o)	((o)->tt)
-#define gcvalue(o)	check_exp(iscollectable(o), (o)->value.gc)
-#define pvalue(o)	check_exp(ttislightuserdata(o), (o)->value.p)
-#define nvalue(o)	check_exp(ttisnumber(o), (o)->value.n)
-#define rawtsvalue(o)	check_exp(ttisstring(o), &(o)->value.gc->ts)
+/* type as seen from Lua, one of the basic types of lua.h */
+#define ttypebasic(o)	(ttype(o) >= 0 ? ttype(o) : \
+                         ttislcf(o) ? LUA_TFUNCTION : LUA_TNUMBER)
+#define gcvalue(o)	check_exp(iscollectable(o), gcval_(o))
+#define pvalue(o)	check_exp(ttislightuserdata(o), pval_(o))
+#define nvalue(o)	(ttisint(o) ? cast_num(ival_(o)) : \
+                         check_exp(ttisfloat(o), nval_(o)))
+#define ivalue(o)	check_exp(ttisint(o), ival_(o))
+#define rawtsvalue(o)	check_exp(ttisstring(o), &gcval_(o)->ts)
 #define tsvalue(o)	(&rawtsvalue(o)->tsv)
-#define rawuvalue(o)	check_exp(ttisuserdata(o), &(o)->value.gc->u)
+#define rawuvalue(o)	check_exp(ttisuserdata(o), &gcval_(o)->u)
 #define uvalue(o)	(&rawuvalue(o)->uv)
-#define clvalue(o)	check_exp(ttisfunction(o), &(o)->value.gc->cl)
-#define hvalue(o)	check_exp(ttistable(o), &(o)->value.gc->h)
-#define bvalue(o)	check_exp(ttisboolean(o), (o)->value.b)
-#define thvalue(o)	check_exp(ttisthread(o), &(o)->value.gc->th)
+#define clvalue(o)	check_exp(ttisclosure(o), &gcval_(o)->cl)
+#define fvalue(o)	check_exp(ttislcf(o), fval_(o))
+#define hvalue(o)	check_exp(ttistable(o), &gcval_(o)->h)
+#define bvalue(o)	check_exp(ttisboolean(o), ival_(o))
+#define thvalue(o)	check_exp(ttisthread(o), &gcval_(o)->th)
 
 #define l_isfalse(o)	(ttisnil(o) || (ttisboolean(o) && bvalue(o) == 0))
 
@@ -106,53 +217,68 @@ typedef struct lua_TValue {
 ** for internal debug only
 */
 #define checkconsistency(obj) \
-  lua_assert(!iscollectable(obj) || (ttype(obj) == (obj)->value.gc->gch.tt))
+  lua_assert(!iscollectable(obj) || (ttype(obj) == gcval_(obj)->gch.tt))
 
 #define checkliveness(g,obj) \
   lua_assert(!iscollectable(obj) || \
-  ((ttype(obj) == (obj)->value.gc->gch.tt) && !isdead(g, (obj)->value.gc)))
+  ((ttype(obj) == gcval_(obj)->gch.tt) && !isdead(g, gcval_(obj))))
 
 
 /* Macros to set values */
-#define setnilvalue(obj) ((obj)->tt=LUA_TNIL)
+#define setnilvalue(obj) settt_(obj, LUA_TNIL)
 
+#if !defined(LUA_USE_NANBOXING)
+#define setnvalue(obj,x) \
+  { TValue *i_o=(obj); setnval_(i_o, x); settt_(i_o, LUA_TNUMBER); }
+#else
 #define setnvalue(obj,x) \
-  { TValue *i_o=(obj); i_o->value.n=(x); i_o->tt=LUA_TNUMBER; }
+  { TValue *i_o=(obj); setnval_(i_o, x); }
+#endif
+
+#if defined(LUA_USE_INTSUBTYPE)
+#define setivalue(obj,x) \
+  { TValue *i_o=(obj); setival_(i_o, x); settt_(i_o, LUA_TINT); }
+#else
+#define setivalue(obj,x)	setnvalue(obj, cast_num(x))
+#endif
+
+#define setfvalue(obj,x) \
+  { TValue *i_o=(obj); setfval_(i_o, x); settt_(i_o, LUA_TLCF); }
 
 #define setpvalue(obj,x) \
-  { TValue *i_o=(obj); i_o->value.p=(x); i_o->tt=LUA_TLIGHTUSERDATA; }
+  { TValue *i_o=(obj); setpval_(i_o, x); settt_(i_o, LUA_TLIGHTUSERDATA); }
 
 #define setbvalue(obj,x) \
-  { TValue *i_o=(obj); i_o->value.b=(x); i_o->tt=LUA_TBOOLEAN; }
+  { TValue *i_o=(obj); setival_(i_o, x); settt_(i_o, LUA_TBOOLEAN); }
 
 #define setsvalue(L,obj,x) \
   { TValue *i_o=(obj); \
-    i_o->value.gc=cast(GCObject *, (x)); i_o->tt=LUA_TSTRING; \
+    setgcval_(i_o, cast(GCObject *, (x))); settt_(i_o, LUA_TSTRING); \
     checkliveness(G(L),i_o); }
 
 #define setuvalue(L,obj,x) \
   { TValue *i_o=(obj); \
-    i_o->value.gc=cast(GCObject *, (x)); i_o->tt=LUA_TUSERDATA; \
+    setgcval_(i_o, cast(GCObject *, (x))); settt_(i_o, LUA_TUSERDATA); \
     checkliveness(G(L),i_o); }
 
 #define setthvalue(L,obj,x) \
   { TValue *i_o=(obj); \
-    i_o->value.gc=cast(GCObject *, (x)); i_o->tt=LUA_TTHREAD; \
+    setgcval_(i_o, cast(GCObject *, (x))); settt_(i_o, LUA_TTHREAD); \
     checkliveness(G(L),i_o); }
 
 #define setclvalue(L,obj,x) \
   { TValue *i_o=(obj); \
-    i_o->value.gc=cast(GCObject *, (x)); i_o->tt=LUA_TFUNCTION; \
+    setgcval_(i_o, cast(GCObject *, (x))); settt_(i_o, LUA_TFUNCTION); \
     checkliveness(G(L),i_o); }
 
 #define sethvalue(L,obj,x) \
   { TValue *i_o=(obj); \
-    i_o->value.gc=cast(GCObject *, (x)); i_o->tt=LUA_TTABLE; \
+    setgcval_(i_o, cast(GCObject *, (x))); settt_(i_o, LUA_TTABLE); \
     checkliveness(G(L),i_o); }
 
 #define setptvalue(L,obj,x) \
   { TValue *i_o=(obj); \
-    i_o->value.gc=cast(GCObject *, (x)); i_o->tt=LUA_TPROTO; \
+    setgcval_(i_o, cast(GCObject *, (x))); settt_(i_o, LUA_TPROTO); \
     checkliveness(G(L),i_o); }
 
 
@@ -160,7 +286,7 @@ typedef struct lua_TValue {
 
 #define setobj(L,obj1,obj2) \
   { const TValue *o2=(obj2); TValue *o1=(obj1); \
-    o1->value = o2->value; o1->tt=o2->tt; \
+    copyval_(o1, o2); \
     checkliveness(G(L),o1); }
 
 
@@ -183,7 +309,7 @@ typedef struct lua_TValue {
 #define setobj2n	setobj
 #define setsvalue2n	setsvalue
 
-#define setttype(obj, tt) (ttype(obj) = (tt))
+#define setttype(obj, tt) settt_(obj, tt)
 
 
 #define iscollectable(o)	(ttype(o) >= LUA_TSTRING)
@@ -312,8 +438,8 @@ typedef union Closure {
 } Closure;
 
 
-#define iscfunction(o)	(ttype(o) == LUA_TFUNCTION && clvalue(o)->c.isC)
-#define isLfunction(o)	(ttype(o) == LUA_TFUNCTION && !clvalue(o)->c.isC)
+#define iscfunction(o)	(ttislcf(o) || (ttisclosure(o) && clvalue(o)->c.isC))
+#define isLfunction(o)	(ttisclosure(o) && !clvalue(o)->c.isC)
 
 
 /*
@@ -371,6 +497,7 @@ LUAI_FUNC int luaO_int2fb (unsigned int x);
 LUAI_FUNC int luaO_fb2int (int x);
 LUAI_FUNC int luaO_rawequalObj (const TValue *t1, const TValue *t2);
 LUAI_FUNC int luaO_str2d (const char *s, lua_Number *result);
+LUAI_FUNC void luaO_setnumber (TValue *o, lua_Number n);
 LUAI_FUNC const char *luaO_pushvfstring (lua_State *L, const char *fmt,
                                                        va_list argp);
 LUAI_FUNC const char *luaO_pushfstring (lua_State *L, const char *fmt, ...);
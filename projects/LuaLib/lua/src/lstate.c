@@ -177,6 +177,12 @@ LUA_API lua_State *lua_newstate (lua_Alloc f, void *ud) {
   g->totalbytes = sizeof(LG);
   g->gcpause = LUAI_GCPAUSE;
   g->gcstepmul = LUAI_GCMUL;
+  g->GClimit = 0;
+  g->GCbudget = 0;
+  g->gcpausecount = 0;
+  g->rehashcount = 0;
+  g->gcpausetime = 0;
+  g->gcpausemax = 0;
   g->gcdept = 0;
   for (i=0; i<NUM_TAGS; i++) g->mt[i] = NULL;
   if (luaD_rawrunprotected(L, f_luaopen, NULL) != 0) {
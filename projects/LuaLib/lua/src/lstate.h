@@ -59,7 +59,7 @@ typedef struct CallInfo {
 #define curr_func(L)	(clvalue(L->ci->func))
 #define ci_func(ci)	(clvalue((ci)->func))
 #define f_isLua(ci)	(!ci_func(ci)->c.isC)
-#define isLua(ci)	(ttisfunction((ci)->func) && f_isLua(ci))
+#define isLua(ci)	(ttisclosure((ci)->func) && f_isLua(ci))
 
 
 /*
@@ -85,6 +85,12 @@ typedef struct global_State {
   lu_mem gcdept;  /* how much GC is `behind schedule' */
   int gcpause;  /* size of pause between successive GCs */
   int gcstepmul;  /* GC `granularity' */
+  lu_mem GClimit;  /* do a full collection at this size (0 = no limit) */
+  lu_mem GCbudget;  /* memory error above this after a full collection */
+  int gcpausecount;  /* number of collector pauses */
+  int gcpausetime;  /* total time spent in collector pauses (ms) */
+  int gcpausemax;  /* longest collector pause (ms) */
+  int rehashcount;  /* number of table rehashes */
   lua_CFunction panic;  /* to be called in unprotected errors */
   TValue l_registry;
   struct lua_State *mainthread;
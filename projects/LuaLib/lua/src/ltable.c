@@ -73,8 +73,8 @@
 #define dummynode		(&dummynode_)
 
 static const Node dummynode_ = {
-  {{NULL}, LUA_TNIL},  /* value */
-  {{{NULL}, LUA_TNIL, NULL}}  /* key */
+  {NILCONSTANT},  /* value */
+  {{NILCONSTANT, NULL}}  /* key */
 };
 
 
@@ -92,6 +92,39 @@ static Node *hashnum (const Table *t, lua_Number n) {
 }
 
 
+/*
+** hash for integral numbers. With the int subtype, integral number keys
+** are stored as ints (see newkey) and hashed without float arithmetic.
+*/
+#if defined(LUA_USE_INTSUBTYPE)
+#define hashint(t,i)	hashmod(t, cast(unsigned int, (i)))
+#define eqintkey(n,k)	(ttisint(gkey(n)) && ivalue(gkey(n)) == (k))
+#else
+#define hashint(t,i)	hashnum(t, cast_num(i))
+#define eqintkey(n,k)	(ttisnumber(gkey(n)) && \
+                         luai_numeq(nvalue(gkey(n)), cast_num(k)))
+#endif
+
+
+/*
+** int value of a float, if it has one
+*/
+static int floattoint (lua_Number n, int *k) {
+  lua_number2int(*k, n);
+  return luai_numeq(cast_num(*k), n);
+}
+
+
+static Node *hashfloat (const Table *t, lua_Number n) {
+#if defined(LUA_USE_INTSUBTYPE)
+  int k;
+  if (floattoint(n, &k))
+    return hashint(t, k);  /* same node as the int key */
+#endif
+  return hashnum(t, n);
+}
+
+
 
 /*
 ** returns the `main' position of an element in a table (that is, the index
@@ -99,14 +132,18 @@ static Node *hashnum (const Table *t, lua_Number n) {
 */
 static Node *mainposition (const Table *t, const TValue *key) {
   switch (ttype(key)) {
+    case LUA_TINT:
+      return hashint(t, ivalue(key));
     case LUA_TNUMBER:
-      return hashnum(t, nvalue(key));
+      return hashfloat(t, nvalue(key));
     case LUA_TSTRING:
       return hashstr(t, rawtsvalue(key));
     case LUA_TBOOLEAN:
       return hashboolean(t, bvalue(key));
     case LUA_TLIGHTUSERDATA:
       return hashpointer(t, pvalue(key));
+    case LUA_TLCF:
+      return hashpointer(t, cast(void *, cast(size_t, fvalue(key))));
     default:
       return hashpointer(t, gcvalue(key));
   }
@@ -118,13 +155,11 @@ static Node *mainposition (const Table *t, const TValue *key) {
 ** the array part of the table, -1 otherwise.
 */
 static int arrayindex (const TValue *key) {
-  if (ttisnumber(key)) {
-    lua_Number n = nvalue(key);
-    int k;
-    lua_number2int(k, n);
-    if (luai_numeq(cast_num(k), n))
-      return k;
-  }
+  int k;
+  if (ttisint(key))
+    return ivalue(key);
+  if (ttisfloat(key) && floattoint(nvalue(key), &k))
+    return k;
   return -1;  /* `key' did not match some condition */
 }
 
@@ -159,26 +194,39 @@ static int findindex (lua_State *L, Table *t, StkId key) {
 }
 
 
-int luaH_next (lua_State *L, Table *t, StkId key) {
-  int i = findindex(L, t, key);  /* find original element */
-  for (i++; i < t->sizearray; i++) {  /* try first array part */
+/*
+** Store the first element at slot i or after it in key and key+1. The
+** array part has slots 0 to sizearray-1 and the nodes come after it.
+** Returns the slot after the element, where the next search resumes,
+** or 0 if there are no more elements.
+*/
+int luaH_nextslot (lua_State *L, Table *t, int i, StkId key) {
+  lua_assert(i >= 0);
+  for (; i < t->sizearray; i++) {  /* try first array part */
     if (!ttisnil(&t->array[i])) {  /* a non-nil value? */
-      setnvalue(key, cast_num(i+1));
+      setivalue(key, i+1);
       setobj2s(L, key+1, &t->array[i]);
-      return 1;
+      return i+1;
     }
   }
   for (i -= t->sizearray; i < sizenode(t); i++) {  /* then hash part */
     if (!ttisnil(gval(gnode(t, i)))) {  /* a non-nil value? */
       setobj2s(L, key, key2tval(gnode(t, i)));
       setobj2s(L, key+1, gval(gnode(t, i)));
-      return 1;
+      return i+1 + t->sizearray;
     }
   }
   return 0;  /* no more elements */
 }
 
 
+int luaH_next (lua_State *L, Table *t, StkId key) {
+  int i = findindex(L, t, key);  /* find original element */
+  LUAI_ERRORCHECK(0)
+  return luaH_nextslot(L, t, i+1, key) != 0;
+}
+
+
 /*
 ** {=============================================================
 ** Rehash
@@ -330,11 +378,43 @@ void luaH_resizearray (lua_State *L, Table *t, int nasize) {
 }
 
 
+/*
+** Grow the array part to at least nasize slots and the hash part to at
+** least nhsize nodes, so that as many elements can be added without a
+** rehash. Parts that are already big enough are kept.
+*/
+void luaH_reserve (lua_State *L, Table *t, int nasize, int nhsize) {
+  int nsize = (t->node == dummynode) ? 0 : sizenode(t);
+  if (nasize > t->sizearray || nhsize > nsize)
+    resize(L, t, (nasize > t->sizearray) ? nasize : t->sizearray,
+                 (nhsize > nsize) ? nhsize : nsize);
+}
+
+
+/*
+** Remove all elements, keeping the array part and the nodes for the
+** elements added next. Only the values are cleared: the keys stay as
+** dead keys, like those of removed elements, so that `next' still
+** accepts them during a traversal. Keys added again reuse their nodes.
+*/
+void luaH_clear (Table *t) {
+  int i;
+  for (i = 0; i < t->sizearray; i++)
+    setnilvalue(&t->array[i]);
+  if (t->node != dummynode) {
+    for (i = 0; i < sizenode(t); i++)
+      setnilvalue(gval(gnode(t, i)));
+    t->lastfree = gnode(t, sizenode(t));  /* restart search for free nodes */
+  }
+}
+
+
 static void rehash (lua_State *L, Table *t, const TValue *ek) {
   int nasize, na;
   int nums[MAXBITS+1];  /* nums[i] = number of keys between 2^(i-1) and 2^i */
   int i;
   int totaluse;
+  G(L)->rehashcount++;
   for (i=0; i<=MAXBITS; i++) nums[i] = 0;  /* reset counts */
   nasize = numusearray(t, nums);  /* count keys in array part */
   totaluse = nasize;  /* all those keys are integer keys */
@@ -422,7 +502,14 @@ static TValue *newkey (lua_State *L, Table *t, const TValue *key) {
       mp = n;
     }
   }
-  gkey(mp)->value = key->value; gkey(mp)->tt = key->tt;
+  setobj2t(L, key2tval(mp), key);
+#if defined(LUA_USE_INTSUBTYPE)
+  {
+    int k;
+    if (ttisfloat(key) && floattoint(nvalue(key), &k))
+      setivalue(key2tval(mp), k);  /* integral keys are stored as ints */
+  }
+#endif
   luaC_barriert(L, t, key);
   lua_assert(ttisnil(gval(mp)));
   return gval(mp);
@@ -437,10 +524,9 @@ const TValue *luaH_getnum (Table *t, int key) {
   if (cast(unsigned int, key-1) < cast(unsigned int, t->sizearray))
     return &t->array[key-1];
   else {
-    lua_Number nk = cast_num(key);
-    Node *n = hashnum(t, nk);
+    Node *n = hashint(t, key);
     do {  /* check whether `key' is somewhere in the chain */
-      if (ttisnumber(gkey(n)) && luai_numeq(nvalue(gkey(n)), nk))
+      if (eqintkey(n, key))
         return gval(n);  /* that's it */
       else n = gnext(n);
     } while (n);
@@ -470,11 +556,10 @@ const TValue *luaH_get (Table *t, const TValue *key) {
   switch (ttype(key)) {
     case LUA_TNIL: return luaO_nilobject;
     case LUA_TSTRING: return luaH_getstr(t, rawtsvalue(key));
+    case LUA_TINT: return luaH_getnum(t, ivalue(key));
     case LUA_TNUMBER: {
       int k;
-      lua_Number n = nvalue(key);
-      lua_number2int(k, n);
-      if (luai_numeq(cast_num(k), nvalue(key))) /* index is int? */
+      if (floattoint(nvalue(key), &k)) /* index is int? */
         return luaH_getnum(t, k);  /* use specialized version */
       /* else go through */
     }
@@ -498,7 +583,7 @@ TValue *luaH_set (lua_State *L, Table *t, const TValue *key) {
     return cast(TValue *, p);
   else {
     if (ttisnil(key)) luaG_runerror(L, "table index is nil");
-    else if (ttisnumber(key) && luai_numisnan(nvalue(key)))
+    else if (ttisfloat(key) && luai_numisnan(nvalue(key)))
       luaG_runerror(L, "table index is NaN");
     return newkey(L, t, key);
   }
@@ -511,7 +596,7 @@ TValue *luaH_setnum (lua_State *L, Table *t, int key) {
     return cast(TValue *, p);
   else {
     TValue k;
-    setnvalue(&k, cast_num(key));
+    setivalue(&k, key);
     return newkey(L, t, &k);
   }
 }
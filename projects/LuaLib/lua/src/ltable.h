@@ -26,8 +26,11 @@ LUAI_FUNC const TValue *luaH_get (Table *t, const TValue *key);
 LUAI_FUNC TValue *luaH_set (lua_State *L, Table *t, const TValue *key);
 LUAI_FUNC Table *luaH_new (lua_State *L, int narray, int lnhash);
 LUAI_FUNC void luaH_resizearray (lua_State *L, Table *t, int nasize);
+LUAI_FUNC void luaH_reserve (lua_State *L, Table *t, int nasize, int nhsize);
+LUAI_FUNC void luaH_clear (Table *t);
 LUAI_FUNC void luaH_free (lua_State *L, Table *t);
 LUAI_FUNC int luaH_next (lua_State *L, Table *t, StkId key);
+LUAI_FUNC int luaH_nextslot (lua_State *L, Table *t, int i, StkId key);
 LUAI_FUNC int luaH_getn (Table *t);
 
 
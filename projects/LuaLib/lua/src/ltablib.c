@@ -163,6 +163,47 @@ static int tconcat (lua_State *L) {
 
 
 
+/*
+** {======================================================
+** Presized tables, see lua_reservetable
+** =======================================================
+*/
+
+
+static int tnew (lua_State *L) {
+  int narray = luaL_optint(L, 1, 0);
+  int nhash = luaL_optint(L, 2, 0);
+  luaL_argcheck(L, narray >= 0, 1, "negative size");
+  luaL_argcheck(L, nhash >= 0, 2, "negative size");
+  LUAI_ERRORCHECK(0)
+  lua_createtable(L, narray, nhash);
+  return 1;
+}
+
+
+static int treserve (lua_State *L) {
+  int narray = luaL_optint(L, 2, 0);
+  int nhash = luaL_optint(L, 3, 0);
+  luaL_checktype(L, 1, LUA_TTABLE);
+  luaL_argcheck(L, narray >= 0, 2, "negative size");
+  luaL_argcheck(L, nhash >= 0, 3, "negative size");
+  LUAI_ERRORCHECK(0)
+  lua_reservetable(L, 1, narray, nhash);
+  return 0;
+}
+
+
+static int tclear (lua_State *L) {
+  luaL_checktype(L, 1, LUA_TTABLE);
+  LUAI_ERRORCHECK(0)
+  lua_cleartable(L, 1);
+  return 0;
+}
+
+/* }====================================================== */
+
+
+
 /*
 ** {======================================================
 ** Quicksort
@@ -269,13 +310,16 @@ static int sort (lua_State *L) {
 
 
 static const luaL_Reg tab_funcs[] = {
+  {"clear", tclear},
   {"concat", tconcat},
   {"foreach", foreach},
   {"foreachi", foreachi},
   {"getn", getn},
   {"maxn", maxn},
   {"insert", tinsert},
+  {"new", tnew},
   {"remove", tremove},
+  {"reserve", treserve},
   {"setn", setn},
   {"sort", sort},
   {NULL, NULL}
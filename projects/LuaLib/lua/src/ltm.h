@@ -20,7 +20,8 @@ typedef enum {
   TM_NEWINDEX,
   TM_GC,
   TM_MODE,
-  TM_EQ,  /* last tag method with `fast' access */
+  TM_EQ,
+  TM_FIELDS,  /* last tag method with `fast' access */
   TM_ADD,
   TM_SUB,
   TM_MUL,
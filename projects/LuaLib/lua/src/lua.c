@@ -375,7 +375,7 @@ static int pmain (lua_State *L) {
 
 int main (int argc, char **argv) {
   int status;
-  struct Smain s;
+  static struct Smain s;  /* not on the C stack, see LUA_USE_NANBOXING */
   lua_State *L = lua_open();  /* create state */
   if (L == NULL) {
     l_message(argv[0], "cannot create state: not enough memory");
@@ -166,6 +166,7 @@ LUA_API const char *(lua_pushvfstring) (lua_State *L, const char *fmt,
                                                       va_list argp);
 LUA_API const char *(lua_pushfstring) (lua_State *L, const char *fmt, ...);
 LUA_API void  (lua_pushcclosure) (lua_State *L, lua_CFunction fn, int n);
+LUA_API void  (lua_pushlightcfunction) (lua_State *L, lua_CFunction fn);
 LUA_API void  (lua_pushboolean) (lua_State *L, int b);
 LUA_API void  (lua_pushlightuserdata) (lua_State *L, void *p);
 LUA_API int   (lua_pushthread) (lua_State *L);
@@ -179,6 +180,8 @@ LUA_API void  (lua_getfield) (lua_State *L, int idx, const char *k);
 LUA_API void  (lua_rawget) (lua_State *L, int idx);
 LUA_API void  (lua_rawgeti) (lua_State *L, int idx, int n);
 LUA_API void  (lua_createtable) (lua_State *L, int narr, int nrec);
+LUA_API void  (lua_reservetable) (lua_State *L, int idx, int narr, int nrec);
+LUA_API void  (lua_cleartable) (lua_State *L, int idx);
 LUA_API void *(lua_newuserdata) (lua_State *L, size_t sz);
 LUA_API int   (lua_getmetatable) (lua_State *L, int objindex);
 LUA_API void  (lua_getfenv) (lua_State *L, int idx);
@@ -226,6 +229,12 @@ LUA_API int  (lua_status) (lua_State *L);
 #define LUA_GCSTEP		5
 #define LUA_GCSETPAUSE		6
 #define LUA_GCSETSTEPMUL	7
+#define LUA_GCSETLIMIT		8
+#define LUA_GCPAUSECOUNT	9
+#define LUA_GCPAUSETIME		10
+#define LUA_GCPAUSEMAX		11
+#define LUA_GCREHASHCOUNT	12
+#define LUA_GCSETBUDGET		13
 
 LUA_API int (lua_gc) (lua_State *L, int what, int data);
 
@@ -237,6 +246,7 @@ LUA_API int (lua_gc) (lua_State *L, int what, int data);
 LUA_API int   (lua_error) (lua_State *L);
 
 LUA_API int   (lua_next) (lua_State *L, int idx);
+LUA_API void  (lua_pushnext) (lua_State *L);
 
 LUA_API void  (lua_concat) (lua_State *L, int n);
 
@@ -259,6 +269,13 @@ LUA_API void lua_setallocf (lua_State *L, lua_Alloc f, void *ud);
 
 #define lua_pushcfunction(L,f)	lua_pushcclosure(L, (f), 0)
 
+/*
+** MobileLua extension: lua_pushlightcfunction pushes a C function with
+** no upvalues as a light C function, which allocates no closure. Its
+** environment is the globals table and cannot be changed.
+*/
+#define LUA_LIGHTCFUNCTIONS
+
 #define lua_strlen(L,i)		lua_objlen(L, (i))
 
 #define lua_isfunction(L,n)	(lua_type(L, (n)) == LUA_TFUNCTION)
@@ -278,6 +295,40 @@ LUA_API void lua_setallocf (lua_State *L, lua_Alloc f, void *ud);
 
 #define lua_tostring(L,i)	lua_tolstring(L, (i), NULL)
 
+/*
+** MobileLua extension: userdata fields. When the metatable of a full
+** userdata has a __fields table, the keys of that table are fields in
+** the memory of the userdata, which the VM reads and writes without
+** calling __index or __newindex. The value of a key is the number
+** lua_fielddesc(offset, type). Add LUA_FIELD_INDIRECT to the type when
+** the userdata holds a pointer to the fields instead of the fields.
+*/
+#define LUA_FIELD_INT		0
+#define LUA_FIELD_UINT		1
+#define LUA_FIELD_FLOAT		2
+#define LUA_FIELD_DOUBLE	3
+#define LUA_FIELD_POINTER	4
+#define LUA_FIELD_INDIRECT	8
+
+#define lua_fielddesc(offset,type)	((lua_Number)((offset) * 16 + (type)))
+
+/*
+** MobileLua extension: lua_pushnext pushes the `next' function of the
+** core. A generic for over it, as in the loops over pairs, runs without
+** calls: the control variable of the loop holds the slot of the table
+** where the next step resumes, so no step looks up the previous key.
+*/
+#define LUA_FASTNEXT
+
+/*
+** MobileLua extension: lua_reservetable grows the table at idx to room
+** for at least narr array elements and nrec other elements, and
+** lua_cleartable removes all elements of the table at idx but keeps the
+** room, so that tables built again and again in a loop are not rehashed
+** as they grow. lua_gc(L, LUA_GCREHASHCOUNT, reset) counts the rehashes.
+*/
+#define LUA_TABLERESERVE
+
 
 
 /*
@@ -313,6 +313,22 @@
 #define LUAI_GCMUL	200 /* GC runs 'twice the speed' of memory allocation */
 
 
+/*
+@@ luai_gcclock returns a clock in milliseconds, used to measure the
+@* pauses of the garbage collector.
+** CHANGE it if your system has a better (or cheaper) clock.
+*/
+#if defined(LUA_CORE)
+#if defined(MOSYNC)
+#include <maapi.h>
+#define luai_gcclock()	maGetMilliSecondCount()
+#else
+#include <time.h>
+#define luai_gcclock()	((int)(clock() / (CLOCKS_PER_SEC / 1000)))
+#endif
+#endif
+
+
 
 /*
 @@ LUA_COMPAT_GETN controls compatibility with old getn behavior.
@@ -612,6 +628,60 @@ union luai_Cast { double l_d; long l_l; };
 #define LUAI_USER_ALIGNMENT_T	union { double u; void *s; long l; }
 
 
+/*
+@@ LUAI_DUMPSIZE_T is the type used for string sizes in precompiled chunks.
+** CHANGE it when luac runs on a host whose size_t differs from the
+** target's. MoSync is a 32-bit platform, so a luac built on a 64-bit
+** host must use "unsigned int" here (see LuaLib/host/Makefile).
+*/
+#ifndef LUAI_DUMPSIZE_T
+#define LUAI_DUMPSIZE_T	size_t
+#endif
+
+
+/*
+@@ LUA_USE_JUMPTABLE makes luaV_execute dispatch opcodes through a table
+@* of handler addresses (threaded code) instead of a switch.
+** CHANGE it (define it) to try it on your target. It needs the labels
+** as values extension of GCC, other compilers use the switch anyway.
+** Run "make bench" in LuaLib/host to compare the two on the host.
+*/
+/* #define LUA_USE_JUMPTABLE */
+
+
+/*
+@@ LUA_USE_INTSUBTYPE gives numbers an int subtype next to lua_Number.
+** Integral constants, loop counters, lengths and the results of +, -,
+** *, % and unary minus on ints are kept as ints, until an operation
+** overflows or divides. The subtype is not visible to Lua code or to
+** the API, so scripts behave as if all numbers were lua_Number.
+** It is on for MoSync, since most devices have no FPU and lua_Number
+** arithmetic goes through software floating point.
+** CHANGE it (undefine it) to always store numbers as lua_Number.
+*/
+#if defined(MOSYNC)
+#define LUA_USE_INTSUBTYPE
+#endif
+
+
+/*
+@@ LUA_USE_NANBOXING packs values into 8 bytes instead of 16, which
+@* halves the size of the stack, of table arrays and almost halves
+@* the size of table nodes.
+** A value is then a double, or a NaN that carries a tag and a 32-bit
+** payload. It needs LUA_NUMBER_DOUBLE and 32-bit pointers; on a 64-bit
+** machine all Lua objects, C functions and light userdata must be
+** below 4 GB. Define LUAI_NANBOX_BIGENDIAN on big-endian machines.
+** CHANGE it (define it) to save memory on 32-bit targets. Run
+** "make benchmem" in LuaLib/host to compare the heap sizes.
+*/
+/* #define LUA_USE_NANBOXING */
+
+#if defined(LUA_USE_NANBOXING) && !defined(LUA_NUMBER_DOUBLE)
+#error "LUA_USE_NANBOXING needs LUA_NUMBER_DOUBLE"
+#endif
+
+
 /*
 @@ LUAI_THROW/LUAI_TRY define how Lua does exception handling.
 ** CHANGE them if you prefer to use longjmp/setjmp even with C++
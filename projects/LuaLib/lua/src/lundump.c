@@ -75,7 +75,7 @@ static lua_Number LoadNumber(LoadState* S)
 
 static TString* LoadString(LoadState* S)
 {
- size_t size;
+ LUAI_DUMPSIZE_T size;
  LoadVar(S,size);
  if (size==0)
   return NULL;
@@ -117,7 +117,7 @@ static void LoadConstants(LoadState* S, Proto* f)
    	setbvalue(o,LoadChar(S)!=0);
 	break;
    case LUA_TNUMBER:
-	setnvalue(o,LoadNumber(S));
+	luaO_setnumber(o,LoadNumber(S));
 	break;
    case LUA_TSTRING:
 	setsvalue2n(S->L,o,LoadString(S));
@@ -236,7 +236,7 @@ void luaU_header (char* h)
  *h++=(char)LUAC_FORMAT;
  *h++=(char)*(char*)&x;				/* endianness */
  *h++=(char)sizeof(int);
- *h++=(char)sizeof(size_t);
+ *h++=(char)sizeof(LUAI_DUMPSIZE_T);
  *h++=(char)sizeof(Instruction);
  *h++=(char)sizeof(lua_Number);
  *h++=(char)(((lua_Number)0.5)==0);		/* is lua_Number integral? */
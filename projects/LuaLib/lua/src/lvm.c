@@ -37,7 +37,7 @@ const TValue *luaV_tonumber (const TValue *obj, TValue *n) {
   if (ttisnumber(obj)) return obj;
   LUAI_ERRORCHECK(NULL)
   if (ttisstring(obj) && luaO_str2d(svalue(obj), &num)) {
-    setnvalue(n, num);
+    luaO_setnumber(n, num);
     LUAI_ERRORCHECK(NULL)
     return n;
   }
@@ -52,9 +52,13 @@ int luaV_tostring (lua_State *L, StkId obj) {
     return 0;
   else {
     char s[LUAI_MAXNUMBER2STR];
-    lua_Number n = nvalue(obj);
-    LUAI_ERRORCHECK(0)
-    lua_number2str(s, n);
+    if (ttisint(obj))
+      sprintf(s, "%d", ivalue(obj));  /* same digits as LUA_NUMBER_FMT */
+    else {
+      lua_Number n = nvalue(obj);
+      LUAI_ERRORCHECK(0)
+      lua_number2str(s, n);
+    }
     LUAI_ERRORCHECK(0)
     setsvalue2s(L, obj, luaS_new(L, s));
     return 1;
@@ -126,6 +130,125 @@ static void callTM (lua_State *L, const TValue *f, const TValue *p1,
 }
 
 
+/*
+** Userdata fields, see lua_fielddesc. A field outside the userdata,
+** or behind a NULL pointer, is left to __index and __newindex.
+*/
+static const lu_byte fieldsizes[] = {
+  sizeof(int), sizeof(unsigned int), sizeof(float), sizeof(double),
+  sizeof(void *)
+};
+
+
+static char *fieldaddr (lua_State *L, const TValue *t, TValue *key,
+                        int *type) {
+  const TValue *fields = fasttm(L, uvalue(t)->metatable, TM_FIELDS);
+  const TValue *desc;
+  Udata *u = rawuvalue(t);
+  char *data = cast(char *, u + 1);
+  size_t size = u->uv.len;
+  int d;
+  size_t offset;
+  if (fields == NULL || !ttistable(fields)) return NULL;
+  desc = luaH_get(hvalue(fields), key);
+  if (!ttisnumber(desc)) return NULL;
+  d = ttisint(desc) ? ivalue(desc) : cast_int(nvalue(desc));
+  *type = d & (LUA_FIELD_INDIRECT - 1);
+  offset = cast(size_t, d >> 4);
+  if (d < 0 || *type > LUA_FIELD_POINTER) return NULL;
+  if (d & LUA_FIELD_INDIRECT) {  /* userdata holds a pointer to the fields? */
+    if (size < sizeof(void *) || *cast(char **, data) == NULL) return NULL;
+    return *cast(char **, data) + offset;
+  }
+  if (offset + fieldsizes[*type] > size) return NULL;
+  return data + offset;
+}
+
+
+static int getfield (lua_State *L, const TValue *t, TValue *key, StkId val) {
+  int type;
+  char *p = fieldaddr(L, t, key, &type);
+  if (p == NULL) return 0;
+  switch (type) {
+    case LUA_FIELD_INT:
+      setivalue(val, *cast(int *, p));
+      break;
+    case LUA_FIELD_UINT: {
+      unsigned int u = *cast(unsigned int *, p);
+      if (u <= cast(unsigned int, INT_MAX)) {
+        setivalue(val, cast_int(u));
+      }
+      else {
+        setnvalue(val, cast_num(u));
+      }
+      break;
+    }
+    case LUA_FIELD_FLOAT:
+      setnvalue(val, cast_num(*cast(float *, p)));
+      break;
+    case LUA_FIELD_DOUBLE:
+      setnvalue(val, cast_num(*cast(double *, p)));
+      break;
+    default: {
+      void *v = *cast(void **, p);
+      if (v == NULL) setnilvalue(val);
+      else setpvalue(val, v);
+      break;
+    }
+  }
+  return 1;
+}
+
+
+static int setfield (lua_State *L, const TValue *t, TValue *key, StkId val) {
+  int type;
+  char *p = fieldaddr(L, t, key, &type);
+  TValue v;
+  const TValue *n = val;
+  if (p == NULL) return 0;
+  if (type == LUA_FIELD_POINTER) {
+    if (ttisnil(val))
+      *cast(void **, p) = NULL;
+    else if (ttislightuserdata(val))
+      *cast(void **, p) = pvalue(val);
+    else if (ttisuserdata(val))
+      *cast(void **, p) = rawuvalue(val) + 1;
+    else
+      luaG_runerror(L, "cannot store a %s value in a pointer field",
+                    luaT_typenames[ttypebasic(val)]);
+    return 1;
+  }
+  if (!tonumber(n, &v)) {
+    luaG_runerror(L, "cannot store a %s value in a number field",
+                  luaT_typenames[ttypebasic(val)]);
+    return 1;
+  }
+  switch (type) {
+    case LUA_FIELD_INT:
+      *cast(int *, p) = ttisint(n) ? ivalue(n) : cast_int(nvalue(n));
+      break;
+    case LUA_FIELD_UINT: {
+      lua_Number x;
+      if (ttisint(n)) {
+        *cast(unsigned int *, p) = cast(unsigned int, ivalue(n));
+        break;
+      }
+      x = nvalue(n);
+      *cast(unsigned int *, p) = (x < 0) ? cast(unsigned int, cast_int(x))
+                                         : cast(unsigned int, x);
+      break;
+    }
+    case LUA_FIELD_FLOAT:
+      *cast(float *, p) = cast(float, nvalue(n));
+      break;
+    default:
+      *cast(double *, p) = cast(double, nvalue(n));
+      break;
+  }
+  return 1;
+}
+
+
 void luaV_gettable (lua_State *L, const TValue *t, TValue *key, StkId val) {
   int loop;
   for (loop = 0; loop < MAXTAGLOOP; loop++) {
@@ -141,6 +264,8 @@ void luaV_gettable (lua_State *L, const TValue *t, TValue *key, StkId val) {
       }
       /* else will try the tag method */
     }
+    else if (ttisuserdata(t) && getfield(L, t, key, val))
+      return;
     else if (ttisnil(tm = luaT_gettmbyobj(L, t, TM_INDEX))) {
       luaG_typeerror(L, t, "index");
       LUAI_ERRORCHECK()
@@ -175,6 +300,8 @@ void luaV_settable (lua_State *L, const TValue *t, TValue *key, StkId val) {
       }
       /* else will try the tag method */
     }
+    else if (ttisuserdata(t) && setfield(L, t, key, val))
+      return;
     else if (ttisnil(tm = luaT_gettmbyobj(L, t, TM_NEWINDEX)))
       luaG_typeerror(L, t, "index");
     LUAI_ERRORCHECK()
@@ -262,10 +389,12 @@ static int l_strcmp (const TString *ls, const TString *rs) {
 
 int luaV_lessthan (lua_State *L, const TValue *l, const TValue *r) {
   int res;
-  if (ttype(l) != ttype(r))
-    return luaG_ordererror(L, l, r);
-  else if (ttisnumber(l))
+  if (ttisint(l) && ttisint(r))
+    return ivalue(l) < ivalue(r);
+  else if (ttisnumber(l) && ttisnumber(r))
     return luai_numlt(nvalue(l), nvalue(r));
+  else if (ttype(l) != ttype(r))
+    return luaG_ordererror(L, l, r);
   else if (ttisstring(l))
     return l_strcmp(rawtsvalue(l), rawtsvalue(r)) < 0;
   else if ((res = call_orderTM(L, l, r, TM_LT)) != -1)
@@ -277,10 +406,12 @@ int luaV_lessthan (lua_State *L, const TValue *l, const TValue *r) {
 
 static int lessequal (lua_State *L, const TValue *l, const TValue *r) {
   int res;
-  if (ttype(l) != ttype(r))
-    return luaG_ordererror(L, l, r);
-  else if (ttisnumber(l))
+  if (ttisint(l) && ttisint(r))
+    return ivalue(l) <= ivalue(r);
+  else if (ttisnumber(l) && ttisnumber(r))
     return luai_numle(nvalue(l), nvalue(r));
+  else if (ttype(l) != ttype(r))
+    return luaG_ordererror(L, l, r);
   else if (ttisstring(l))
     return l_strcmp(rawtsvalue(l), rawtsvalue(r)) <= 0;
   else if ((res = call_orderTM(L, l, r, TM_LE)) != -1)  /* first try `le' */
@@ -294,13 +425,17 @@ static int lessequal (lua_State *L, const TValue *l, const TValue *r) {
 
 int luaV_equalval (lua_State *L, const TValue *t1, const TValue *t2) {
   const TValue *tm;
-  lua_assert(ttype(t1) == ttype(t2));
+  lua_assert(ttype(t1) == ttype(t2) || (ttisnumber(t1) && ttisnumber(t2)));
   LUAI_ERRORCHECK(0)
+  if (ttype(t1) != ttype(t2))  /* an int and a float? */
+    return luai_numeq(nvalue(t1), nvalue(t2));
   switch (ttype(t1)) {
     case LUA_TNIL: return 1;
     case LUA_TNUMBER: return luai_numeq(nvalue(t1), nvalue(t2));
+    case LUA_TINT: return ivalue(t1) == ivalue(t2);
     case LUA_TBOOLEAN: return bvalue(t1) == bvalue(t2);  /* true must be 1 !! */
     case LUA_TLIGHTUSERDATA: return pvalue(t1) == pvalue(t2);
+    case LUA_TLCF: return fvalue(t1) == fvalue(t2);
     case LUA_TUSERDATA: {
       if (uvalue(t1) == uvalue(t2)) return 1;
       LUAI_ERRORCHECK(0)
@@ -368,6 +503,51 @@ void luaV_concat (lua_State *L, int total, int last) {
 }
 
 
+/*
+** int arithmetic for the int subtype (see LUA_USE_INTSUBTYPE). Each
+** returns 0 when the result has no exact int value, after an overflow
+** or for a negative zero; the operation is then done on lua_Numbers.
+*/
+#define intop(op,a,b)	cast_int(cast(unsigned int, (a)) op cast(unsigned int, (b)))
+
+/* products of factors up to this size fit in an int */
+#define INTMUL_MAX	46340
+
+static int intadd (int a, int b, int *r) {
+  *r = intop(+, a, b);
+  return ((a ^ *r) & (b ^ *r)) >= 0;
+}
+
+
+static int intsub (int a, int b, int *r) {
+  *r = intop(-, a, b);
+  return ((a ^ b) & (a ^ *r)) >= 0;
+}
+
+
+static int intmul (int a, int b, int *r) {
+  if (cast(unsigned int, a + INTMUL_MAX) > 2*INTMUL_MAX ||
+      cast(unsigned int, b + INTMUL_MAX) > 2*INTMUL_MAX)
+    return 0;
+  *r = a * b;
+  return *r != 0 || (a | b) >= 0;  /* 0 * -1 is -0 */
+}
+
+
+static int intmod (int a, int b, int *r) {
+  if (b == 0) return 0;  /* nan */
+  if (b == -1) *r = 0;  /* avoids INT_MIN % -1 */
+  else {
+    *r = a % b;
+    if (*r != 0 && (*r ^ b) < 0) *r += b;  /* result has the sign of b */
+  }
+  return 1;
+}
+
+
+#define nointop(a,b,r)	0
+
+
 static void Arith (lua_State *L, StkId ra, const TValue *rb,
                    const TValue *rc, TMS op) {
   TValue tempb, tempc;
@@ -394,11 +574,67 @@ static void Arith (lua_State *L, StkId ra, const TValue *rb,
 
 
 
+/*
+** Limit of an int for loop. A float limit is rounded towards the
+** initial value, so that the loop runs the same steps; a limit outside
+** the int range leaves the loop to lua_Numbers.
+*/
+static int forlimit (const TValue *plimit, int step, int *limit) {
+  lua_Number n;
+  if (ttisint(plimit)) {
+    *limit = ivalue(plimit);
+    return 1;
+  }
+  n = nvalue(plimit);
+  n = (step > 0) ? floor(n) : -floor(-n);
+  if (!(luai_numle(cast_num(INT_MIN), n) && luai_numle(n, cast_num(INT_MAX))))
+    return 0;  /* out of range, or nan */
+  lua_number2int(*limit, n);
+  return 1;
+}
+
+
+/*
+** The `next' function of the base library, see lua_pushnext.
+*/
+int luaV_next (lua_State *L) {
+  StkId t = L->base;
+  if (t >= L->top || !ttistable(t)) {
+    luaG_runerror(L, "bad argument #1 to " LUA_QL("next")
+                  " (table expected, got %s)",
+                  (t >= L->top) ? "no value" : luaT_typenames[ttypebasic(t)]);
+    return 0;
+  }
+  if (L->top == t+1)  /* create a 2nd argument if there isn't one */
+    setnilvalue(L->top);
+  L->top = t+2;
+  if (luaH_next(L, hvalue(t), t+1)) {
+    L->top = t+3;
+    return 2;
+  }
+  LUAI_ERRORCHECK(0)
+  setnilvalue(t+1);
+  return 1;
+}
+
+
+/*
+** Generator of a generic for over `next' once it has started. The
+** control variable of the loop then holds the slot of the table where
+** the next step resumes, see luaH_nextslot. Called as a function, it
+** is `next'.
+*/
+static int slotnext (lua_State *L) {
+  return luaV_next(L);
+}
+
+
+
 /*
 ** some macros for common tasks in `luaV_execute'
 */
 
-#define runtime_check(L, c)	{ if (!(c)) break; LUAI_ERRORCHECK() }
+#define runtime_check(L, c)	{ if (!(c)) vmbreak; LUAI_ERRORCHECK() }
 
 #define RA(i)	(base+GETARG_A(i))
 /* to be used after possible stack reallocation */
@@ -417,10 +653,57 @@ static void Arith (lua_State *L, StkId ra, const TValue *rb,
 #define Protect(x)	{ L->savedpc = pc; {x; LUAI_ERRORCHECK() }; base = L->base; }
 
 
-#define arith_op(op,tm) { \
+/*
+** Fetch the next instruction, after running the line and count hooks.
+*/
+#define vmfetch()	{ \
+  i = *pc++; \
+  if ((L->hookmask & (LUA_MASKLINE | LUA_MASKCOUNT)) && \
+      (--L->hookcount == 0 || L->hookmask & LUA_MASKLINE)) { \
+    traceexec(L, pc); \
+    LUAI_ERRORCHECK() \
+    if (L->status == LUA_YIELD) {  /* did hook yield? */ \
+      L->savedpc = pc - 1; \
+      return; \
+    } \
+    base = L->base; \
+  } \
+  /* warning!! several calls may realloc the stack and invalidate `ra' */ \
+  ra = RA(i); \
+  lua_assert(base == L->base && L->base == L->ci->base); \
+  lua_assert(base <= L->top && L->top <= L->stack + L->stacksize); \
+  lua_assert(L->top == L->ci->top || luaG_checkopenop(i)); \
+}
+
+
+/*
+** Dispatch of the opcode handlers. With LUA_USE_JUMPTABLE and a
+** compiler that has labels as values (GCC), every handler ends with
+** its own fetch and an indirect jump through a table of handler
+** addresses, so that the branch predictor sees one jump per opcode
+** instead of the single jump of a switch. Otherwise the handlers
+** are the cases of a switch in the main loop.
+*/
+#if defined(LUA_USE_JUMPTABLE) && defined(__GNUC__)
+#define LUA_JUMPTABLE
+#define vmdispatch(o)	goto *disptab[o];
+#define vmcase(l)	L_##l:
+#define vmbreak		{ vmfetch(); vmdispatch(GET_OPCODE(i)); }
+#else
+#define vmdispatch(o)	switch (o)
+#define vmcase(l)	case l:
+#define vmbreak		continue
+#endif
+
+
+#define arith_op(op,iop,tm) { \
         TValue *rb = RKB(i); \
         TValue *rc = RKC(i); \
-        if (ttisnumber(rb) && ttisnumber(rc)) { \
+        int ir; \
+        if (ttisint(rb) && ttisint(rc) && iop(ivalue(rb), ivalue(rc), &ir)) { \
+          setivalue(ra, ir); \
+        } \
+        else if (ttisnumber(rb) && ttisnumber(rc)) { \
           lua_Number nb = nvalue(rb), nc = nvalue(rc); LUAI_ERRORCHECK() \
           setnvalue(ra, op(nb, nc)); LUAI_ERRORCHECK() \
         } \
@@ -435,6 +718,19 @@ void luaV_execute (lua_State *L, int nexeccalls) {
   StkId base;
   TValue *k;
   const Instruction *pc;
+#ifdef LUA_JUMPTABLE
+  static const void *const disptab[NUM_OPCODES] = {  /* ORDER OP */
+    &&L_OP_MOVE, &&L_OP_LOADK, &&L_OP_LOADBOOL, &&L_OP_LOADNIL,
+    &&L_OP_GETUPVAL, &&L_OP_GETGLOBAL, &&L_OP_GETTABLE, &&L_OP_SETGLOBAL,
+    &&L_OP_SETUPVAL, &&L_OP_SETTABLE, &&L_OP_NEWTABLE, &&L_OP_SELF,
+    &&L_OP_ADD, &&L_OP_SUB, &&L_OP_MUL, &&L_OP_DIV, &&L_OP_MOD, &&L_OP_POW,
+    &&L_OP_UNM, &&L_OP_NOT, &&L_OP_LEN, &&L_OP_CONCAT, &&L_OP_JMP,
+    &&L_OP_EQ, &&L_OP_LT, &&L_OP_LE, &&L_OP_TEST, &&L_OP_TESTSET,
+    &&L_OP_CALL, &&L_OP_TAILCALL, &&L_OP_RETURN, &&L_OP_FORLOOP,
+    &&L_OP_FORPREP, &&L_OP_TFORLOOP, &&L_OP_SETLIST, &&L_OP_CLOSE,
+    &&L_OP_CLOSURE, &&L_OP_VARARG
+  };
+#endif
  reentry:  /* entry point */
   LUAI_ERRORCHECK()
   lua_assert(isLua(L->ci));
@@ -445,135 +741,124 @@ void luaV_execute (lua_State *L, int nexeccalls) {
   k = cl->p->k;
   /* main loop of interpreter */
   for (;;) {
-    const Instruction i = *pc++;
+    Instruction i;
     StkId ra;
-    if ((L->hookmask & (LUA_MASKLINE | LUA_MASKCOUNT)) &&
-        (--L->hookcount == 0 || L->hookmask & LUA_MASKLINE)) {
-      traceexec(L, pc);
-      LUAI_ERRORCHECK()
-      if (L->status == LUA_YIELD) {  /* did hook yield? */
-        L->savedpc = pc - 1;
-        return;
-      }
-      base = L->base;
-    }
-    /* warning!! several calls may realloc the stack and invalidate `ra' */
-    ra = RA(i);
-    lua_assert(base == L->base && L->base == L->ci->base);
-    lua_assert(base <= L->top && L->top <= L->stack + L->stacksize);
-    lua_assert(L->top == L->ci->top || luaG_checkopenop(i));
-    switch (GET_OPCODE(i)) {
-      case OP_MOVE: {
+    vmfetch();
+    vmdispatch (GET_OPCODE(i)) {
+      vmcase(OP_MOVE) {
         setobjs2s(L, ra, RB(i));
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_LOADK: {
+      vmcase(OP_LOADK) {
         setobj2s(L, ra, KBx(i));
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_LOADBOOL: {
+      vmcase(OP_LOADBOOL) {
         setbvalue(ra, GETARG_B(i));
         LUAI_ERRORCHECK()
         if (GETARG_C(i)) pc++;  /* skip next instruction (if C) */
-        continue;
+        vmbreak;
       }
-      case OP_LOADNIL: {
+      vmcase(OP_LOADNIL) {
         TValue *rb = RB(i);
         do {
           setnilvalue(rb--);
           LUAI_ERRORCHECK()
         } while (rb >= ra);
-        continue;
+        vmbreak;
       }
-      case OP_GETUPVAL: {
+      vmcase(OP_GETUPVAL) {
         int b = GETARG_B(i);
         setobj2s(L, ra, cl->upvals[b]->v);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_GETGLOBAL: {
+      vmcase(OP_GETGLOBAL) {
         TValue g;
         TValue *rb = KBx(i);
         sethvalue(L, &g, cl->env);
         LUAI_ERRORCHECK()
         lua_assert(ttisstring(rb));
         Protect(luaV_gettable(L, &g, rb, ra));
-        continue;
+        vmbreak;
       }
-      case OP_GETTABLE: {
+      vmcase(OP_GETTABLE) {
         Protect(luaV_gettable(L, RB(i), RKC(i), ra));
-        continue;
+        vmbreak;
       }
-      case OP_SETGLOBAL: {
+      vmcase(OP_SETGLOBAL) {
         TValue g;
         sethvalue(L, &g, cl->env);
         LUAI_ERRORCHECK()
         lua_assert(ttisstring(KBx(i)));
         Protect(luaV_settable(L, &g, KBx(i), ra));
-        continue;
+        vmbreak;
       }
-      case OP_SETUPVAL: {
+      vmcase(OP_SETUPVAL) {
         UpVal *uv = cl->upvals[GETARG_B(i)];
         setobj(L, uv->v, ra);
         LUAI_ERRORCHECK()
         luaC_barrier(L, uv, ra);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_SETTABLE: {
+      vmcase(OP_SETTABLE) {
         Protect(luaV_settable(L, ra, RKB(i), RKC(i)));
-        continue;
+        vmbreak;
       }
-      case OP_NEWTABLE: {
+      vmcase(OP_NEWTABLE) {
         int b = GETARG_B(i);
         int c = GETARG_C(i);
         sethvalue(L, ra, luaH_new(L, luaO_fb2int(b), luaO_fb2int(c)));
         LUAI_ERRORCHECK()
         Protect(luaC_checkGC(L));
-        continue;
+        vmbreak;
       }
-      case OP_SELF: {
+      vmcase(OP_SELF) {
         StkId rb = RB(i);
         setobjs2s(L, ra+1, rb);
         LUAI_ERRORCHECK()
         Protect(luaV_gettable(L, rb, RKC(i), ra));
-        continue;
+        vmbreak;
       }
-      case OP_ADD: {
-        arith_op(luai_numadd, TM_ADD);
+      vmcase(OP_ADD) {
+        arith_op(luai_numadd, intadd, TM_ADD);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_SUB: {
-        arith_op(luai_numsub, TM_SUB);
+      vmcase(OP_SUB) {
+        arith_op(luai_numsub, intsub, TM_SUB);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_MUL: {
-        arith_op(luai_nummul, TM_MUL);
+      vmcase(OP_MUL) {
+        arith_op(luai_nummul, intmul, TM_MUL);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_DIV: {
-        arith_op(luai_numdiv, TM_DIV);
+      vmcase(OP_DIV) {
+        arith_op(luai_numdiv, nointop, TM_DIV);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_MOD: {
-        arith_op(luai_nummod, TM_MOD);
+      vmcase(OP_MOD) {
+        arith_op(luai_nummod, intmod, TM_MOD);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_POW: {
-        arith_op(luai_numpow, TM_POW);
+      vmcase(OP_POW) {
+        arith_op(luai_numpow, nointop, TM_POW);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_UNM: {
+      vmcase(OP_UNM) {
         TValue *rb = RB(i);
-        if (ttisnumber(rb)) {
+        if (ttisint(rb) && ivalue(rb) != 0 && ivalue(rb) != INT_MIN) {
+          setivalue(ra, -ivalue(rb));
+        }
+        else if (ttisnumber(rb)) {
           lua_Number nb = nvalue(rb);
           LUAI_ERRORCHECK()
           setnvalue(ra, luai_numunm(nb));
@@ -582,25 +867,31 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         else {
           Protect(Arith(L, ra, rb, rb, TM_UNM));
         }
-        continue;
+        vmbreak;
       }
-      case OP_NOT: {
+      vmcase(OP_NOT) {
         int res = l_isfalse(RB(i));  /* next assignment may change this value */
         LUAI_ERRORCHECK()
         setbvalue(ra, res);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_LEN: {
+      vmcase(OP_LEN) {
         const TValue *rb = RB(i);
         switch (ttype(rb)) {
           case LUA_TTABLE: {
-            setnvalue(ra, cast_num(luaH_getn(hvalue(rb))));
+            setivalue(ra, luaH_getn(hvalue(rb)));
             LUAI_ERRORCHECK()
             break;
           }
           case LUA_TSTRING: {
-            setnvalue(ra, cast_num(tsvalue(rb)->len));
+            size_t len = tsvalue(rb)->len;
+            if (len <= cast(size_t, INT_MAX)) {
+              setivalue(ra, cast_int(len));
+            }
+            else {
+              setnvalue(ra, cast_num(len));
+            }
             LUAI_ERRORCHECK()
             break;
           }
@@ -611,24 +902,24 @@ void luaV_execute (lua_State *L, int nexeccalls) {
             )
           }
         }
-        continue;
+        vmbreak;
       }
-      case OP_CONCAT: {
+      vmcase(OP_CONCAT) {
         LUAI_ERRORCHECK()
         int b = GETARG_B(i);
         int c = GETARG_C(i);
         Protect(luaV_concat(L, c-b+1, c); luaC_checkGC(L));
         setobjs2s(L, RA(i), base+b);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_JMP: {
+      vmcase(OP_JMP) {
         LUAI_ERRORCHECK()
         dojump(L, pc, GETARG_sBx(i));
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_EQ: {
+      vmcase(OP_EQ) {
         LUAI_ERRORCHECK()
         TValue *rb = RKB(i);
         TValue *rc = RKC(i);
@@ -638,37 +929,49 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         )
         pc++;
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_LT: {
+      vmcase(OP_LT) {
         LUAI_ERRORCHECK()
-        Protect(
-          if (luaV_lessthan(L, RKB(i), RKC(i)) == GETARG_A(i))
+        TValue *rb = RKB(i);
+        TValue *rc = RKC(i);
+        if (ttisint(rb) && ttisint(rc)) {
+          if ((ivalue(rb) < ivalue(rc)) == GETARG_A(i))
+            dojump(L, pc, GETARG_sBx(*pc));
+        }
+        else Protect(
+          if (luaV_lessthan(L, rb, rc) == GETARG_A(i))
             dojump(L, pc, GETARG_sBx(*pc));
         )
         pc++;
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_LE: {
+      vmcase(OP_LE) {
         LUAI_ERRORCHECK()
-        Protect(
-          if (lessequal(L, RKB(i), RKC(i)) == GETARG_A(i))
+        TValue *rb = RKB(i);
+        TValue *rc = RKC(i);
+        if (ttisint(rb) && ttisint(rc)) {
+          if ((ivalue(rb) <= ivalue(rc)) == GETARG_A(i))
+            dojump(L, pc, GETARG_sBx(*pc));
+        }
+        else Protect(
+          if (lessequal(L, rb, rc) == GETARG_A(i))
             dojump(L, pc, GETARG_sBx(*pc));
         )
         pc++;
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_TEST: {
+      vmcase(OP_TEST) {
         LUAI_ERRORCHECK()
         if (l_isfalse(ra) != GETARG_C(i))
           dojump(L, pc, GETARG_sBx(*pc));
         LUAI_ERRORCHECK()
         pc++;
-        continue;
+        vmbreak;
       }
-      case OP_TESTSET: {
+      vmcase(OP_TESTSET) {
         LUAI_ERRORCHECK()
         TValue *rb = RB(i);
         if (l_isfalse(rb) != GETARG_C(i)) {
@@ -679,9 +982,9 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         }
         LUAI_ERRORCHECK()
         pc++;
-        continue;
+        vmbreak;
       }
-      case OP_CALL: {
+      vmcase(OP_CALL) {
         LUAI_ERRORCHECK()
         int b = GETARG_B(i);
         int nresults = GETARG_C(i) - 1;
@@ -698,14 +1001,14 @@ void luaV_execute (lua_State *L, int nexeccalls) {
             /* it was a C function (`precall' called it); adjust results */
             if (nresults >= 0) L->top = L->ci->top;
             base = L->base;
-            continue;
+            vmbreak;
           }
           default: {
             return;  /* yield */
           }
         }
       }
-      case OP_TAILCALL: {
+      vmcase(OP_TAILCALL) {
         LUAI_ERRORCHECK()
         int b = GETARG_B(i);
         if (b != 0) L->top = ra+b;  /* else previous instruction set top */
@@ -735,14 +1038,14 @@ void luaV_execute (lua_State *L, int nexeccalls) {
           case PCRC: {  /* it was a C function (`precall' called it) */
             base = L->base;
             LUAI_ERRORCHECK()
-            continue;
+            vmbreak;
           }
           default: {
             return;  /* yield */
           }
         }
       }
-      case OP_RETURN: {
+      vmcase(OP_RETURN) {
         LUAI_ERRORCHECK()
         int b = GETARG_B(i);
         if (b != 0) L->top = ra+b-1;
@@ -761,8 +1064,19 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         }
         LUAI_ERRORCHECK()
       }
-      case OP_FORLOOP: {
-        LUAI_ERRORCHECK()
+      vmcase(OP_FORLOOP) {
+        LUAI_ERRORCHECK()
+        if (ttisint(ra)) {  /* int loop? (see OP_FORPREP) */
+          int step = ivalue(ra+2);
+          int idx;
+          if (intadd(ivalue(ra), step, &idx) &&  /* no overflow past limit? */
+              (step > 0 ? idx <= ivalue(ra+1) : ivalue(ra+1) <= idx)) {
+            dojump(L, pc, GETARG_sBx(i));  /* jump back */
+            setivalue(ra, idx);  /* update internal index... */
+            setivalue(ra+3, idx);  /* ...and external index */
+          }
+          vmbreak;
+        }
         lua_Number step = nvalue(ra+2);
         lua_Number idx = luai_numadd(nvalue(ra), step); /* increment index */
         LUAI_ERRORCHECK()
@@ -779,9 +1093,9 @@ void luaV_execute (lua_State *L, int nexeccalls) {
           LUAI_ERRORCHECK()
         }
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_FORPREP: {
+      vmcase(OP_FORPREP) {
         LUAI_ERRORCHECK()
         const TValue *init = ra;
         const TValue *plimit = ra+1;
@@ -794,15 +1108,49 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         else if (!tonumber(pstep, ra+2))
           luaG_runerror(L, LUA_QL("for") " step must be a number");
         LUAI_ERRORCHECK()
+        if (ttisint(init) && ttisint(pstep)) {
+          int limit, prev;
+          if (forlimit(plimit, ivalue(pstep), &limit) &&
+              intsub(ivalue(init), ivalue(pstep), &prev)) {
+            setivalue(ra+1, limit);
+            setivalue(ra, prev);
+            dojump(L, pc, GETARG_sBx(i));
+            vmbreak;
+          }
+        }
+        /* float loop; OP_FORLOOP reads the lua_Numbers directly */
+        setnvalue(ra+1, nvalue(plimit));
+        setnvalue(ra+2, nvalue(pstep));
         setnvalue(ra, luai_numsub(nvalue(ra), nvalue(pstep)));
         LUAI_ERRORCHECK()
         dojump(L, pc, GETARG_sBx(i));
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_TFORLOOP: {
+      vmcase(OP_TFORLOOP) {
         LUAI_ERRORCHECK()
         StkId cb = ra + 3;  /* call base */
+        if (ttislcf(ra) && ttistable(ra+1)) {
+          /* `next' with no call: keep the slot in the control variable */
+          int slot = -1;
+          if (fvalue(ra) == luaV_next && ttisnil(ra+2))
+            slot = 0;  /* first iteration */
+          else if (fvalue(ra) == slotnext && ttisnumber(ra+2))
+            slot = cast_int(nvalue(ra+2));
+          if (slot >= 0) {
+            slot = luaH_nextslot(L, hvalue(ra+1), slot, cb);
+            if (slot) {  /* continue loop? */
+              int n;
+              for (n = 2; n < GETARG_C(i); n++)
+                setnilvalue(cb+n);
+              setfvalue(ra, slotnext);
+              setivalue(ra+2, slot);
+              dojump(L, pc, GETARG_sBx(*pc));  /* jump back */
+            }
+            pc++;
+            vmbreak;
+          }
+        }
         setobjs2s(L, cb+2, ra+2);
         LUAI_ERRORCHECK()
         setobjs2s(L, cb+1, ra+1);
@@ -822,9 +1170,9 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         }
         pc++;
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_SETLIST: {
+      vmcase(OP_SETLIST) {
         int n = GETARG_B(i);
         int c = GETARG_C(i);
         int last;
@@ -847,14 +1195,14 @@ void luaV_execute (lua_State *L, int nexeccalls) {
           luaC_barriert(L, h, val);
         }
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_CLOSE: {
+      vmcase(OP_CLOSE) {
         luaF_close(L, ra);
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_CLOSURE: {
+      vmcase(OP_CLOSURE) {
         Proto *p;
         Closure *ncl;
         int nup, j;
@@ -876,9 +1224,9 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         LUAI_ERRORCHECK()
         Protect(luaC_checkGC(L));
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
-      case OP_VARARG: {
+      vmcase(OP_VARARG) {
         int b = GETARG_B(i) - 1;
         int j;
         CallInfo *ci = L->ci;
@@ -901,7 +1249,7 @@ void luaV_execute (lua_State *L, int nexeccalls) {
           }
         }
         LUAI_ERRORCHECK()
-        continue;
+        vmbreak;
       }
     }
   }
@@ -59,6 +59,7 @@ static void PrintConstant(const Proto* f, int i)
   case LUA_TBOOLEAN:
 	printf(bvalue(o) ? "true" : "false");
 	break;
+  case LUA_TINT:
   case LUA_TNUMBER:
 	printf(LUA_NUMBER_FMT,nvalue(o));
 	break;
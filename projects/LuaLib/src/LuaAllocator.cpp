@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <maheap.h>
+#include <mastring.h>
+
+#include "inc/LuaAllocator.h"
+
+namespace MobileLua
+{
+
+/**
+ * Get the size class of a pooled block size.
+ */
+#define SIZE_CLASS(size) \
+	(((int) (size) - 1) / LuaPoolAllocator::SIZE_CLASS_STEP)
+
+/**
+ * Pages start with a pointer to the next page. The header is
+ * padded to keep the blocks aligned for doubles.
+ */
+#define PAGE_HEADER_SIZE 8
+
+// ========== LuaAllocator ==========
+
+/**
+ * Destructor.
+ */
+LuaAllocator::~LuaAllocator()
+{
+}
+
+/**
+ * Allocate, resize or free a block using realloc and free.
+ */
+void* LuaAllocator::reallocate(void* ptr, size_t oldSize, size_t newSize)
+{
+	if (0 == newSize)
+	{
+		free(ptr);
+		return NULL;
+	}
+
+	return realloc(ptr, newSize);
+}
+
+/**
+ * @return Zero, there are no size classes.
+ */
+int LuaAllocator::getNumberOfSizeClasses()
+{
+	return 0;
+}
+
+/**
+ * There are no size classes, so there are no statistics.
+ */
+void LuaAllocator::getSizeClassStats(int index, LuaAllocatorStats* stats)
+{
+	memset(stats, 0, sizeof(LuaAllocatorStats));
+}
+
+// ========== LuaPoolAllocator ==========
+
+/**
+ * Constructor.
+ */
+LuaPoolAllocator::LuaPoolAllocator() :
+	mPages(NULL),
+	mSmallHeapBlocks(0)
+{
+	for (int i = 0; i < NUMBER_OF_SIZE_CLASSES; ++i)
+	{
+		mFreeLists[i] = NULL;
+		mStats[i].blockSize = (i + 1) * SIZE_CLASS_STEP;
+		mStats[i].hits = 0;
+		mStats[i].misses = 0;
+		mStats[i].blocksInUse = 0;
+	}
+}
+
+/**
+ * Destructor. Frees all pages.
+ */
+LuaPoolAllocator::~LuaPoolAllocator()
+{
+	while (NULL != mPages)
+	{
+		void* next = *(void**) mPages;
+		free(mPages);
+		mPages = next;
+	}
+}
+
+/**
+ * Allocate, resize or free a block. Blocks are pooled or not
+ * depending on their size, so a resize may move a block
+ * between the pool and the heap. Lua expects shrinking a
+ * block to always succeed, so a shrink only moves the block
+ * when its new size class has a free block.
+ */
+void* LuaPoolAllocator::reallocate(
+	void* ptr,
+	size_t oldSize,
+	size_t newSize)
+{
+	bool isSmall = NULL != ptr && oldSize <= MAX_POOLED_SIZE;
+	bool isPooled = isSmall
+		&& (0 == mSmallHeapBlocks || isPoolBlock(ptr));
+
+	// Free.
+	if (0 == newSize)
+	{
+		if (isPooled)
+		{
+			freeBlock(SIZE_CLASS(oldSize), ptr);
+		}
+		else
+		{
+			if (isSmall)
+			{
+				mSmallHeapBlocks--;
+			}
+			free(ptr);
+		}
+		return NULL;
+	}
+
+	// Large blocks stay on the heap.
+	if (newSize > MAX_POOLED_SIZE && !isPooled)
+	{
+		void* block = realloc(ptr, newSize);
+		if (NULL != block && isSmall)
+		{
+			mSmallHeapBlocks--;
+		}
+		return block;
+	}
+
+	// The block already has room for the new size.
+	if (isPooled && SIZE_CLASS(oldSize) == SIZE_CLASS(newSize))
+	{
+		return ptr;
+	}
+
+	// Keep a shrinking block where it is when there is no free
+	// block to move it to. A pooled block then counts as a block
+	// of the smaller class, which it will be freed to.
+	if (NULL != ptr
+		&& newSize < oldSize
+		&& NULL == mFreeLists[SIZE_CLASS(newSize)])
+	{
+		if (isPooled)
+		{
+			mStats[SIZE_CLASS(oldSize)].blocksInUse--;
+			mStats[SIZE_CLASS(newSize)].blocksInUse++;
+		}
+		else if (!isSmall)
+		{
+			mSmallHeapBlocks++;
+		}
+		return ptr;
+	}
+
+	// Allocate a new block and move the data.
+	void* block;
+	if (newSize <= MAX_POOLED_SIZE)
+	{
+		block = allocateBlock(SIZE_CLASS(newSize));
+	}
+	else
+	{
+		block = malloc(newSize);
+	}
+	if (NULL == block)
+	{
+		return NULL;
+	}
+
+	if (NULL != ptr)
+	{
+		memcpy(block, ptr, oldSize < newSize ? oldSize : newSize);
+		if (isPooled)
+		{
+			freeBlock(SIZE_CLASS(oldSize), ptr);
+		}
+		else
+		{
+			if (isSmall)
+			{
+				mSmallHeapBlocks--;
+			}
+			free(ptr);
+		}
+	}
+
+	return block;
+}
+
+/**
+ * @return The number of size classes.
+ */
+int LuaPoolAllocator::getNumberOfSizeClasses()
+{
+	return NUMBER_OF_SIZE_CLASSES;
+}
+
+/**
+ * Get statistics for a size class.
+ */
+void LuaPoolAllocator::getSizeClassStats(int index, LuaAllocatorStats* stats)
+{
+	if (index < 0 || index >= NUMBER_OF_SIZE_CLASSES)
+	{
+		LuaAllocator::getSizeClassStats(index, stats);
+		return;
+	}
+
+	*stats = mStats[index];
+}
+
+/**
+ * Allocate a block from a size class.
+ */
+void* LuaPoolAllocator::allocateBlock(int sizeClass)
+{
+	if (NULL == mFreeLists[sizeClass])
+	{
+		mStats[sizeClass].misses++;
+		if (!growSizeClass(sizeClass))
+		{
+			return NULL;
+		}
+	}
+	else
+	{
+		mStats[sizeClass].hits++;
+	}
+
+	// Unlink the first block of the free list.
+	void* block = mFreeLists[sizeClass];
+	mFreeLists[sizeClass] = *(void**) block;
+	mStats[sizeClass].blocksInUse++;
+
+	return block;
+}
+
+/**
+ * Return a block to its size class.
+ */
+void LuaPoolAllocator::freeBlock(int sizeClass, void* block)
+{
+	*(void**) block = mFreeLists[sizeClass];
+	mFreeLists[sizeClass] = block;
+	mStats[sizeClass].blocksInUse--;
+}
+
+/**
+ * Add a new page of blocks to a size class.
+ * @return Non-zero if successful, zero if out of memory.
+ */
+int LuaPoolAllocator::growSizeClass(int sizeClass)
+{
+	char* page = (char*) malloc(PAGE_SIZE);
+	if (NULL == page)
+	{
+		return 0;
+	}
+
+	// Link the page into the page list.
+	*(void**) page = mPages;
+	mPages = page;
+
+	// Put the blocks of the page on the free list.
+	int blockSize = mStats[sizeClass].blockSize;
+	char* block = page + PAGE_HEADER_SIZE;
+	char* end = page + PAGE_SIZE - blockSize;
+	while (block <= end)
+	{
+		*(void**) block = mFreeLists[sizeClass];
+		mFreeLists[sizeClass] = block;
+		block += blockSize;
+	}
+
+	return 1;
+}
+
+/**
+ * @return Non-zero if the block is in a page of the pool.
+ */
+int LuaPoolAllocator::isPoolBlock(void* block)
+{
+	for (char* page = (char*) mPages; NULL != page; page = *(char**) page)
+	{
+		if ((char*) block > page && (char*) block < page + PAGE_SIZE)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+}
@@ -0,0 +1,772 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+extern "C"
+{
+#include "lua.h"
+#include "lauxlib.h"
+#include "inc/SystemAPI.h"
+}
+
+#include <mastring.h>
+
+#include "inc/LuaBuffer.h"
+
+namespace MobileLua
+{
+
+/**
+ * Registry keys of the metatables.
+ */
+#define BUFFER_TYPE "MobileLua.Buffer"
+#define BUFFER_VIEW_TYPE "MobileLua.BufferView"
+
+/**
+ * The metatables and the method table are upvalues of
+ * the buffer functions, which makes type checks cheap.
+ */
+#define BUFFER_METATABLE lua_upvalueindex(1)
+#define BUFFER_VIEW_METATABLE lua_upvalueindex(2)
+#define BUFFER_METHODS lua_upvalueindex(3)
+
+/**
+ * A view of a buffer with a given byte order. The view keeps
+ * the buffer alive through its environment table.
+ */
+struct BufferView
+{
+	unsigned char* data;
+	int size;
+	bool bigEndian;
+};
+
+/**
+ * Access to the bytes at an offset in a buffer.
+ */
+struct BufferAccess
+{
+	unsigned char* bytes;
+	bool bigEndian;
+};
+
+/**
+ * Check if the host stores numbers big endian.
+ */
+static bool isHostBigEndian()
+{
+	static const int one = 1;
+	return 0 == *(const char*) &one;
+}
+
+/**
+ * Copy the bytes of a number, reversing them if the byte
+ * order of the buffer differs from the host.
+ */
+static void copyNumberBytes(
+	void* dst,
+	const void* src,
+	int size,
+	bool bigEndian)
+{
+	if (bigEndian == isHostBigEndian())
+	{
+		memcpy(dst, src, size);
+	}
+	else
+	{
+		const unsigned char* s = (const unsigned char*) src;
+		unsigned char* d = (unsigned char*) dst;
+		for (int i = 0; i < size; ++i)
+		{
+			d[i] = s[size - 1 - i];
+		}
+	}
+}
+
+/**
+ * Check that the argument at index is a number, or absent if it
+ * is optional. On error, false is returned and callers must
+ * return before they use any argument, since luaL_check* does
+ * not stop the function on MoSync.
+ */
+static bool checkNumberArg(lua_State* L, int index, bool optional)
+{
+	if (lua_isnumber(L, index)
+		|| (optional && lua_isnoneornil(L, index)))
+	{
+		return true;
+	}
+	luaL_typerror(L, index, "number");
+	return false;
+}
+
+/**
+ * Get the bytes of the buffer or view at the first argument,
+ * after checking that the offset at the second argument leaves
+ * room for size bytes. Buffers are little endian. On error,
+ * bytes is NULL. Callers must then return, since MoSync has no
+ * longjmp to leave the function.
+ */
+static BufferAccess checkBufferAccess(lua_State* L, int size)
+{
+	BufferAccess access;
+	access.bytes = NULL;
+	access.bigEndian = false;
+	unsigned char* data = NULL;
+	int bufferSize = 0;
+
+	if (lua_getmetatable(L, 1))
+	{
+		if (lua_rawequal(L, -1, BUFFER_METATABLE))
+		{
+			data = (unsigned char*) lua_touserdata(L, 1);
+			bufferSize = (int) lua_objlen(L, 1);
+			access.bigEndian = false;
+		}
+		else if (lua_rawequal(L, -1, BUFFER_VIEW_METATABLE))
+		{
+			BufferView* view = (BufferView*) lua_touserdata(L, 1);
+			data = view->data;
+			bufferSize = view->size;
+			access.bigEndian = view->bigEndian;
+		}
+		lua_pop(L, 1);
+	}
+	if (NULL == data)
+	{
+		luaL_typerror(L, 1, "Buffer");
+		return access;
+	}
+	if (!checkNumberArg(L, 2, false))
+	{
+		return access;
+	}
+
+	int offset = luaL_checkint(L, 2);
+	if (offset < 0 || bufferSize - size < offset)
+	{
+		luaL_argerror(L, 2, "offset out of range");
+		return access;
+	}
+
+	access.bytes = data + offset;
+	return access;
+}
+
+/**
+ * Convert a Lua number to the bits of a 32-bit integer.
+ * Accepts both signed and unsigned values.
+ */
+static unsigned int checkBits(lua_State* L, int index)
+{
+	lua_Number n = luaL_checknumber(L, index);
+	return n < 0 ? (unsigned int) (int) n : (unsigned int) n;
+}
+
+static int luaBufferGetByte(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 1);
+	if (NULL == access.bytes)
+	{
+		return 0;
+	}
+	lua_pushinteger(L, access.bytes[0]);
+	return 1; // Number of results
+}
+
+static int luaBufferSetByte(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 1);
+	if (NULL == access.bytes || !checkNumberArg(L, 3, false))
+	{
+		return 0;
+	}
+	access.bytes[0] = (unsigned char) checkBits(L, 3);
+	return 0; // Number of results
+}
+
+static int luaBufferGetInt16(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 2);
+	if (NULL == access.bytes)
+	{
+		return 0;
+	}
+	short value;
+	copyNumberBytes(&value, access.bytes, 2, access.bigEndian);
+	lua_pushinteger(L, value);
+	return 1; // Number of results
+}
+
+static int luaBufferSetInt16(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 2);
+	if (NULL == access.bytes || !checkNumberArg(L, 3, false))
+	{
+		return 0;
+	}
+	short value = (short) checkBits(L, 3);
+	copyNumberBytes(access.bytes, &value, 2, access.bigEndian);
+	return 0; // Number of results
+}
+
+static int luaBufferGetInt32(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 4);
+	if (NULL == access.bytes)
+	{
+		return 0;
+	}
+	int value;
+	copyNumberBytes(&value, access.bytes, 4, access.bigEndian);
+	lua_pushnumber(L, value);
+	return 1; // Number of results
+}
+
+static int luaBufferSetInt32(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 4);
+	if (NULL == access.bytes || !checkNumberArg(L, 3, false))
+	{
+		return 0;
+	}
+	unsigned int value = checkBits(L, 3);
+	copyNumberBytes(access.bytes, &value, 4, access.bigEndian);
+	return 0; // Number of results
+}
+
+static int luaBufferGetFloat(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 4);
+	if (NULL == access.bytes)
+	{
+		return 0;
+	}
+	float value;
+	copyNumberBytes(&value, access.bytes, 4, access.bigEndian);
+	lua_pushnumber(L, value);
+	return 1; // Number of results
+}
+
+static int luaBufferSetFloat(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 4);
+	if (NULL == access.bytes || !checkNumberArg(L, 3, false))
+	{
+		return 0;
+	}
+	float value = (float) luaL_checknumber(L, 3);
+	copyNumberBytes(access.bytes, &value, 4, access.bigEndian);
+	return 0; // Number of results
+}
+
+static int luaBufferGetDouble(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 8);
+	if (NULL == access.bytes)
+	{
+		return 0;
+	}
+	double value;
+	copyNumberBytes(&value, access.bytes, 8, access.bigEndian);
+	lua_pushnumber(L, value);
+	return 1; // Number of results
+}
+
+static int luaBufferSetDouble(lua_State* L)
+{
+	BufferAccess access = checkBufferAccess(L, 8);
+	if (NULL == access.bytes || !checkNumberArg(L, 3, false))
+	{
+		return 0;
+	}
+	double value = (double) luaL_checknumber(L, 3);
+	copyNumberBytes(access.bytes, &value, 8, access.bigEndian);
+	return 0; // Number of results
+}
+
+/**
+ * Get the size of a buffer or view in bytes.
+ */
+static int luaBufferSize(lua_State* L)
+{
+	int size = 0;
+	if (NULL == luaToBuffer(L, 1, &size))
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+	lua_pushinteger(L, size);
+	return 1; // Number of results
+}
+
+/**
+ * Get the bytes of a buffer, view or string argument. On error,
+ * NULL is returned and callers must return.
+ */
+static unsigned char* checkBytes(lua_State* L, int index, int* size)
+{
+	if (LUA_TSTRING == lua_type(L, index))
+	{
+		size_t length;
+		const char* s = lua_tolstring(L, index, &length);
+		*size = (int) length;
+		return (unsigned char*) s;
+	}
+
+	unsigned char* data = (unsigned char*) luaToBuffer(L, index, size);
+	if (NULL == data)
+	{
+		luaL_typerror(L, index, "Buffer or string");
+	}
+	return data;
+}
+
+/**
+ * Check that count bytes at offset are within size bytes.
+ * On error, false is returned and callers must return.
+ */
+static bool checkRange(lua_State* L, int arg, int size, int offset, int count)
+{
+	if (offset < 0 || count < 0 || size - offset < count)
+	{
+		luaL_argerror(L, arg, "range outside buffer");
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Copy bytes from a buffer or string to the buffer.
+ * b:copy(offset, source, sourceOffset, count), sourceOffset
+ * defaults to zero and count to the rest of the source.
+ * The source may be the buffer itself, overlap is handled.
+ */
+static int luaBufferCopy(lua_State* L)
+{
+	int size, sourceSize;
+	unsigned char* data = (unsigned char*) luaToBuffer(L, 1, &size);
+	if (NULL == data)
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+	unsigned char* source = checkBytes(L, 3, &sourceSize);
+	if (NULL == source
+		|| !checkNumberArg(L, 2, false)
+		|| !checkNumberArg(L, 4, true)
+		|| !checkNumberArg(L, 5, true))
+	{
+		return 0;
+	}
+
+	int offset = luaL_checkint(L, 2);
+	int sourceOffset = luaL_optint(L, 4, 0);
+	int count = luaL_optint(L, 5, sourceSize - sourceOffset);
+	if (!checkRange(L, 4, sourceSize, sourceOffset, count)
+		|| !checkRange(L, 2, size, offset, count))
+	{
+		return 0;
+	}
+
+	SysBufferCopyBytes(source, sourceOffset, data, offset, count);
+	return 0; // Number of results
+}
+
+/**
+ * Get bytes of the buffer as a string.
+ * b:getString(offset, count), offset defaults to zero
+ * and count to the rest of the buffer.
+ */
+static int luaBufferGetString(lua_State* L)
+{
+	int size;
+	unsigned char* data = (unsigned char*) luaToBuffer(L, 1, &size);
+	if (NULL == data)
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+	if (!checkNumberArg(L, 2, true) || !checkNumberArg(L, 3, true))
+	{
+		return 0;
+	}
+
+	int offset = luaL_optint(L, 2, 0);
+	int count = luaL_optint(L, 3, size - offset);
+	if (!checkRange(L, 2, size, offset, count))
+	{
+		return 0;
+	}
+
+	lua_pushlstring(L, (const char*) data + offset, count);
+	return 1; // Number of results
+}
+
+/**
+ * Set bytes of the buffer to a value.
+ * b:fill(value, offset, count), offset defaults to zero
+ * and count to the rest of the buffer.
+ */
+static int luaBufferFill(lua_State* L)
+{
+	int size;
+	unsigned char* data = (unsigned char*) luaToBuffer(L, 1, &size);
+	if (NULL == data)
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+	if (!checkNumberArg(L, 2, false)
+		|| !checkNumberArg(L, 3, true)
+		|| !checkNumberArg(L, 4, true))
+	{
+		return 0;
+	}
+
+	int value = (int) checkBits(L, 2);
+	int offset = luaL_optint(L, 3, 0);
+	int count = luaL_optint(L, 4, size - offset);
+	if (!checkRange(L, 3, size, offset, count))
+	{
+		return 0;
+	}
+
+	SysBufferFillBytes(data, offset, value, count);
+	return 0; // Number of results
+}
+
+/**
+ * Compare bytes of the buffer with a buffer or string.
+ * b:compare(offset, other, otherOffset, count), otherOffset
+ * defaults to zero and count to the rest of the other.
+ * Returns zero if equal, otherwise the difference between
+ * the first differing bytes.
+ */
+static int luaBufferCompare(lua_State* L)
+{
+	int size, otherSize;
+	unsigned char* data = (unsigned char*) luaToBuffer(L, 1, &size);
+	if (NULL == data)
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+	unsigned char* other = checkBytes(L, 3, &otherSize);
+	if (NULL == other
+		|| !checkNumberArg(L, 2, false)
+		|| !checkNumberArg(L, 4, true)
+		|| !checkNumberArg(L, 5, true))
+	{
+		return 0;
+	}
+
+	int offset = luaL_checkint(L, 2);
+	int otherOffset = luaL_optint(L, 4, 0);
+	int count = luaL_optint(L, 5, otherSize - otherOffset);
+	if (!checkRange(L, 4, otherSize, otherOffset, count)
+		|| !checkRange(L, 2, size, offset, count))
+	{
+		return 0;
+	}
+
+	lua_pushinteger(L,
+		SysBufferCompareBytes(data, offset, other, otherOffset, count));
+	return 1; // Number of results
+}
+
+/**
+ * Find a byte value, string or buffer in the buffer.
+ * b:find(pattern, offset, count), offset defaults to zero
+ * and count to the rest of the buffer. Returns the offset
+ * of the first match, or nil if not found.
+ */
+static int luaBufferFind(lua_State* L)
+{
+	int size;
+	unsigned char* data = (unsigned char*) luaToBuffer(L, 1, &size);
+	if (NULL == data)
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+	if (!checkNumberArg(L, 3, true) || !checkNumberArg(L, 4, true))
+	{
+		return 0;
+	}
+
+	int offset = luaL_optint(L, 3, 0);
+	int count = luaL_optint(L, 4, size - offset);
+	if (!checkRange(L, 3, size, offset, count))
+	{
+		return 0;
+	}
+
+	int result;
+	if (LUA_TNUMBER == lua_type(L, 2))
+	{
+		result = SysBufferFindByte(data, offset, count, (int) checkBits(L, 2));
+	}
+	else
+	{
+		int patternSize;
+		unsigned char* pattern = checkBytes(L, 2, &patternSize);
+		if (NULL == pattern)
+		{
+			return 0;
+		}
+		result = SysBufferFindBytes(
+			data, offset, count, pattern, 0, patternSize);
+	}
+
+	if (result < 0)
+	{
+		lua_pushnil(L);
+	}
+	else
+	{
+		lua_pushinteger(L, result);
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Create a view of a buffer with the given byte order.
+ */
+static int pushBufferView(lua_State* L, bool bigEndian)
+{
+	int size;
+	unsigned char* data = (unsigned char*) luaToBuffer(L, 1, &size);
+	if (NULL == data)
+	{
+		return luaL_typerror(L, 1, "Buffer");
+	}
+
+	BufferView* view = (BufferView*) lua_newuserdata(L, sizeof(BufferView));
+	view->data = data;
+	view->size = size;
+	view->bigEndian = bigEndian;
+	lua_pushvalue(L, BUFFER_VIEW_METATABLE);
+	lua_setmetatable(L, -2);
+
+	// Keep the buffer alive as long as the view.
+	lua_createtable(L, 1, 0);
+	lua_pushvalue(L, 1);
+	lua_rawseti(L, -2, 1);
+	lua_setfenv(L, -2);
+
+	return 1; // Number of results
+}
+
+static int luaBufferBigEndian(lua_State* L)
+{
+	return pushBufferView(L, true);
+}
+
+static int luaBufferLittleEndian(lua_State* L)
+{
+	return pushBufferView(L, false);
+}
+
+/**
+ * Index a buffer or view. Numbers are byte offsets, other
+ * keys are method names.
+ */
+static int luaBufferIndex(lua_State* L)
+{
+	if (LUA_TNUMBER == lua_type(L, 2))
+	{
+		return luaBufferGetByte(L);
+	}
+
+	lua_pushvalue(L, 2);
+	lua_rawget(L, BUFFER_METHODS);
+	return 1; // Number of results
+}
+
+/**
+ * Set a byte in a buffer or view, the key is the byte offset.
+ */
+static int luaBufferNewIndex(lua_State* L)
+{
+	if (LUA_TNUMBER != lua_type(L, 2))
+	{
+		return luaL_argerror(L, 2, "byte offset expected");
+	}
+	return luaBufferSetByte(L);
+}
+
+static int luaBufferToString(lua_State* L)
+{
+	int size = 0;
+	luaToBuffer(L, 1, &size);
+	lua_pushfstring(L, "Buffer (%d bytes)", size);
+	return 1; // Number of results
+}
+
+/**
+ * Create a zero filled buffer.
+ */
+static int luaBufferCreate(lua_State* L)
+{
+	if (!checkNumberArg(L, 1, false))
+	{
+		return 0;
+	}
+	int size = luaL_checkint(L, 1);
+	if (size < 0)
+	{
+		return luaL_argerror(L, 1, "negative size");
+	}
+	luaPushNewBuffer(L, size);
+	return 1; // Number of results
+}
+
+/**
+ * Free data allocated with SysAlloc. Buffers are freed by
+ * the garbage collector, so they are ignored. This replaces
+ * the SysFree binding, which would free any pointer.
+ */
+static int luaFree(lua_State* L)
+{
+	if (lua_islightuserdata(L, 1))
+	{
+		SysFree(lua_touserdata(L, 1));
+	}
+	return 0; // Number of results
+}
+
+/**
+ * Methods of buffers and views.
+ */
+static const luaL_Reg sBufferMethods[] =
+{
+	{ "getByte", luaBufferGetByte },
+	{ "setByte", luaBufferSetByte },
+	{ "getInt16", luaBufferGetInt16 },
+	{ "setInt16", luaBufferSetInt16 },
+	{ "getInt32", luaBufferGetInt32 },
+	{ "setInt32", luaBufferSetInt32 },
+	{ "getFloat", luaBufferGetFloat },
+	{ "setFloat", luaBufferSetFloat },
+	{ "getDouble", luaBufferGetDouble },
+	{ "setDouble", luaBufferSetDouble },
+	{ "copy", luaBufferCopy },
+	{ "getString", luaBufferGetString },
+	{ "fill", luaBufferFill },
+	{ "compare", luaBufferCompare },
+	{ "find", luaBufferFind },
+	{ "size", luaBufferSize },
+	{ "bigEndian", luaBufferBigEndian },
+	{ "littleEndian", luaBufferLittleEndian },
+	{ NULL, NULL }
+};
+
+/**
+ * Metamethods of buffers and views.
+ */
+static const luaL_Reg sBufferMetamethods[] =
+{
+	{ "__index", luaBufferIndex },
+	{ "__newindex", luaBufferNewIndex },
+	{ "__len", luaBufferSize },
+	{ "__tostring", luaBufferToString },
+	{ NULL, NULL }
+};
+
+/**
+ * Set the functions in a list as fields of the table on top
+ * of the stack, with the metatables and methods as upvalues.
+ */
+static void setBufferFunctions(lua_State* L, const luaL_Reg* functions)
+{
+	for (; NULL != functions->name; ++functions)
+	{
+		luaL_getmetatable(L, BUFFER_TYPE);
+		luaL_getmetatable(L, BUFFER_VIEW_TYPE);
+		lua_getfield(L, LUA_REGISTRYINDEX, BUFFER_TYPE ".methods");
+		lua_pushcclosure(L, functions->func, 3);
+		lua_setfield(L, -2, functions->name);
+	}
+}
+
+void luaOpenBuffer(lua_State* L)
+{
+	// Create the metatables and the method table first,
+	// they are upvalues of all functions.
+	luaL_newmetatable(L, BUFFER_TYPE);
+	luaL_newmetatable(L, BUFFER_VIEW_TYPE);
+	lua_newtable(L);
+	lua_pushvalue(L, -1);
+	lua_setfield(L, LUA_REGISTRYINDEX, BUFFER_TYPE ".methods");
+
+	// Stack: buffer metatable, view metatable, methods.
+	setBufferFunctions(L, sBufferMethods);
+	lua_pop(L, 1);
+	setBufferFunctions(L, sBufferMetamethods);
+	lua_pop(L, 1);
+	setBufferFunctions(L, sBufferMetamethods);
+	lua_pop(L, 1);
+
+	lua_pushlightcfunction(L, luaBufferCreate);
+	lua_setglobal(L, "SysBufferCreate");
+	lua_pushlightcfunction(L, luaFree);
+	lua_setglobal(L, "SysFree");
+}
+
+void* luaPushNewBuffer(lua_State* L, int size)
+{
+	void* data = lua_newuserdata(L, size);
+	if (NULL != data)
+	{
+		memset(data, 0, size);
+		luaL_getmetatable(L, BUFFER_TYPE);
+		lua_setmetatable(L, -2);
+	}
+	return data;
+}
+
+void* luaToBuffer(lua_State* L, int index, int* size)
+{
+	void* data = NULL;
+
+	if (lua_getmetatable(L, index))
+	{
+		luaL_getmetatable(L, BUFFER_TYPE);
+		if (lua_rawequal(L, -1, -2))
+		{
+			data = lua_touserdata(L, index);
+			*size = (int) lua_objlen(L, index);
+		}
+		else
+		{
+			luaL_getmetatable(L, BUFFER_VIEW_TYPE);
+			if (lua_rawequal(L, -1, -3))
+			{
+				BufferView* view = (BufferView*) lua_touserdata(L, index);
+				data = view->data;
+				*size = view->size;
+			}
+			lua_pop(L, 1);
+		}
+		lua_pop(L, 2);
+	}
+
+	return data;
+}
+
+}
@@ -32,8 +32,12 @@ extern "C"
 #include <maapi.h>
 #include <MAUtil/Geometry.h>
 #include <conprint.h>
+#include <mavsprintf.h>
 
 #include "inc/LuaEngine.h"
+#include "inc/LuaBuffer.h"
+#include "inc/LuaStruct.h"
+#include "inc/LuaStringBuilder.h"
 
 // #include <tolua/tolua.h>
 
@@ -97,12 +101,168 @@ static bool isinteger(lua_State *L, int narg)
 	}
 }
 
+/**
+ * Size of the blocks read by the lua_Reader functions below.
+ */
+#define READER_BLOCK_SIZE LUAL_BUFFERSIZE
+
+/**
+ * State of a lua_Reader that streams a chunk from a data handle.
+ */
+struct HandleReader
+{
+	MAHandle handle;
+	int offset;
+	int size;
+	char block[READER_BLOCK_SIZE];
+};
+
+/**
+ * lua_Reader that reads a data handle in fixed-size blocks, so that
+ * the chunk is never copied to memory as a whole. lua_load checks the
+ * first byte of the chunk, so precompiled bytecode (starting with
+ * LUA_SIGNATURE) goes straight to the undumper, skipping the parser.
+ */
+static const char* readHandle(lua_State* L, void* data, size_t* size)
+{
+	HandleReader* reader = (HandleReader*) data;
+
+	int blockSize = reader->size - reader->offset;
+	if (blockSize <= 0)
+	{
+		return NULL;
+	}
+	if (blockSize > READER_BLOCK_SIZE)
+	{
+		blockSize = READER_BLOCK_SIZE;
+	}
+
+	maReadData(reader->handle, reader->block, reader->offset, blockSize);
+	reader->offset += blockSize;
+
+	*size = blockSize;
+	return reader->block;
+}
+
+/**
+ * State of a lua_Reader that streams a chunk from a file.
+ */
+struct FileReader
+{
+	MAHandle file;
+	int remaining;
+	char block[READER_BLOCK_SIZE];
+};
+
+/**
+ * lua_Reader that reads an open file in fixed-size blocks.
+ * Like readHandle, this handles both source and bytecode.
+ */
+static const char* readFile(lua_State* L, void* data, size_t* size)
+{
+	FileReader* reader = (FileReader*) data;
+
+	int blockSize = reader->remaining;
+	if (blockSize <= 0)
+	{
+		return NULL;
+	}
+	if (blockSize > READER_BLOCK_SIZE)
+	{
+		blockSize = READER_BLOCK_SIZE;
+	}
+
+	if (maFileRead(reader->file, reader->block, blockSize) < 0)
+	{
+		return NULL;
+	}
+	reader->remaining -= blockSize;
+
+	*size = blockSize;
+	return reader->block;
+}
+
+/**
+ * Memory allocation function used by the Lua state of an engine.
+ * Forwards to the allocator of the engine, and keeps track of
+ * the number of bytes in use and the high-water mark.
+ * An allocation that exceeds the memory budget of the engine is
+ * counted and goes through. The Lua core then does a full
+ * collection at its next collector check, and fails the running
+ * script with a memory error if the usage is still over the
+ * budget. Refusing the allocation here is not an option: the Lua
+ * core on MoSync has no longjmp, and the callers of the allocator
+ * do not check for a failed allocation. Collecting here is not
+ * safe either, objects under construction are not yet reachable.
+ */
+static void* allocate(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+	LuaEngine* engine = (LuaEngine*) ud;
+
+	if (0 != engine->mMemoryBudget
+		&& nsize > osize
+		&& engine->mMemoryInUse + (int) (nsize - osize) > engine->mMemoryBudget)
+	{
+		engine->mMemoryBudgetHits++;
+	}
+
+	void* block = engine->mAllocator->reallocate(ptr, osize, nsize);
+	if (0 == nsize)
+	{
+		engine->mMemoryInUse -= osize;
+	}
+	else if (NULL != block)
+	{
+		engine->mMemoryInUse += nsize - osize;
+		if (engine->mMemoryInUse > engine->mMemoryPeak)
+		{
+			engine->mMemoryPeak = engine->mMemoryInUse;
+		}
+	}
+	return block;
+}
+
+/**
+ * Called by Lua on errors outside of a protected call.
+ */
+static int panic(lua_State *L)
+{
+	char message[1024];
+	snprintf(
+		message,
+		sizeof(message),
+		"PANIC: unprotected error in call to Lua API (%s)\n",
+		lua_tostring(L, -1));
+	maPanic(-1, message);
+	return 0;
+}
+
 static LuaEngine* getLuaEngineInstance(lua_State *L)
 {
     // Get pointer to engine instance from global Lua register.
     return (LuaEngine*) getUserData(L, "LuaEngineInstance");
 }
 
+/**
+ * Get the engine passed as a parameter to a Lua primitive.
+ * If the parameter is missing, the engine that runs the
+ * calling code is returned.
+ */
+static LuaEngine* getLuaEngineParam(lua_State *L, int index)
+{
+	if (lua_isnoneornil(L, index))
+	{
+		return getLuaEngineInstance(L);
+	}
+
+	if (lua_islightuserdata(L, index))
+	{
+		return (LuaEngine*) lua_touserdata(L, index);
+	}
+
+	return NULL;
+}
+
 
 /**
  * Define a global table if it does not exist.
@@ -143,7 +303,7 @@ static void RegTableFun(
 	lua_pushstring(L, funName);
 
 	// Push value.
-	lua_pushcfunction(L, funPointer);
+	lua_pushlightcfunction(L, funPointer);
 
 	// Set table entry. Pops value and key.
 	lua_rawset(L, -3);
@@ -157,7 +317,7 @@ static void RegFun(
 	const char* funName,
 	lua_CFunction funPointer)
 {
-	lua_pushcfunction(L, funPointer);
+	lua_pushlightcfunction(L, funPointer);
 	lua_setglobal(L, funName);
 }
 
@@ -184,12 +344,28 @@ static int luaPrint(lua_State *L)
 }
 
 /**
- * Convert the contents of a string pointer (char*) to a Lua string.
+ * Convert the contents of a string pointer (char*) or
+ * a Buffer to a Lua string.
  */
 static int luaToString(lua_State *L)
 {
-	// First param is pointer to text buffer, must not
-	// be nil and must be light user data.
+	// The text in a Buffer ends at a zero byte or at
+	// the end of the buffer.
+	int size;
+	char* bufferText = (char*) luaToBuffer(L, 1, &size);
+	if (NULL != bufferText)
+	{
+		int length = 0;
+		while (length < size && 0 != bufferText[length])
+		{
+			++length;
+		}
+		lua_pushlstring(L, bufferText, length);
+		return 1; // Number of results
+	}
+
+	// Otherwise the first param is pointer to text buffer,
+	// must not be nil and must be light user data.
 	if (!lua_isnoneornil(L, 1) && lua_islightuserdata(L, 1))
 	{
 		char* text = (char*) lua_touserdata(L, 1);
@@ -204,13 +380,42 @@ static int luaToString(lua_State *L)
 }
 
 /**
- * Create a new Lua engine instance.
+ * Load Lua code (source or bytecode) from a data handle.
+ * The data is read in blocks, it is not copied as a whole.
+ * Like loadstring, returns the compiled chunk as a function,
+ * or nil plus an error message.
+ */
+static int luaLoadHandle(lua_State *L)
+{
+	MAHandle handle = luaL_checkint(L, 1);
+	const char* chunkName = luaL_optstring(L, 2, "=SysLoadHandle");
+
+	HandleReader reader;
+	reader.handle = handle;
+	reader.offset = 0;
+	reader.size = maGetDataSize(handle);
+
+	if (0 != lua_load(L, readHandle, &reader, chunkName))
+	{
+		// Return nil plus the error message.
+		lua_pushnil(L);
+		lua_insert(L, -2);
+		return 2; // Number of results
+	}
+
+	return 1; // Number of results
+}
+
+/**
+ * Create a new Lua engine instance. The optional parameter
+ * is the memory budget of the engine in bytes.
  * Currently does no error checking (update
  * this comment if that is added).
  */
 static int luaEngineCreate(lua_State *L)
 {
 	LuaEngine* engine = new LuaEngine();
+	engine->setMemoryBudget(luaL_optint(L, 1, 0));
 	engine->initialize();
 	lua_pushlightuserdata(L, engine);
 
@@ -248,8 +453,16 @@ static int luaEngineEval(lua_State *L)
 		LuaEngine* engine = (LuaEngine*) lua_touserdata(L, 1);
 		if (NULL != engine)
 		{
-			const char* code = luaL_checkstring(L, 2);
-			int result = engine->eval(code);
+			// The code is either a string or a data handle.
+			int result;
+			if (lua_type(L, 2) == LUA_TNUMBER)
+			{
+				result = engine->eval((MAHandle) lua_tointeger(L, 2));
+			}
+			else
+			{
+				result = engine->eval(luaL_checkstring(L, 2));
+			}
 			if (0 != result)
 			{
 				// Return true to Lua.
@@ -264,14 +477,323 @@ static int luaEngineEval(lua_State *L)
 	return 1; // Number of results
 }
 
+/**
+ * Get the number of bytes allocated by a Lua engine.
+ * The engine parameter is optional, the default is
+ * the calling engine.
+ */
+static int luaEngineGetMemoryInUse(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL == engine)
+	{
+		return 0; // Number of results
+	}
+
+	lua_pushinteger(L, engine->getMemoryInUse());
+	return 1; // Number of results
+}
+
+/**
+ * Get the highest number of bytes allocated by a Lua engine.
+ * The engine parameter is optional, the default is the
+ * calling engine. Pass true as the second parameter to start
+ * a new measurement from the current usage.
+ */
+static int luaEngineGetMemoryPeak(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL == engine)
+	{
+		return 0; // Number of results
+	}
+
+	lua_pushinteger(L, engine->getMemoryPeak());
+	if (lua_toboolean(L, 2))
+	{
+		engine->resetMemoryPeak();
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Get per size class statistics of the allocator of a Lua engine.
+ * The engine parameter is optional, the default is the calling
+ * engine. Returns an array with one table per size class, with
+ * the fields size, hits, misses and inUse. The array is empty
+ * for allocators that do not pool blocks.
+ */
+static int luaEngineGetAllocatorStats(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL == engine)
+	{
+		return 0; // Number of results
+	}
+
+	LuaAllocator* allocator = engine->mAllocator;
+	int numberOfSizeClasses = allocator->getNumberOfSizeClasses();
+	lua_createtable(L, numberOfSizeClasses, 0);
+	for (int i = 0; i < numberOfSizeClasses; ++i)
+	{
+		LuaAllocatorStats stats;
+		allocator->getSizeClassStats(i, &stats);
+
+		lua_createtable(L, 0, 4);
+		lua_pushinteger(L, stats.blockSize);
+		lua_setfield(L, -2, "size");
+		lua_pushinteger(L, stats.hits);
+		lua_setfield(L, -2, "hits");
+		lua_pushinteger(L, stats.misses);
+		lua_setfield(L, -2, "misses");
+		lua_pushinteger(L, stats.blocksInUse);
+		lua_setfield(L, -2, "inUse");
+		lua_rawseti(L, -2, i + 1);
+	}
+
+	return 1; // Number of results
+}
+
+/**
+ * Set the memory budget of a Lua engine in bytes, zero for
+ * no limit. The engine parameter may be nil to use the calling
+ * engine.
+ */
+static int luaEngineSetMemoryBudget(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL != engine)
+	{
+		engine->setMemoryBudget(luaL_checkint(L, 2));
+	}
+
+	return 0; // Number of results
+}
+
+/**
+ * Get the number of allocations that went over the memory
+ * budget of a Lua engine. The engine parameter is optional,
+ * the default is the calling engine.
+ */
+static int luaEngineGetMemoryBudgetHits(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL == engine)
+	{
+		return 0; // Number of results
+	}
+
+	lua_pushinteger(L, engine->getMemoryBudgetHits());
+	return 1; // Number of results
+}
+
+/**
+ * Set the number of kilobytes a Lua engine collects each time
+ * its event loop is idle, zero to turn off idle collection.
+ * The engine parameter may be nil to use the calling engine.
+ */
+static int luaEngineSetIdleGCStep(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL != engine)
+	{
+		engine->setIdleGarbageCollectionStep(luaL_checkint(L, 2));
+	}
+
+	return 0; // Number of results
+}
+
+/**
+ * Tell the calling engine that the event loop is idle.
+ */
+static int luaEngineIdle(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	if (NULL != engine)
+	{
+		engine->onIdle();
+	}
+
+	return 0; // Number of results
+}
+
+/**
+ * Get the garbage collector pauses of a Lua engine. Returns
+ * the number of pauses, the total time and the longest pause
+ * in milliseconds. The engine parameter is optional, the
+ * default is the calling engine. If the second parameter is
+ * true, a new measurement is started.
+ */
+static int luaEngineGetGCPauses(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineParam(L, 1);
+	if (NULL == engine)
+	{
+		return 0; // Number of results
+	}
+
+	lua_pushinteger(L, engine->getGarbageCollectorPauseCount());
+	lua_pushinteger(L, engine->getGarbageCollectorPauseTime());
+	lua_pushinteger(L, engine->getGarbageCollectorPauseMax());
+
+	if (lua_toboolean(L, 2))
+	{
+		engine->resetGarbageCollectorPauses();
+	}
+
+	return 3; // Number of results
+}
+
+/**
+ * Set the handler function for an event type in the native
+ * event loop of the calling engine. Pass nil as the function
+ * to remove the handler.
+ */
+static int luaEventLoopSetHandler(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	int eventType = luaL_checkint(L, 1);
+
+	// Return explicitly on errors, MoSync has no longjmp.
+	if (eventType < 0 || LuaEngine::MAX_EVENT_HANDLERS <= eventType)
+	{
+		return luaL_argerror(L, 1, "invalid event type");
+	}
+
+	int ref = LUA_NOREF;
+	if (!lua_isnoneornil(L, 2))
+	{
+		if (!lua_isfunction(L, 2))
+		{
+			return luaL_typerror(L, 2, "function");
+		}
+		lua_pushvalue(L, 2);
+		ref = luaL_ref(L, LUA_REGISTRYINDEX);
+	}
+
+	engine->setEventHandler(eventType, ref);
+
+	return 0; // Number of results
+}
+
+/**
+ * Run the native event loop of the calling engine. Returns
+ * false and the error message if the loop was stopped by an
+ * error in a handler.
+ */
+static int luaEventLoopRun(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	int success = engine->runEventLoop(luaL_optint(L, 1, 0));
+	lua_pushboolean(L, success);
+	if (!success)
+	{
+		// Also return the error of the handler.
+		lua_pushstring(L, engine->mLastLuaErrorMessage.c_str());
+		return 2; // Number of results
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Turn coalescing of drag and sensor events on or off in
+ * the native event loop of the calling engine.
+ */
+static int luaEventLoopSetCoalescing(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	engine->setEventCoalescing(lua_toboolean(L, 1), lua_toboolean(L, 2));
+	return 0; // Number of results
+}
+
+/**
+ * Set the function that gets sensor events in batches in the
+ * native event loop of the calling engine. Parameters are the
+ * function (nil to stop batching), the number of samples per
+ * batch and the max age of a batch in milliseconds.
+ */
+static int luaEventLoopSetSensorBatchHandler(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	int samples = luaL_optint(L, 2, LuaEngine::MAX_SENSOR_BATCH);
+	int milliseconds = luaL_optint(L, 3, 0);
+
+	// Return explicitly on errors, MoSync has no longjmp.
+	if (samples <= 0 || LuaEngine::MAX_SENSOR_BATCH < samples)
+	{
+		return luaL_argerror(L, 2, "invalid number of samples");
+	}
+
+	int ref = LUA_NOREF;
+	if (!lua_isnoneornil(L, 1))
+	{
+		if (!lua_isfunction(L, 1))
+		{
+			return luaL_typerror(L, 1, "function");
+		}
+		lua_pushvalue(L, 1);
+		ref = luaL_ref(L, LUA_REGISTRYINDEX);
+	}
+
+	engine->setSensorBatchHandler(ref, samples, milliseconds);
+
+	return 0; // Number of results
+}
+
+/**
+ * Get the number of drag and sensor events that were
+ * dropped by coalescing in the calling engine.
+ */
+static int luaEventLoopGetMergedEvents(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	lua_pushinteger(L, engine->getMergedDragEvents());
+	lua_pushinteger(L, engine->getMergedSensorEvents());
+	return 2; // Number of results
+}
+
+/**
+ * Make the event loop of the calling engine exit.
+ */
+static int luaEventLoopExit(lua_State *L)
+{
+	LuaEngine* engine = getLuaEngineInstance(L);
+	engine->exitEventLoop();
+	return 0; // Number of results
+}
+
 static void registerNativeFunctions(lua_State* L)
 {
+	// Buffers, this also replaces the SysFree binding.
+	luaOpenBuffer(L);
+
+	// Fields of MoSync structs by name, event.x.
+	luaOpenStructs(L);
+
+	// String builders, for building long strings and messages.
+	luaOpenStringBuilder(L);
+
 	RegFun(L, "print", luaPrint);
 	RegFun(L, "log", luaLog);
 	RegFun(L, "SysBufferToString", luaToString);
 	RegFun(L, "SysLuaEngineCreate", luaEngineCreate);
 	RegFun(L, "SysLuaEngineDelete", luaEngineDelete);
 	RegFun(L, "SysLuaEngineEval", luaEngineEval);
+	RegFun(L, "SysLuaEngineGetMemoryInUse", luaEngineGetMemoryInUse);
+	RegFun(L, "SysLuaEngineGetMemoryPeak", luaEngineGetMemoryPeak);
+	RegFun(L, "SysLuaEngineGetAllocatorStats", luaEngineGetAllocatorStats);
+	RegFun(L, "SysLuaEngineSetMemoryBudget", luaEngineSetMemoryBudget);
+	RegFun(L, "SysLuaEngineGetMemoryBudgetHits", luaEngineGetMemoryBudgetHits);
+	RegFun(L, "SysLuaEngineSetIdleGCStep", luaEngineSetIdleGCStep);
+	RegFun(L, "SysLuaEngineIdle", luaEngineIdle);
+	RegFun(L, "SysLuaEngineGetGCPauses", luaEngineGetGCPauses);
+	RegFun(L, "SysLoadHandle", luaLoadHandle);
+	RegFun(L, "SysEventLoopSetHandler", luaEventLoopSetHandler);
+	RegFun(L, "SysEventLoopRun", luaEventLoopRun);
+	RegFun(L, "SysEventLoopExit", luaEventLoopExit);
+	RegFun(L, "SysEventLoopSetCoalescing", luaEventLoopSetCoalescing);
+	RegFun(L, "SysEventLoopGetMergedEvents", luaEventLoopGetMergedEvents);
+	RegFun(L, "SysEventLoopSetSensorBatchHandler", luaEventLoopSetSensorBatchHandler);
 }
 
 // ========== Constructor/Destructor ==========
@@ -281,8 +803,33 @@ static void registerNativeFunctions(lua_State* L)
  */
 LuaEngine::LuaEngine() :
 	mLuaState(NULL),
-	mLuaErrorListener(NULL)
+	mLuaErrorListener(NULL),
+	mAllocator(&mDefaultAllocator),
+	mMemoryInUse(0),
+	mMemoryPeak(0),
+	mMemoryBudget(0),
+	mMemoryBudgetHits(0),
+	mGCPause(LUAI_GCPAUSE),
+	mGCStepMultiplier(LUAI_GCMUL),
+	mIdleGCStep(0),
+	mLazyBindings(true),
+	mEventLoopRunning(false),
+	mCoalesceDragEvents(false),
+	mCoalesceSensorEvents(false),
+	mNumberOfCoalescedEvents(0),
+	mMergedDragEvents(0),
+	mMergedSensorEvents(0),
+	mSensorBatchHandler(LUA_NOREF),
+	mSensorBatchTable(LUA_NOREF),
+	mSensorBatchSize(0),
+	mSensorBatchTime(0),
+	mSensorBatchStart(0),
+	mNumberOfSensorSamples(0)
 {
+	for (int i = 0; i < MAX_EVENT_HANDLERS; ++i)
+	{
+		mEventHandlers[i] = LUA_NOREF;
+	}
 }
 
 /**
@@ -342,29 +889,43 @@ LuaEngine::~LuaEngine()
 
 /**
  * Initialize the Lua engine.
+ * @param allocator Allocator used for all memory of the engine,
+ * NULL to use realloc and free. The allocator is not deleted
+ * by the engine and must outlive it.
  * @return Non-zero if successful, zero on error.
  */
-int LuaEngine::initialize()
+int LuaEngine::initialize(LuaAllocator* allocator)
 {
 	lua_State* L = (lua_State*) mLuaState;
 
 	// Deallocate previous Lua state, if it exists.
 	if (L)
 	{
-		lua_close(L);
-		mLuaState = NULL;
+		shutdown();
 	}
 
 	// Create Lua state.
-	L = lua_open();
+	mAllocator = (NULL != allocator) ? allocator : &mDefaultAllocator;
+	mMemoryInUse = 0;
+	mMemoryPeak = 0;
+	L = lua_newstate(allocate, this);
 	mLuaState = L;
 	if (!L)
 	{
 		return 0;
 	}
 
+	lua_atpanic(L, panic);
+
+	// Apply the memory budget and collector settings
+	// to the new state.
+	setMemoryBudget(mMemoryBudget);
+	setGarbageCollectorPause(mGCPause);
+	setGarbageCollectorStepMultiplier(mGCStepMultiplier);
+
 	luaL_openlibs(L);
 
+	tolua_setlazybindings(L, mLazyBindings);
 	tolua_lua_maapi_open(L);
 
 	registerNativeFunctions(L);
@@ -376,6 +937,15 @@ int LuaEngine::initialize()
 	return 1;
 }
 
+/**
+ * Turn lazy binding of the MoSync API on or off.
+ * @param lazy true for lazy binding.
+ */
+void LuaEngine::setLazyBindings(bool lazy)
+{
+	mLazyBindings = lazy;
+}
+
 /**
  * Shutdown the Lua engine.
  */
@@ -389,6 +959,17 @@ void LuaEngine::shutdown()
 		mLuaState = NULL;
 	}
 
+	// The handler references died with the state.
+	for (int i = 0; i < MAX_EVENT_HANDLERS; ++i)
+	{
+		mEventHandlers[i] = LUA_NOREF;
+	}
+	mEventLoopRunning = false;
+	mNumberOfCoalescedEvents = 0;
+	mSensorBatchHandler = LUA_NOREF;
+	mSensorBatchTable = LUA_NOREF;
+	mNumberOfSensorSamples = 0;
+
 	// TODO: Free function closures.
 	// We can skip this as we close the entire interpreter, but
 	// remember to free old functions when new ones are set.
@@ -403,58 +984,680 @@ int LuaEngine::eval(const char* script)
 {
 	lua_State* L = (lua_State*) mLuaState;
 
-	// Evaluate Lua script.
-	int result = luaL_dostring(L, script);
-
-	// Was there an error?
-	if (0 != result)
-	{
-		MAUtil::String errorMessage;
-
-    	if (lua_isstring(L, -1))
-    	{
-    		errorMessage = lua_tostring(L, -1);
-
-            // Pop the error message.
-        	lua_pop(L, 1);
-    	}
-    	else
-    	{
-    		errorMessage =
-    			"There was a Lua error condition, but no error message.";
-    	}
-
-        lprintfln("Lua Error: %s\n", errorMessage.c_str());
-
-    	// Print size of Lua stack (debug info).
-    	lprintfln("Lua stack size: %i\n", lua_gettop(L));
-
-    	reportLuaError(errorMessage.c_str());
-	}
-
-	return result == 0;
+	return evalLoadedChunk(luaL_loadstring(L, script));
 }
 
 /**
  * Helper method that evaluates a Lua script contained in
- * a resource handle.
+ * a resource handle. The script can be either Lua source
+ * code or bytecode precompiled with luac.
  * @param scriptResourceId Handle to data object with Lua code,
  * typically a resource id.
  * @return Non-zero if successful, zero on error.
  */
 int LuaEngine::eval(MAHandle handle)
 {
-	char* script = SysLoadStringResource(handle);
-	if (script)
-	{
-		int result = eval(script);
-		free(script);
-		return result;
-	}
-	else
+	lua_State* L = (lua_State*) mLuaState;
+
+	HandleReader reader;
+	reader.handle = handle;
+	reader.offset = 0;
+	reader.size = maGetDataSize(handle);
+
+	char chunkName[32];
+	sprintf(chunkName, "=resource %i", handle);
+
+	return evalLoadedChunk(lua_load(L, readHandle, &reader, chunkName));
+}
+
+/**
+ * Evaluate a Lua script stored in a file. The script can be
+ * either Lua source code or bytecode precompiled with luac.
+ * @param path Full path of the file.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::evalFile(const char* path)
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	MAHandle file = maFileOpen(path, MA_ACCESS_READ);
+	if (file < 0)
+	{
+		return 0;
+	}
+
+	FileReader reader;
+	reader.file = file;
+	reader.remaining = maFileSize(file);
+	if (reader.remaining < 0)
+	{
+		maFileClose(file);
+		return 0;
+	}
+
+	MAUtil::String chunkName = "@";
+	chunkName += path;
+
+	int status = lua_load(L, readFile, &reader, chunkName.c_str());
+	maFileClose(file);
+
+	return evalLoadedChunk(status);
+}
+
+/**
+ * Run the chunk that was pushed onto the stack by a load
+ * function, and report any error (for private use, really).
+ * @param status The result of the load, zero if successful.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::evalLoadedChunk(int status)
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	// Run the chunk if it was loaded.
+	if (0 == status)
+	{
+		status = lua_pcall(L, 0, LUA_MULTRET, 0);
+	}
+
+	// Was there an error?
+	if (0 != status)
+	{
+		reportLuaErrorOnStack();
+	}
+
+	return status == 0;
+}
+
+/**
+ * Pop the error message on top of the Lua stack and
+ * report it (for private use, really).
+ */
+void LuaEngine::reportLuaErrorOnStack()
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	MAUtil::String errorMessage;
+
+	if (lua_isstring(L, -1))
+	{
+		errorMessage = lua_tostring(L, -1);
+
+		// Pop the error message.
+		lua_pop(L, 1);
+	}
+	else
+	{
+		errorMessage =
+			"There was a Lua error condition, but no error message.";
+	}
+
+	mLastLuaErrorMessage = errorMessage;
+
+	lprintfln("Lua Error: %s\n", errorMessage.c_str());
+
+	// Print size of Lua stack (debug info).
+	lprintfln("Lua stack size: %i\n", lua_gettop(L));
+
+	reportLuaError(errorMessage.c_str());
+}
+
+/**
+ * Get the number of bytes currently allocated by Lua.
+ */
+int LuaEngine::getMemoryInUse()
+{
+	return mMemoryInUse;
+}
+
+/**
+ * Get the highest number of bytes allocated by Lua since
+ * the engine was initialized or resetMemoryPeak was called.
+ */
+int LuaEngine::getMemoryPeak()
+{
+	return mMemoryPeak;
+}
+
+/**
+ * Start a new high-water mark measurement from the
+ * current memory usage.
+ */
+void LuaEngine::resetMemoryPeak()
+{
+	mMemoryPeak = mMemoryInUse;
+}
+
+/**
+ * Set the maximum number of bytes Lua may allocate.
+ * When the usage gets close to the budget, the garbage
+ * collector does a full collection. If the usage is still over
+ * the budget after a full collection, the running script fails
+ * with a memory error, see allocate().
+ * @param budget The budget in bytes, zero for no limit.
+ */
+void LuaEngine::setMemoryBudget(int budget)
+{
+	mMemoryBudget = budget;
+
+	// The collector does a full collection when the usage
+	// passes 7/8 of the budget. The rest is headroom for the
+	// allocations made between two collector checks.
+	lua_State* L = (lua_State*) mLuaState;
+	if (L)
+	{
+		lua_gc(L, LUA_GCSETLIMIT, budget - budget / 8);
+		lua_gc(L, LUA_GCSETBUDGET, budget);
+	}
+}
+
+/**
+ * Get the memory budget in bytes, zero if there is no limit.
+ */
+int LuaEngine::getMemoryBudget()
+{
+	return mMemoryBudget;
+}
+
+/**
+ * Get the number of allocations that went over the memory
+ * budget.
+ */
+int LuaEngine::getMemoryBudgetHits()
+{
+	return mMemoryBudgetHits;
+}
+
+/**
+ * Set the pause of the garbage collector in percent.
+ * @param percent The pause in percent.
+ */
+void LuaEngine::setGarbageCollectorPause(int percent)
+{
+	mGCPause = percent;
+
+	lua_State* L = (lua_State*) mLuaState;
+	if (L)
+	{
+		lua_gc(L, LUA_GCSETPAUSE, percent);
+	}
+}
+
+/**
+ * Set the step multiplier of the garbage collector in percent.
+ * @param percent The step multiplier in percent.
+ */
+void LuaEngine::setGarbageCollectorStepMultiplier(int percent)
+{
+	mGCStepMultiplier = percent;
+
+	lua_State* L = (lua_State*) mLuaState;
+	if (L)
+	{
+		lua_gc(L, LUA_GCSETSTEPMUL, percent);
+	}
+}
+
+/**
+ * Set the amount of garbage collection done each time the
+ * event loop runs out of pending events.
+ * @param kbytes The step size in kilobytes, zero to
+ * turn off idle collection.
+ */
+void LuaEngine::setIdleGarbageCollectionStep(int kbytes)
+{
+	mIdleGCStep = kbytes;
+}
+
+/**
+ * Get the idle step size in kilobytes, zero if idle
+ * collection is turned off.
+ */
+int LuaEngine::getIdleGarbageCollectionStep()
+{
+	return mIdleGCStep;
+}
+
+/**
+ * Called by the event loop when there are no pending events.
+ * Runs a garbage collection step if idle collection is on.
+ */
+void LuaEngine::onIdle()
+{
+	lua_State* L = (lua_State*) mLuaState;
+	if (L && mIdleGCStep > 0)
+	{
+		lua_gc(L, LUA_GCSTEP, mIdleGCStep);
+	}
+}
+
+/**
+ * Get the number of garbage collector pauses since the
+ * engine was initialized or the statistics were reset.
+ */
+int LuaEngine::getGarbageCollectorPauseCount()
+{
+	lua_State* L = (lua_State*) mLuaState;
+	return L ? lua_gc(L, LUA_GCPAUSECOUNT, 0) : 0;
+}
+
+/**
+ * Get the total time in milliseconds spent in garbage
+ * collector pauses.
+ */
+int LuaEngine::getGarbageCollectorPauseTime()
+{
+	lua_State* L = (lua_State*) mLuaState;
+	return L ? lua_gc(L, LUA_GCPAUSETIME, 0) : 0;
+}
+
+/**
+ * Get the longest garbage collector pause in milliseconds.
+ */
+int LuaEngine::getGarbageCollectorPauseMax()
+{
+	lua_State* L = (lua_State*) mLuaState;
+	return L ? lua_gc(L, LUA_GCPAUSEMAX, 0) : 0;
+}
+
+/**
+ * Start a new measurement of garbage collector pauses.
+ */
+void LuaEngine::resetGarbageCollectorPauses()
+{
+	lua_State* L = (lua_State*) mLuaState;
+	if (L)
+	{
+		lua_gc(L, LUA_GCPAUSEMAX, 1);
+	}
+}
+
+/**
+ * Set the Lua function called for events of a given type
+ * (for private use, really).
+ * @param eventType The event type, or EVENT_HANDLER_ANY
+ * for a function that gets all events.
+ * @param functionRef Registry reference to the function,
+ * or LUA_NOREF to remove the handler.
+ */
+void LuaEngine::setEventHandler(int eventType, int functionRef)
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	// Release the previous handler.
+	luaL_unref(L, LUA_REGISTRYINDEX, mEventHandlers[eventType]);
+
+	mEventHandlers[eventType] = functionRef;
+}
+
+/**
+ * Run the event loop.
+ * @param waitTime The time to wait in maWait.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::runEventLoop(int waitTime)
+{
+	MAEvent event;
+
+	mEventLoopRunning = true;
+	mNumberOfCoalescedEvents = 0;
+
+	while (mEventLoopRunning)
+	{
+		// Do not wait longer than the time limit of
+		// the sensor batch.
+		int wait = waitTime;
+		if (0 < mNumberOfSensorSamples && 0 < mSensorBatchTime)
+		{
+			int batchWait = mSensorBatchStart + mSensorBatchTime
+				- maGetMilliSecondCount();
+			if (batchWait < 1)
+			{
+				batchWait = 1;
+			}
+			if (wait <= 0 || batchWait < wait)
+			{
+				wait = batchWait;
+			}
+		}
+
+		maWait(wait);
+		while (mEventLoopRunning && maGetEvent(&event))
+		{
+			if (!postEvent(event))
+			{
+				mEventLoopRunning = false;
+				return 0;
+			}
+		}
+
+		// There are no more pending events, deliver the
+		// merged ones.
+		if (mEventLoopRunning && !flushEvents())
+		{
+			mEventLoopRunning = false;
+			return 0;
+		}
+
+		// Let the garbage collector do some work while
+		// the application is idle.
+		if (mEventLoopRunning)
+		{
+			onIdle();
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * Make the event loop exit after the current event.
+ */
+void LuaEngine::exitEventLoop()
+{
+	mEventLoopRunning = false;
+}
+
+/**
+ * Turn event coalescing on or off.
+ * @param dragEvents true to merge EVENT_TYPE_POINTER_DRAGGED.
+ * @param sensorEvents true to merge EVENT_TYPE_SENSOR.
+ */
+void LuaEngine::setEventCoalescing(bool dragEvents, bool sensorEvents)
+{
+	mCoalesceDragEvents = dragEvents;
+	mCoalesceSensorEvents = sensorEvents;
+}
+
+/**
+ * Get the number of drag events dropped by coalescing.
+ */
+int LuaEngine::getMergedDragEvents()
+{
+	return mMergedDragEvents;
+}
+
+/**
+ * Get the number of sensor events dropped by coalescing.
+ */
+int LuaEngine::getMergedSensorEvents()
+{
+	return mMergedSensorEvents;
+}
+
+/**
+ * Set a Lua function that gets sensor events in batches.
+ * @param functionRef Registry reference to the function,
+ * or LUA_NOREF to stop batching.
+ * @param samples Deliver a batch when it has this many samples.
+ * @param milliseconds Deliver a batch when its first sample
+ * is this old, zero for no time limit.
+ */
+void LuaEngine::setSensorBatchHandler(
+	int functionRef,
+	int samples,
+	int milliseconds)
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	// Release the previous handler. Samples collected for it
+	// are dropped.
+	luaL_unref(L, LUA_REGISTRYINDEX, mSensorBatchHandler);
+	mNumberOfSensorSamples = 0;
+
+	mSensorBatchHandler = functionRef;
+	mSensorBatchSize = samples < MAX_SENSOR_BATCH ? samples : MAX_SENSOR_BATCH;
+	mSensorBatchTime = milliseconds;
+}
+
+/**
+ * Pass the collected sensor samples to the batch handler
+ * as a table with four numbers per sample: the sensor type
+ * and three values. The same table is used for every batch,
+ * entries after the last sample are left from earlier batches.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::deliverSensorBatch()
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	int count = mNumberOfSensorSamples;
+	mNumberOfSensorSamples = 0;
+	if (0 == count || LUA_NOREF == mSensorBatchHandler)
+	{
+		return 1;
+	}
+
+	// The table is created once and reused for all batches.
+	lua_rawgeti(L, LUA_REGISTRYINDEX, mSensorBatchHandler);
+	lua_rawgeti(L, LUA_REGISTRYINDEX, mSensorBatchTable);
+	if (!lua_istable(L, -1))
+	{
+		lua_pop(L, 1);
+		lua_createtable(L, MAX_SENSOR_BATCH * 4, 0);
+		lua_pushvalue(L, -1);
+		mSensorBatchTable = luaL_ref(L, LUA_REGISTRYINDEX);
+	}
+	int index = 1;
+	for (int i = 0; i < count; ++i)
+	{
+		MASensor& sample = mSensorSamples[i];
+		lua_pushinteger(L, sample.type);
+		lua_rawseti(L, -2, index++);
+		lua_pushnumber(L, sample.values[0]);
+		lua_rawseti(L, -2, index++);
+		lua_pushnumber(L, sample.values[1]);
+		lua_rawseti(L, -2, index++);
+		lua_pushnumber(L, sample.values[2]);
+		lua_rawseti(L, -2, index++);
+	}
+	lua_pushinteger(L, count);
+
+	return callEventHandler(2);
+}
+
+/**
+ * Pass an event on to Lua, or hold it back to be merged with
+ * later events if coalescing is on.
+ * @param event The event.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::postEvent(const MAEvent& event)
+{
+	// Collect sensor samples if there is a batch handler.
+	if (EVENT_TYPE_SENSOR == event.type
+		&& LUA_NOREF != mSensorBatchHandler)
+	{
+		if (0 == mNumberOfSensorSamples)
+		{
+			mSensorBatchStart = maGetMilliSecondCount();
+		}
+		mSensorSamples[mNumberOfSensorSamples++] = event.sensor;
+		if (mNumberOfSensorSamples >= mSensorBatchSize)
+		{
+			return deliverSensorBatch();
+		}
+		return 1;
+	}
+
+	bool isDrag = mCoalesceDragEvents
+		&& EVENT_TYPE_POINTER_DRAGGED == event.type;
+	bool isSensor = mCoalesceSensorEvents
+		&& EVENT_TYPE_SENSOR == event.type;
+
+	// Events that are not merged are delivered in order.
+	if (!isDrag && !isSensor)
+	{
+		return flushEvents() && dispatchEvent(event);
+	}
+
+	// Replace an earlier event from the same touch or sensor.
+	for (int i = 0; i < mNumberOfCoalescedEvents; ++i)
+	{
+		MAEvent& held = mCoalescedEvents[i];
+		if (isDrag
+			&& EVENT_TYPE_POINTER_DRAGGED == held.type
+			&& event.touchId == held.touchId)
+		{
+			held = event;
+			mMergedDragEvents++;
+			return 1;
+		}
+		if (isSensor
+			&& EVENT_TYPE_SENSOR == held.type
+			&& event.sensor.type == held.sensor.type)
+		{
+			held = event;
+			mMergedSensorEvents++;
+			return 1;
+		}
+	}
+
+	// Hold back the event, make room first if needed.
+	if (MAX_COALESCED_EVENTS == mNumberOfCoalescedEvents
+		&& !flushEvents())
 	{
 		return 0;
 	}
+	mCoalescedEvents[mNumberOfCoalescedEvents++] = event;
+
+	return 1;
+}
+
+/**
+ * Pass the events held back for coalescing on to Lua, and
+ * the sensor batch if it is old enough.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::flushEvents()
+{
+	for (int i = 0; i < mNumberOfCoalescedEvents; ++i)
+	{
+		if (!dispatchEvent(mCoalescedEvents[i]))
+		{
+			mNumberOfCoalescedEvents = 0;
+			return 0;
+		}
+	}
+	mNumberOfCoalescedEvents = 0;
+
+	// Deliver the sensor batch when it gets too old.
+	if (0 < mNumberOfSensorSamples
+		&& 0 < mSensorBatchTime
+		&& maGetMilliSecondCount() - mSensorBatchStart >= mSensorBatchTime)
+	{
+		return deliverSensorBatch();
+	}
+
+	return 1;
+}
+
+/**
+ * Pass an event to its Lua handlers.
+ * @param event The event.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::dispatchEvent(const MAEvent& event)
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	if (EVENT_TYPE_CLOSE == event.type)
+	{
+		mEventLoopRunning = false;
+		return 1;
+	}
+
+	// Call the handler for the event type with the
+	// event fields it needs.
+	if (0 < event.type
+		&& event.type < MAX_EVENT_HANDLERS
+		&& LUA_NOREF != mEventHandlers[event.type])
+	{
+		lua_rawgeti(L, LUA_REGISTRYINDEX, mEventHandlers[event.type]);
+
+		int numberOfArgs;
+		switch (event.type)
+		{
+			case EVENT_TYPE_KEY_PRESSED:
+			case EVENT_TYPE_KEY_RELEASED:
+				lua_pushinteger(L, event.key);
+				numberOfArgs = 1;
+				break;
+
+			case EVENT_TYPE_POINTER_PRESSED:
+			case EVENT_TYPE_POINTER_RELEASED:
+			case EVENT_TYPE_POINTER_DRAGGED:
+				lua_pushinteger(L, event.point.x);
+				lua_pushinteger(L, event.point.y);
+				lua_pushinteger(L, event.touchId);
+				numberOfArgs = 3;
+				break;
+
+			case EVENT_TYPE_CONN:
+				lua_pushinteger(L, event.conn.handle);
+				lua_pushinteger(L, event.conn.opType);
+				lua_pushinteger(L, event.conn.result);
+				numberOfArgs = 3;
+				break;
+
+			case EVENT_TYPE_SENSOR:
+				lua_pushinteger(L, event.sensor.type);
+				lua_pushnumber(L, event.sensor.values[0]);
+				lua_pushnumber(L, event.sensor.values[1]);
+				lua_pushnumber(L, event.sensor.values[2]);
+				numberOfArgs = 4;
+				break;
+
+			case EVENT_TYPE_WIDGET:
+				lua_pushlightuserdata(L, event.data);
+				numberOfArgs = 1;
+				break;
+
+			default:
+				// Other events get the event object, use the
+				// SysEventGet functions to read it.
+				lua_pushlightuserdata(L, (void*) &event);
+				numberOfArgs = 1;
+				break;
+		}
+
+		if (!callEventHandler(numberOfArgs))
+		{
+			return 0;
+		}
+	}
+
+	// Always pass the event to the any handler.
+	if (LUA_NOREF != mEventHandlers[EVENT_HANDLER_ANY])
+	{
+		lua_rawgeti(L, LUA_REGISTRYINDEX, mEventHandlers[EVENT_HANDLER_ANY]);
+		lua_pushlightuserdata(L, (void*) &event);
+		if (!callEventHandler(1))
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * Call a Lua event handler and report any error.
+ * @param numberOfArgs Number of arguments on the stack
+ * after the handler.
+ * @return Non-zero if successful, zero on error.
+ */
+int LuaEngine::callEventHandler(int numberOfArgs)
+{
+	lua_State* L = (lua_State*) mLuaState;
+
+	if (0 != lua_pcall(L, numberOfArgs, 0, 0))
+	{
+		reportLuaErrorOnStack();
+		return 0;
+	}
+
+	return 1;
 }
 
 /**
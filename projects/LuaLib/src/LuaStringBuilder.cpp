@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+extern "C"
+{
+#include "lua.h"
+#include "lauxlib.h"
+}
+
+#include <mastring.h>
+#include <mavsprintf.h>
+
+#include "inc/LuaStringBuilder.h"
+
+namespace MobileLua
+{
+
+/**
+ * Registry key of the metatable.
+ */
+#define STRING_BUILDER_TYPE "MobileLua.StringBuilder"
+
+/**
+ * The metatable is an upvalue of the string builder functions,
+ * which makes type checks cheap.
+ */
+#define STRING_BUILDER_METATABLE lua_upvalueindex(1)
+
+/**
+ * Capacity of a new string builder, unless given.
+ */
+#define STRING_BUILDER_DEFAULT_CAPACITY 64
+
+/**
+ * A string builder. The bytes are allocated with the allocator
+ * of the Lua state, so they count towards its memory use. The
+ * pointer to the bytes comes first, for the bindings.
+ */
+struct StringBuilder
+{
+	char* data;
+	int size;
+	int capacity;
+};
+
+/**
+ * Get the string builder at the first argument. On error,
+ * NULL is returned and callers must return, since MoSync
+ * has no longjmp.
+ */
+static StringBuilder* checkStringBuilder(lua_State* L)
+{
+	StringBuilder* builder = NULL;
+	if (lua_getmetatable(L, 1))
+	{
+		if (lua_rawequal(L, -1, STRING_BUILDER_METATABLE))
+		{
+			builder = (StringBuilder*) lua_touserdata(L, 1);
+		}
+		lua_pop(L, 1);
+	}
+	if (NULL == builder)
+	{
+		luaL_typerror(L, 1, "StringBuilder");
+	}
+	return builder;
+}
+
+/**
+ * Resize the bytes of a string builder.
+ * @return Non-zero if successful, zero if out of memory.
+ */
+static int resizeStringBuilder(
+	lua_State* L,
+	StringBuilder* builder,
+	int capacity)
+{
+	void* ud;
+	lua_Alloc alloc = lua_getallocf(L, &ud);
+	char* data = (char*) alloc(ud, builder->data, builder->capacity, capacity);
+	if (NULL == data && capacity > 0)
+	{
+		return 0;
+	}
+	builder->data = data;
+	builder->capacity = capacity;
+	return 1;
+}
+
+/**
+ * Make room for count more bytes. The capacity is doubled until
+ * the bytes fit, which makes appending amortized O(1) per byte.
+ * On error, NULL is returned and callers must return.
+ * @return Pointer to where the bytes go.
+ */
+static char* reserveBytes(lua_State* L, StringBuilder* builder, int count)
+{
+	if (builder->capacity - builder->size < count)
+	{
+		int capacity = builder->capacity;
+		while (capacity - builder->size < count)
+		{
+			capacity *= 2;
+		}
+		if (!resizeStringBuilder(L, builder, capacity))
+		{
+			luaL_error(L, "not enough memory for StringBuilder");
+			return NULL;
+		}
+	}
+	return builder->data + builder->size;
+}
+
+/**
+ * Append strings and numbers. Numbers are written like
+ * tostring writes them.
+ * sb:append(value, ...), returns the builder.
+ */
+static int luaStringBuilderAppend(lua_State* L)
+{
+	StringBuilder* builder = checkStringBuilder(L);
+	if (NULL == builder)
+	{
+		return 0;
+	}
+
+	int top = lua_gettop(L);
+	for (int i = 2; i <= top; ++i)
+	{
+		const char* s;
+		size_t length;
+		char number[LUAI_MAXNUMBER2STR];
+		if (LUA_TSTRING == lua_type(L, i))
+		{
+			s = lua_tolstring(L, i, &length);
+		}
+		else if (LUA_TNUMBER == lua_type(L, i))
+		{
+			lua_number2str(number, lua_tonumber(L, i));
+			s = number;
+			length = strlen(number);
+		}
+		else
+		{
+			return luaL_typerror(L, i, "string or number");
+		}
+
+		char* dst = reserveBytes(L, builder, (int) length);
+		if (NULL == dst)
+		{
+			return 0;
+		}
+		memcpy(dst, s, length);
+		builder->size += (int) length;
+	}
+
+	lua_settop(L, 1);
+	return 1; // Number of results
+}
+
+/**
+ * Append bytes given as numbers.
+ * sb:appendByte(byte, ...), returns the builder.
+ */
+static int luaStringBuilderAppendByte(lua_State* L)
+{
+	StringBuilder* builder = checkStringBuilder(L);
+	if (NULL == builder)
+	{
+		return 0;
+	}
+
+	// Check all bytes before writing any, so that a bad
+	// argument leaves the builder as it was.
+	int top = lua_gettop(L);
+	for (int i = 2; i <= top; ++i)
+	{
+		if (!lua_isnumber(L, i))
+		{
+			return luaL_typerror(L, i, "number");
+		}
+	}
+
+	char* dst = reserveBytes(L, builder, top - 1);
+	if (NULL == dst)
+	{
+		return 0;
+	}
+	for (int i = 2; i <= top; ++i)
+	{
+		*dst++ = (char) lua_tointeger(L, i);
+	}
+	builder->size += top - 1;
+
+	lua_settop(L, 1);
+	return 1; // Number of results
+}
+
+/**
+ * Make a Lua string of the bytes, this is the only copy.
+ * sb:toString(), also tostring(sb).
+ */
+static int luaStringBuilderToString(lua_State* L)
+{
+	StringBuilder* builder = checkStringBuilder(L);
+	if (NULL == builder)
+	{
+		return 0;
+	}
+	lua_pushlstring(L, builder->data, builder->size);
+	return 1; // Number of results
+}
+
+/**
+ * Get the number of bytes.
+ * sb:size(), also #sb.
+ */
+static int luaStringBuilderSize(lua_State* L)
+{
+	StringBuilder* builder = checkStringBuilder(L);
+	if (NULL == builder)
+	{
+		return 0;
+	}
+	lua_pushinteger(L, builder->size);
+	return 1; // Number of results
+}
+
+/**
+ * Remove all bytes, the capacity is kept for reuse.
+ * sb:clear(), returns the builder.
+ */
+static int luaStringBuilderClear(lua_State* L)
+{
+	StringBuilder* builder = checkStringBuilder(L);
+	if (NULL == builder)
+	{
+		return 0;
+	}
+	builder->size = 0;
+	lua_settop(L, 1);
+	return 1; // Number of results
+}
+
+/**
+ * Free the bytes when the builder is collected.
+ */
+static int luaStringBuilderGC(lua_State* L)
+{
+	StringBuilder* builder = (StringBuilder*) lua_touserdata(L, 1);
+	resizeStringBuilder(L, builder, 0);
+	return 0; // Number of results
+}
+
+/**
+ * Create a string builder.
+ * SysStringBuilderCreate(capacity), the capacity in bytes
+ * is optional.
+ */
+static int luaStringBuilderCreate(lua_State* L)
+{
+	int capacity = luaL_optint(L, 1, STRING_BUILDER_DEFAULT_CAPACITY);
+	if (capacity < 1)
+	{
+		capacity = 1;
+	}
+
+	StringBuilder* builder =
+		(StringBuilder*) lua_newuserdata(L, sizeof(StringBuilder));
+	builder->data = NULL;
+	builder->size = 0;
+	builder->capacity = 0;
+	lua_pushvalue(L, STRING_BUILDER_METATABLE);
+	lua_setmetatable(L, -2);
+
+	if (!resizeStringBuilder(L, builder, capacity))
+	{
+		return luaL_error(L, "not enough memory for StringBuilder");
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Methods of string builders.
+ */
+static const luaL_Reg sStringBuilderMethods[] =
+{
+	{ "append", luaStringBuilderAppend },
+	{ "appendByte", luaStringBuilderAppendByte },
+	{ "toString", luaStringBuilderToString },
+	{ "size", luaStringBuilderSize },
+	{ "clear", luaStringBuilderClear },
+	{ NULL, NULL }
+};
+
+/**
+ * Metamethods of string builders.
+ */
+static const luaL_Reg sStringBuilderMetamethods[] =
+{
+	{ "__len", luaStringBuilderSize },
+	{ "__tostring", luaStringBuilderToString },
+	{ "__gc", luaStringBuilderGC },
+	{ NULL, NULL }
+};
+
+/**
+ * Set the functions in a list as fields of the table on top
+ * of the stack, with the metatable as upvalue.
+ */
+static void setStringBuilderFunctions(
+	lua_State* L,
+	const luaL_Reg* functions)
+{
+	for (; NULL != functions->name; ++functions)
+	{
+		luaL_getmetatable(L, STRING_BUILDER_TYPE);
+		lua_pushcclosure(L, functions->func, 1);
+		lua_setfield(L, -2, functions->name);
+	}
+}
+
+void luaOpenStringBuilder(lua_State* L)
+{
+	luaL_newmetatable(L, STRING_BUILDER_TYPE);
+	setStringBuilderFunctions(L, sStringBuilderMetamethods);
+	lua_newtable(L);
+	setStringBuilderFunctions(L, sStringBuilderMethods);
+	lua_setfield(L, -2, "__index");
+
+	// The bindings pass the bytes to MoSync functions.
+	lua_pushboolean(L, 1);
+	lua_setfield(L, -2, "__pointer");
+	lua_pop(L, 1);
+
+	luaL_getmetatable(L, STRING_BUILDER_TYPE);
+	lua_pushcclosure(L, luaStringBuilderCreate, 1);
+	lua_setglobal(L, "SysStringBuilderCreate");
+}
+
+void* luaToStringBuilder(lua_State* L, int index, int* size)
+{
+	StringBuilder* builder = NULL;
+
+	if (lua_getmetatable(L, index))
+	{
+		luaL_getmetatable(L, STRING_BUILDER_TYPE);
+		if (lua_rawequal(L, -1, -2))
+		{
+			builder = (StringBuilder*) lua_touserdata(L, index);
+			*size = builder->size;
+		}
+		lua_pop(L, 2);
+	}
+
+	return (NULL == builder) ? NULL : builder->data;
+}
+
+}
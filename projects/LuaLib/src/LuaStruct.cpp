@@ -0,0 +1,675 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+extern "C"
+{
+#include "lua.h"
+#include "lauxlib.h"
+#include "inc/SystemAPI.h"
+}
+
+#include <mastring.h>
+#include <IX_WIDGET.h>
+
+#include "inc/LuaAllocator.h"
+#include "inc/LuaStruct.h"
+
+namespace MobileLua
+{
+
+/**
+ * Registry key of the table of struct types, by name. A struct
+ * type is a table with the layout and the metatables, and for
+ * pooled types the pool.
+ */
+#define STRUCTS_KEY "MobileLua.Structs"
+#define STRUCT_LAYOUT 1
+#define STRUCT_METATABLE 2
+#define STRUCT_VIEW_METATABLE 3
+#define STRUCT_POOLED_METATABLE 4
+#define STRUCT_POOL 5
+
+/**
+ * Size of the pages that struct pools grow with.
+ */
+#define STRUCT_POOL_PAGE_SIZE 1024
+
+/**
+ * Size of the blocks of a struct pool, rounded up so that
+ * blocks are aligned for doubles.
+ */
+#define STRUCT_POOL_BLOCK_SIZE(size) \
+	((int) (((size) + sizeof(double) - 1) & ~(sizeof(double) - 1)))
+
+/**
+ * A view of a struct that Lua does not own.
+ */
+struct StructView
+{
+	void* data;
+};
+
+/**
+ * A free list of blocks for the structs of one type. The pool
+ * grows a page at a time, and the pages are kept for the life
+ * of the program, so the pools are shared by all Lua states.
+ */
+struct StructPool
+{
+	const char* name;
+	void* freeList;
+	LuaAllocatorStats stats;
+};
+
+/**
+ * A struct in a block of a pool. The data comes first, so the
+ * fields are read like the fields of a view.
+ */
+struct PooledStruct
+{
+	void* data;
+	StructPool* pool;
+};
+
+/**
+ * Pools of the struct types that Lua code creates often,
+ * such as a rect per draw call.
+ */
+static StructPool sStructPools[] =
+{
+	{ "MAEvent", NULL, { STRUCT_POOL_BLOCK_SIZE(sizeof(MAEvent)), 0, 0, 0 } },
+	{ "MAPoint2d", NULL, { STRUCT_POOL_BLOCK_SIZE(sizeof(MAPoint2d)), 0, 0, 0 } },
+	{ "MARect", NULL, { STRUCT_POOL_BLOCK_SIZE(sizeof(MARect)), 0, 0, 0 } },
+	{ "MACopyData", NULL, { STRUCT_POOL_BLOCK_SIZE(sizeof(MACopyData)), 0, 0, 0 } },
+	{ NULL, NULL, { 0, 0, 0, 0 } }
+};
+
+/**
+ * Take a zero filled block from a pool.
+ * @return The block, NULL if out of memory.
+ */
+static void* allocatePoolBlock(StructPool* pool)
+{
+	int blockSize = pool->stats.blockSize;
+	if (NULL == pool->freeList)
+	{
+		pool->stats.misses++;
+
+		char* page = (char*) malloc(STRUCT_POOL_PAGE_SIZE);
+		if (NULL == page)
+		{
+			return NULL;
+		}
+		char* end = page + STRUCT_POOL_PAGE_SIZE - blockSize;
+		for (char* block = page; block <= end; block += blockSize)
+		{
+			*(void**) block = pool->freeList;
+			pool->freeList = block;
+		}
+	}
+	else
+	{
+		pool->stats.hits++;
+	}
+
+	void* block = pool->freeList;
+	pool->freeList = *(void**) block;
+	pool->stats.blocksInUse++;
+	memset(block, 0, blockSize);
+	return block;
+}
+
+/**
+ * Return a block to its pool.
+ */
+static void freePoolBlock(StructPool* pool, void* block)
+{
+	*(void**) block = pool->freeList;
+	pool->freeList = block;
+	pool->stats.blocksInUse--;
+}
+
+/**
+ * Field types of the Lua core, by LuaStructFieldType.
+ */
+static const int sFieldTypes[] =
+{
+	LUA_FIELD_INT,
+	LUA_FIELD_UINT,
+	LUA_FIELD_FLOAT,
+	LUA_FIELD_DOUBLE,
+	LUA_FIELD_POINTER
+};
+
+/**
+ * Fields are read and written by the Lua core, through the
+ * __fields table of the metatable. The metamethods are only
+ * called for keys that are not fields.
+ */
+static int luaStructNoField(lua_State* L)
+{
+	lua_getmetatable(L, 1);
+	lua_getfield(L, -1, "__metatable");
+	const char* name = lua_tostring(L, -1);
+	if (LUA_TSTRING == lua_type(L, 2) || LUA_TNUMBER == lua_type(L, 2))
+	{
+		return luaL_error(L, "%s has no field '%s'", name, lua_tostring(L, 2));
+	}
+	return luaL_error(L, "%s has no %s field", name, luaL_typename(L, 2));
+}
+
+static int luaStructToString(lua_State* L)
+{
+	lua_getmetatable(L, 1);
+	lua_getfield(L, -1, "__metatable");
+	lua_pushfstring(L, "%s: %p", lua_tostring(L, -1), lua_touserdata(L, 1));
+	return 1; // Number of results
+}
+
+static int luaStructViewToString(lua_State* L)
+{
+	StructView* view = (StructView*) lua_touserdata(L, 1);
+	lua_getmetatable(L, 1);
+	lua_getfield(L, -1, "__metatable");
+	lua_pushfstring(L, "%s view: %p", lua_tostring(L, -1), view->data);
+	return 1; // Number of results
+}
+
+static int luaStructPooledToString(lua_State* L)
+{
+	PooledStruct* pooled = (PooledStruct*) lua_touserdata(L, 1);
+	lua_getmetatable(L, 1);
+	lua_getfield(L, -1, "__metatable");
+	lua_pushfstring(L, "%s: %p", lua_tostring(L, -1), pooled->data);
+	return 1; // Number of results
+}
+
+/**
+ * Return the block of a pooled struct to its pool.
+ */
+static int luaStructPooledFree(lua_State* L)
+{
+	PooledStruct* pooled = (PooledStruct*) lua_touserdata(L, 1);
+	if (NULL != pooled->data)
+	{
+		freePoolBlock(pooled->pool, pooled->data);
+		pooled->data = NULL;
+	}
+	return 0; // Number of results
+}
+
+/**
+ * Create the metatable of structs, views or pooled structs of a
+ * struct type and push it. The fields of views and pooled structs
+ * are behind the pointer at the start of the userdata, and the
+ * __pointer field tells the bindings to pass that pointer to
+ * MoSync functions.
+ */
+static void pushStructMetatable(
+	lua_State* L,
+	const LuaStructLayout* layout,
+	int kind)
+{
+	int indirect = (STRUCT_METATABLE == kind) ? 0 : LUA_FIELD_INDIRECT;
+	int count = 0;
+	while (NULL != layout->fields[count].name)
+	{
+		++count;
+	}
+
+	lua_createtable(L, 0, 7);
+
+	lua_createtable(L, 0, count);
+	for (const LuaStructField* field = layout->fields;
+		NULL != field->name;
+		++field)
+	{
+		lua_pushnumber(L, lua_fielddesc(
+			field->offset, sFieldTypes[field->type] + indirect));
+		lua_setfield(L, -2, field->name);
+	}
+	lua_setfield(L, -2, "__fields");
+
+	lua_pushlightcfunction(L, luaStructNoField);
+	lua_setfield(L, -2, "__index");
+	lua_pushlightcfunction(L, luaStructNoField);
+	lua_setfield(L, -2, "__newindex");
+	if (STRUCT_METATABLE == kind)
+	{
+		lua_pushlightcfunction(L, luaStructToString);
+	}
+	else if (STRUCT_VIEW_METATABLE == kind)
+	{
+		lua_pushlightcfunction(L, luaStructViewToString);
+	}
+	else
+	{
+		lua_pushlightcfunction(L, luaStructPooledToString);
+	}
+	lua_setfield(L, -2, "__tostring");
+
+	if (STRUCT_POOLED_METATABLE == kind)
+	{
+		lua_pushlightcfunction(L, luaStructPooledFree);
+		lua_setfield(L, -2, "__gc");
+	}
+	if (indirect)
+	{
+		lua_pushboolean(L, 1);
+		lua_setfield(L, -2, "__pointer");
+	}
+
+	// Hide the metatable, getmetatable returns the name of the type.
+	lua_pushstring(L, layout->name);
+	lua_setfield(L, -2, "__metatable");
+}
+
+/**
+ * Get a struct type by name and push one of its metatables.
+ * @return The layout of the struct, NULL if there is no type
+ * with the name. Then nothing is pushed.
+ */
+static const LuaStructLayout* getStructType(
+	lua_State* L,
+	const char* name,
+	int metatable)
+{
+	lua_getfield(L, LUA_REGISTRYINDEX, STRUCTS_KEY);
+	lua_getfield(L, -1, name);
+	if (!lua_istable(L, -1))
+	{
+		lua_pop(L, 2);
+		return NULL;
+	}
+
+	lua_rawgeti(L, -1, STRUCT_LAYOUT);
+	const LuaStructLayout* layout =
+		(const LuaStructLayout*) lua_touserdata(L, -1);
+	lua_rawgeti(L, -2, metatable);
+	lua_replace(L, -4);
+	lua_pop(L, 2);
+	return layout;
+}
+
+/**
+ * Create a zero filled struct.
+ * SysStructCreate(name), for example SysStructCreate("MAEvent").
+ */
+static int luaStructCreate(lua_State* L)
+{
+	const char* name = luaL_checkstring(L, 1);
+	if (NULL == name)
+	{
+		return 0;
+	}
+	if (NULL == luaPushNewStruct(L, name))
+	{
+		return luaL_argerror(L, 1, "unknown struct type");
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Create a view of a struct at a pointer.
+ * SysStructView(name, pointer), for example
+ * SysStructView("MAWidgetEventData", event.data).
+ * Returns nil if the pointer is nil.
+ */
+static int luaStructView(lua_State* L)
+{
+	const char* name = luaL_checkstring(L, 1);
+	if (NULL == name)
+	{
+		return 0;
+	}
+	if (lua_isnoneornil(L, 2))
+	{
+		lua_pushnil(L);
+		return 1; // Number of results
+	}
+	if (!lua_islightuserdata(L, 2))
+	{
+		return luaL_typerror(L, 2, "light userdata");
+	}
+	if (!luaPushStructView(L, name, lua_touserdata(L, 2)))
+	{
+		return luaL_argerror(L, 1, "unknown struct type");
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Create a pooled struct and push it.
+ * @param metatable Stack index of the metatable.
+ * @return Pointer to the struct, NULL if out of memory.
+ */
+static void* pushPooledStruct(lua_State* L, StructPool* pool, int metatable)
+{
+	void* data = allocatePoolBlock(pool);
+	if (NULL == data)
+	{
+		return NULL;
+	}
+
+	PooledStruct* pooled =
+		(PooledStruct*) lua_newuserdata(L, sizeof(PooledStruct));
+	if (NULL == pooled)
+	{
+		freePoolBlock(pool, data);
+		return NULL;
+	}
+	pooled->data = data;
+	pooled->pool = pool;
+	lua_pushvalue(L, metatable);
+	lua_setmetatable(L, -2);
+	return data;
+}
+
+/**
+ * Create a zero filled struct from the pool of its type. The
+ * pool and the metatable are upvalues. Replaces the bindings
+ * SysEventCreate, SysPointCreate and SysRectCreate, which
+ * allocated structs that had to be freed with SysFree.
+ */
+static int luaStructPooledCreate(lua_State* L)
+{
+	StructPool* pool =
+		(StructPool*) lua_touserdata(L, lua_upvalueindex(1));
+	if (NULL == pushPooledStruct(L, pool, lua_upvalueindex(2)))
+	{
+		return luaL_error(L, "not enough memory for %s", pool->name);
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Create a pooled MACopyData.
+ * SysCopyDataCreate(dst, dstOffset, src, srcOffset, size)
+ */
+static int luaCopyDataCreate(lua_State* L)
+{
+	StructPool* pool =
+		(StructPool*) lua_touserdata(L, lua_upvalueindex(1));
+	int dst = luaL_checkint(L, 1);
+	int dstOffset = luaL_checkint(L, 2);
+	int src = luaL_checkint(L, 3);
+	int srcOffset = luaL_checkint(L, 4);
+	int size = luaL_checkint(L, 5);
+	MACopyData* data = (MACopyData*)
+		pushPooledStruct(L, pool, lua_upvalueindex(2));
+	if (NULL == data)
+	{
+		return luaL_error(L, "not enough memory for %s", pool->name);
+	}
+	data->dst = dst;
+	data->dstOffset = dstOffset;
+	data->src = src;
+	data->srcOffset = srcOffset;
+	data->size = size;
+	return 1; // Number of results
+}
+
+/**
+ * Get the statistics of the struct pools. Returns a table with
+ * one table per struct type, with the fields size, hits, misses
+ * and inUse, like EngineGetAllocatorStats.
+ * SysStructGetPoolStats()
+ */
+static int luaStructGetPoolStats(lua_State* L)
+{
+	lua_newtable(L);
+	for (StructPool* pool = sStructPools; NULL != pool->name; ++pool)
+	{
+		lua_createtable(L, 0, 4);
+		lua_pushinteger(L, pool->stats.blockSize);
+		lua_setfield(L, -2, "size");
+		lua_pushinteger(L, pool->stats.hits);
+		lua_setfield(L, -2, "hits");
+		lua_pushinteger(L, pool->stats.misses);
+		lua_setfield(L, -2, "misses");
+		lua_pushinteger(L, pool->stats.blocksInUse);
+		lua_setfield(L, -2, "inUse");
+		lua_setfield(L, -2, pool->name);
+	}
+	return 1; // Number of results
+}
+
+/**
+ * Add the pool of a struct type to the type, and register
+ * the Lua function that creates structs from the pool.
+ */
+static void registerStructPool(
+	lua_State* L,
+	StructPool* pool,
+	const char* functionName,
+	lua_CFunction function)
+{
+	lua_getfield(L, LUA_REGISTRYINDEX, STRUCTS_KEY);
+	lua_getfield(L, -1, pool->name);
+	lua_rawgeti(L, -1, STRUCT_LAYOUT);
+	const LuaStructLayout* layout =
+		(const LuaStructLayout*) lua_touserdata(L, -1);
+	lua_pop(L, 1);
+	lua_pushlightuserdata(L, pool);
+	lua_rawseti(L, -2, STRUCT_POOL);
+	pushStructMetatable(L, layout, STRUCT_POOLED_METATABLE);
+	lua_pushvalue(L, -1);
+	lua_rawseti(L, -3, STRUCT_POOLED_METATABLE);
+
+	// Stack: structs, type, metatable.
+	lua_pushlightuserdata(L, pool);
+	lua_insert(L, -2);
+	lua_pushcclosure(L, function, 2);
+	lua_setglobal(L, functionName);
+	lua_pop(L, 2);
+}
+
+/**
+ * Layouts of the structs of the MoSync API. The names of fields
+ * in nested structs follow the SysEventGet functions.
+ */
+
+static const LuaStructField sEventFields[] =
+{
+	{ "type", LUA_STRUCT_OFFSET(MAEvent, type), LUA_STRUCT_INT },
+	{ "key", LUA_STRUCT_OFFSET(MAEvent, key), LUA_STRUCT_INT },
+	{ "nativeKey", LUA_STRUCT_OFFSET(MAEvent, nativeKey), LUA_STRUCT_INT },
+	{ "character", LUA_STRUCT_OFFSET(MAEvent, character), LUA_STRUCT_UINT },
+	{ "x", LUA_STRUCT_OFFSET(MAEvent, point.x), LUA_STRUCT_INT },
+	{ "y", LUA_STRUCT_OFFSET(MAEvent, point.y), LUA_STRUCT_INT },
+	{ "touchId", LUA_STRUCT_OFFSET(MAEvent, touchId), LUA_STRUCT_INT },
+	{ "state", LUA_STRUCT_OFFSET(MAEvent, state), LUA_STRUCT_INT },
+	{ "connHandle", LUA_STRUCT_OFFSET(MAEvent, conn.handle), LUA_STRUCT_INT },
+	{ "connOpType", LUA_STRUCT_OFFSET(MAEvent, conn.opType), LUA_STRUCT_INT },
+	{ "connResult", LUA_STRUCT_OFFSET(MAEvent, conn.result), LUA_STRUCT_INT },
+	{ "textboxResult", LUA_STRUCT_OFFSET(MAEvent, textboxResult), LUA_STRUCT_INT },
+	{ "textboxLength", LUA_STRUCT_OFFSET(MAEvent, textboxLength), LUA_STRUCT_INT },
+	{ "data", LUA_STRUCT_OFFSET(MAEvent, data), LUA_STRUCT_POINTER },
+	{ "sensorType", LUA_STRUCT_OFFSET(MAEvent, sensor.type), LUA_STRUCT_INT },
+	{ "sensorValue1", LUA_STRUCT_OFFSET(MAEvent, sensor.values[0]), LUA_STRUCT_FLOAT },
+	{ "sensorValue2", LUA_STRUCT_OFFSET(MAEvent, sensor.values[1]), LUA_STRUCT_FLOAT },
+	{ "sensorValue3", LUA_STRUCT_OFFSET(MAEvent, sensor.values[2]), LUA_STRUCT_FLOAT },
+	{ NULL, 0, LUA_STRUCT_INT }
+};
+
+static const LuaStructField sPointFields[] =
+{
+	{ "x", LUA_STRUCT_OFFSET(MAPoint2d, x), LUA_STRUCT_INT },
+	{ "y", LUA_STRUCT_OFFSET(MAPoint2d, y), LUA_STRUCT_INT },
+	{ NULL, 0, LUA_STRUCT_INT }
+};
+
+static const LuaStructField sRectFields[] =
+{
+	{ "left", LUA_STRUCT_OFFSET(MARect, left), LUA_STRUCT_INT },
+	{ "top", LUA_STRUCT_OFFSET(MARect, top), LUA_STRUCT_INT },
+	{ "width", LUA_STRUCT_OFFSET(MARect, width), LUA_STRUCT_INT },
+	{ "height", LUA_STRUCT_OFFSET(MARect, height), LUA_STRUCT_INT },
+	{ NULL, 0, LUA_STRUCT_INT }
+};
+
+static const LuaStructField sCopyDataFields[] =
+{
+	{ "dst", LUA_STRUCT_OFFSET(MACopyData, dst), LUA_STRUCT_INT },
+	{ "dstOffset", LUA_STRUCT_OFFSET(MACopyData, dstOffset), LUA_STRUCT_INT },
+	{ "src", LUA_STRUCT_OFFSET(MACopyData, src), LUA_STRUCT_INT },
+	{ "srcOffset", LUA_STRUCT_OFFSET(MACopyData, srcOffset), LUA_STRUCT_INT },
+	{ "size", LUA_STRUCT_OFFSET(MACopyData, size), LUA_STRUCT_INT },
+	{ NULL, 0, LUA_STRUCT_INT }
+};
+
+static const LuaStructField sLocationFields[] =
+{
+	{ "state", LUA_STRUCT_OFFSET(MALocation, state), LUA_STRUCT_INT },
+	{ "lat", LUA_STRUCT_OFFSET(MALocation, lat), LUA_STRUCT_DOUBLE },
+	{ "lon", LUA_STRUCT_OFFSET(MALocation, lon), LUA_STRUCT_DOUBLE },
+	{ "horzAcc", LUA_STRUCT_OFFSET(MALocation, horzAcc), LUA_STRUCT_DOUBLE },
+	{ "vertAcc", LUA_STRUCT_OFFSET(MALocation, vertAcc), LUA_STRUCT_DOUBLE },
+	{ "alt", LUA_STRUCT_OFFSET(MALocation, alt), LUA_STRUCT_FLOAT },
+	{ NULL, 0, LUA_STRUCT_INT }
+};
+
+static const LuaStructField sWidgetEventFields[] =
+{
+	{ "eventType", LUA_STRUCT_OFFSET(MAWidgetEventData, eventType), LUA_STRUCT_INT },
+	{ "widgetHandle", LUA_STRUCT_OFFSET(MAWidgetEventData, widgetHandle), LUA_STRUCT_INT },
+	{ "listItemIndex", LUA_STRUCT_OFFSET(MAWidgetEventData, listItemIndex), LUA_STRUCT_INT },
+	{ "checked", LUA_STRUCT_OFFSET(MAWidgetEventData, checked), LUA_STRUCT_INT },
+	{ "tabIndex", LUA_STRUCT_OFFSET(MAWidgetEventData, tabIndex), LUA_STRUCT_INT },
+	{ "urlData", LUA_STRUCT_OFFSET(MAWidgetEventData, urlData), LUA_STRUCT_INT },
+	{ NULL, 0, LUA_STRUCT_INT }
+};
+
+static const LuaStructLayout sStructLayouts[] =
+{
+	{ "MAEvent", sizeof(MAEvent), sEventFields },
+	{ "MAPoint2d", sizeof(MAPoint2d), sPointFields },
+	{ "MARect", sizeof(MARect), sRectFields },
+	{ "MACopyData", sizeof(MACopyData), sCopyDataFields },
+	{ "MALocation", sizeof(MALocation), sLocationFields },
+	{ "MAWidgetEventData", sizeof(MAWidgetEventData), sWidgetEventFields },
+	{ NULL, 0, NULL }
+};
+
+void luaOpenStructs(lua_State* L)
+{
+	lua_newtable(L);
+	lua_setfield(L, LUA_REGISTRYINDEX, STRUCTS_KEY);
+
+	for (const LuaStructLayout* layout = sStructLayouts;
+		NULL != layout->name;
+		++layout)
+	{
+		luaRegisterStruct(L, layout);
+	}
+
+	lua_pushlightcfunction(L, luaStructCreate);
+	lua_setglobal(L, "SysStructCreate");
+	lua_pushlightcfunction(L, luaStructView);
+	lua_setglobal(L, "SysStructView");
+
+	// Pooled structs, these replace the bindings.
+	registerStructPool(L, &sStructPools[0], "SysEventCreate", luaStructPooledCreate);
+	registerStructPool(L, &sStructPools[1], "SysPointCreate", luaStructPooledCreate);
+	registerStructPool(L, &sStructPools[2], "SysRectCreate", luaStructPooledCreate);
+	registerStructPool(L, &sStructPools[3], "SysCopyDataCreate", luaCopyDataCreate);
+	lua_pushlightcfunction(L, luaStructGetPoolStats);
+	lua_setglobal(L, "SysStructGetPoolStats");
+}
+
+void luaRegisterStruct(lua_State* L, const LuaStructLayout* layout)
+{
+	lua_getfield(L, LUA_REGISTRYINDEX, STRUCTS_KEY);
+	lua_createtable(L, 3, 0);
+	lua_pushlightuserdata(L, (void*) layout);
+	lua_rawseti(L, -2, STRUCT_LAYOUT);
+	pushStructMetatable(L, layout, STRUCT_METATABLE);
+	lua_rawseti(L, -2, STRUCT_METATABLE);
+	pushStructMetatable(L, layout, STRUCT_VIEW_METATABLE);
+	lua_rawseti(L, -2, STRUCT_VIEW_METATABLE);
+	lua_setfield(L, -2, layout->name);
+	lua_pop(L, 1);
+}
+
+void* luaPushNewStruct(lua_State* L, const char* name)
+{
+	const LuaStructLayout* layout = getStructType(L, name, STRUCT_METATABLE);
+	if (NULL == layout)
+	{
+		return NULL;
+	}
+
+	void* data = lua_newuserdata(L, layout->size);
+	memset(data, 0, layout->size);
+	lua_insert(L, -2);
+	lua_setmetatable(L, -2);
+	return data;
+}
+
+int luaPushStructView(lua_State* L, const char* name, void* data)
+{
+	if (NULL == getStructType(L, name, STRUCT_VIEW_METATABLE))
+	{
+		return 0;
+	}
+
+	StructView* view = (StructView*) lua_newuserdata(L, sizeof(StructView));
+	view->data = data;
+	lua_insert(L, -2);
+	lua_setmetatable(L, -2);
+	return 1;
+}
+
+void* luaPushPooledStruct(lua_State* L, const char* name)
+{
+	if (NULL == getStructType(L, name, STRUCT_POOL))
+	{
+		return NULL;
+	}
+	StructPool* pool = (StructPool*) lua_touserdata(L, -1);
+	lua_pop(L, 1);
+	if (NULL == pool)
+	{
+		return NULL;
+	}
+
+	getStructType(L, name, STRUCT_POOLED_METATABLE);
+	void* data = pushPooledStruct(L, pool, lua_gettop(L));
+	lua_remove(L, NULL == data ? -1 : -2);
+	return data;
+}
+
+int luaGetStructPoolStats(const char* name, LuaAllocatorStats* stats)
+{
+	for (StructPool* pool = sStructPools; NULL != pool->name; ++pool)
+	{
+		if (0 == strcmp(pool->name, name))
+		{
+			*stats = pool->stats;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+}
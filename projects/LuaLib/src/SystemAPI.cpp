@@ -248,11 +248,25 @@ extern "C" double SysBufferGetDouble(void* buffer, int index)
 	return p[index];
 }
 
+/**
+ * The bulk buffer functions below work a word at a time
+ * where the alignment of the data allows it.
+ */
+typedef unsigned int BufferWord;
+#define BUFFER_WORD_SIZE ((int) sizeof(BufferWord))
+#define BUFFER_WORD_OFFSET(p) (((size_t) (p)) & (BUFFER_WORD_SIZE - 1))
+
+/**
+ * Overlapping copies use memcpy for blocks of at least this
+ * many bytes, smaller blocks are not worth a syscall.
+ */
+#define BUFFER_MIN_MOVE_BLOCK 64
+
 /**
  * Copy bytes from one memory block to another. The number of bytes
  * given by numberOfBytesToCopy bytes, starting at sourceIndex in 
  * the source block, will be copied to the destination block, 
- * starting at destIndex.
+ * starting at destIndex. The source and destination may overlap.
  * @param sourceBuffer Pointer to the source memory block.
  * @param sourceIndex Offset to a byte index in the source block.
  * @param destBuffer Pointer to the destination memory block.
@@ -267,14 +281,254 @@ extern "C" void SysBufferCopyBytes(
 	int destIndex, 
 	int numberOfBytesToCopy)
 {
-	byte* source = (byte*) sourceBuffer;
-	byte* dest = (byte*) destBuffer;
-	
-	// Not the very fastest implementation perhaps...
-	for (int i = 0; i < numberOfBytesToCopy; ++i)
+	const byte* source = ((const byte*) sourceBuffer) + sourceIndex;
+	byte* dest = ((byte*) destBuffer) + destIndex;
+	int n = numberOfBytesToCopy;
+
+	if (n <= 0 || source == dest)
+	{
+		return;
+	}
+
+	if (dest + n <= source || source + n <= dest)
+	{
+		// No overlap, memcpy is a syscall on MoSync.
+		memcpy(dest, source, n);
+	}
+	else if (dest < source)
+	{
+		// Overlap, copy forwards. Blocks of the distance
+		// between source and dest do not overlap.
+		int distance = (int) (source - dest);
+		if (distance >= BUFFER_MIN_MOVE_BLOCK)
+		{
+			for (; n >= distance; n -= distance)
+			{
+				memcpy(dest, source, distance);
+				dest += distance;
+				source += distance;
+			}
+		}
+		else if (BUFFER_WORD_OFFSET(source) == BUFFER_WORD_OFFSET(dest))
+		{
+			while (BUFFER_WORD_OFFSET(dest) != 0)
+			{
+				*dest++ = *source++;
+				--n;
+			}
+			for (; n >= BUFFER_WORD_SIZE; n -= BUFFER_WORD_SIZE)
+			{
+				*(BufferWord*) dest = *(const BufferWord*) source;
+				dest += BUFFER_WORD_SIZE;
+				source += BUFFER_WORD_SIZE;
+			}
+		}
+		while (n-- > 0)
+		{
+			*dest++ = *source++;
+		}
+	}
+	else
+	{
+		// Overlap, copy backwards.
+		int distance = (int) (dest - source);
+		source += n;
+		dest += n;
+		if (distance >= BUFFER_MIN_MOVE_BLOCK)
+		{
+			for (; n >= distance; n -= distance)
+			{
+				dest -= distance;
+				source -= distance;
+				memcpy(dest, source, distance);
+			}
+		}
+		else if (BUFFER_WORD_OFFSET(source) == BUFFER_WORD_OFFSET(dest))
+		{
+			while (n > 0 && BUFFER_WORD_OFFSET(dest) != 0)
+			{
+				*--dest = *--source;
+				--n;
+			}
+			for (; n >= BUFFER_WORD_SIZE; n -= BUFFER_WORD_SIZE)
+			{
+				dest -= BUFFER_WORD_SIZE;
+				source -= BUFFER_WORD_SIZE;
+				*(BufferWord*) dest = *(const BufferWord*) source;
+			}
+		}
+		while (n-- > 0)
+		{
+			*--dest = *--source;
+		}
+	}
+}
+
+/**
+ * Set bytes in a memory block to a value.
+ * @param buffer Pointer to memory block.
+ * @param index Offset to the first byte to set.
+ * @param value The byte value.
+ * @param numberOfBytes Number of bytes to set.
+ */
+extern "C" void SysBufferFillBytes(
+	void* buffer,
+	int index,
+	int value,
+	int numberOfBytes)
+{
+	if (numberOfBytes > 0)
+	{
+		// memset is a syscall on MoSync.
+		memset(((byte*) buffer) + index, value, numberOfBytes);
+	}
+}
+
+/**
+ * Compare bytes in two memory blocks.
+ * @param buffer1 Pointer to the first memory block.
+ * @param index1 Offset to a byte index in the first block.
+ * @param buffer2 Pointer to the second memory block.
+ * @param index2 Offset to a byte index in the second block.
+ * @param numberOfBytes Number of bytes to compare.
+ * @return Zero if the bytes are equal, otherwise the difference
+ * between the first differing bytes, as unsigned values.
+ */
+extern "C" int SysBufferCompareBytes(
+	void* buffer1,
+	int index1,
+	void* buffer2,
+	int index2,
+	int numberOfBytes)
+{
+	const byte* p1 = ((const byte*) buffer1) + index1;
+	const byte* p2 = ((const byte*) buffer2) + index2;
+	int n = numberOfBytes;
+
+	// Skip equal words when the blocks have the same alignment.
+	if (BUFFER_WORD_OFFSET(p1) == BUFFER_WORD_OFFSET(p2))
+	{
+		for (; n > 0 && BUFFER_WORD_OFFSET(p1) != 0; --n, ++p1, ++p2)
+		{
+			if (*p1 != *p2)
+			{
+				return *p1 - *p2;
+			}
+		}
+		while (n >= BUFFER_WORD_SIZE
+			&& *(const BufferWord*) p1 == *(const BufferWord*) p2)
+		{
+			p1 += BUFFER_WORD_SIZE;
+			p2 += BUFFER_WORD_SIZE;
+			n -= BUFFER_WORD_SIZE;
+		}
+	}
+
+	for (; n > 0; --n, ++p1, ++p2)
+	{
+		if (*p1 != *p2)
+		{
+			return *p1 - *p2;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Find the first occurrence of a byte value in a memory block.
+ * @param buffer Pointer to memory block.
+ * @param index Offset to the byte where the search starts.
+ * @param numberOfBytes Number of bytes to search.
+ * @param value The byte value to find.
+ * @return The byte index of the value in the block,
+ * or -1 if not found.
+ */
+extern "C" int SysBufferFindByte(
+	void* buffer,
+	int index,
+	int numberOfBytes,
+	int value)
+{
+	const byte* start = ((const byte*) buffer) + index;
+	const byte* end = start + (numberOfBytes > 0 ? numberOfBytes : 0);
+	const byte* p = start;
+	byte b = (byte) value;
+
+	for (; p < end && BUFFER_WORD_OFFSET(p) != 0; ++p)
 	{
-		dest[destIndex + i] = source[sourceIndex + i];
+		if (*p == b)
+		{
+			return index + (int) (p - start);
+		}
 	}
+
+	// A word contains the byte if xor with the byte repeated
+	// gives a word with a zero byte.
+	const BufferWord ones = ((BufferWord) -1) / 0xFF;
+	const BufferWord highBits = ones << 7;
+	const BufferWord pattern = ones * b;
+	for (; end - p >= BUFFER_WORD_SIZE; p += BUFFER_WORD_SIZE)
+	{
+		BufferWord word = *(const BufferWord*) p ^ pattern;
+		if (0 != ((word - ones) & ~word & highBits))
+		{
+			break;
+		}
+	}
+
+	for (; p < end; ++p)
+	{
+		if (*p == b)
+		{
+			return index + (int) (p - start);
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * Find the first occurrence of a sequence of bytes in a memory block.
+ * @param buffer Pointer to the memory block to search.
+ * @param index Offset to the byte where the search starts.
+ * @param numberOfBytes Number of bytes to search.
+ * @param pattern Pointer to the memory block with the bytes to find.
+ * @param patternIndex Offset to the first byte to find.
+ * @param patternLength Number of bytes to find.
+ * @return The byte index of the sequence in the searched block,
+ * or -1 if not found.
+ */
+extern "C" int SysBufferFindBytes(
+	void* buffer,
+	int index,
+	int numberOfBytes,
+	void* pattern,
+	int patternIndex,
+	int patternLength)
+{
+	if (patternLength <= 0)
+	{
+		return numberOfBytes >= 0 ? index : -1;
+	}
+
+	int first = ((byte*) pattern)[patternIndex];
+	int last = index + numberOfBytes - patternLength;
+	for (int i = index; i <= last; ++i)
+	{
+		i = SysBufferFindByte(buffer, i, last - i + 1, first);
+		if (i < 0)
+		{
+			break;
+		}
+		if (0 == SysBufferCompareBytes(
+			buffer, i + 1, pattern, patternIndex + 1, patternLength - 1))
+		{
+			return i;
+		}
+	}
+
+	return -1;
 }
 
 /**
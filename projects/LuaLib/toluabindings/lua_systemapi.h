@@ -75,6 +75,8 @@ void* SysAlloc(int size);
  * Free allocated data.
  * This function is used to free allocated data, and
  * also data structures like Events, Points and Rects.
+ * When called from Lua, Buffers are ignored, they are
+ * freed by the garbage collector.
  */
 void SysFree(void* buffer);
 
@@ -134,7 +136,7 @@ double SysBufferGetDouble(void* buffer, int index);
  * Copy bytes from one memory block to another. The number of bytes
  * given by numberOfBytesToCopy bytes, starting at sourceIndex in 
  * the source block, will be copied to the destination block, 
- * starting at destIndex.
+ * starting at destIndex. The source and destination may overlap.
  * @param sourceBuffer Pointer to the source memory block.
  * @param sourceIndex Offset to a byte index in the source block.
  * @param destBuffer Pointer to the destination memory block.
@@ -144,6 +146,51 @@ double SysBufferGetDouble(void* buffer, int index);
  */
 void SysBufferCopyBytes(void* sourceBuffer, int sourceIndex, void* destBuffer, int destIndex, int numberOfBytesToCopy);
 
+/**
+ * Set bytes in a memory block to a value.
+ * @param buffer Pointer to memory block.
+ * @param index Offset to the first byte to set.
+ * @param value The byte value.
+ * @param numberOfBytes Number of bytes to set.
+ */
+void SysBufferFillBytes(void* buffer, int index, int value, int numberOfBytes);
+
+/**
+ * Compare bytes in two memory blocks.
+ * @param buffer1 Pointer to the first memory block.
+ * @param index1 Offset to a byte index in the first block.
+ * @param buffer2 Pointer to the second memory block.
+ * @param index2 Offset to a byte index in the second block.
+ * @param numberOfBytes Number of bytes to compare.
+ * @return Zero if the bytes are equal, otherwise the difference
+ * between the first differing bytes, as unsigned values.
+ */
+int SysBufferCompareBytes(void* buffer1, int index1, void* buffer2, int index2, int numberOfBytes);
+
+/**
+ * Find the first occurrence of a byte value in a memory block.
+ * @param buffer Pointer to memory block.
+ * @param index Offset to the byte where the search starts.
+ * @param numberOfBytes Number of bytes to search.
+ * @param value The byte value to find.
+ * @return The byte index of the value in the block,
+ * or -1 if not found.
+ */
+int SysBufferFindByte(void* buffer, int index, int numberOfBytes, int value);
+
+/**
+ * Find the first occurrence of a sequence of bytes in a memory block.
+ * @param buffer Pointer to the memory block to search.
+ * @param index Offset to the byte where the search starts.
+ * @param numberOfBytes Number of bytes to search.
+ * @param pattern Pointer to the memory block with the bytes to find.
+ * @param patternIndex Offset to the first byte to find.
+ * @param patternLength Number of bytes to find.
+ * @return The byte index of the sequence in the searched block,
+ * or -1 if not found.
+ */
+int SysBufferFindBytes(void* buffer, int index, int numberOfBytes, void* pattern, int patternIndex, int patternLength);
+
 /**
  * Return a pointer to a byte at an index in a buffer.
  * This function is useful when calling functions that
@@ -269,15 +316,135 @@ They are listed here for documentation purposes,
 to make the list of Lua "Sys" functions complete.
 
 -- Convert a null-terminated C-string pointer to
--- by "buffer" to a Lua string.
+-- by "buffer" to a Lua string. For a Buffer, the string
+-- ends at the first zero byte or at the end of the Buffer.
 SysBufferToString(buffer) -> string
 
--- Create a new instance of the Lua engine.
-SysLuaEngineCreate() -> ref to the engine
+-- Create a zero filled Buffer of size bytes. A Buffer can be
+-- passed to any function that takes a pointer, and is freed by
+-- the garbage collector (SysFree ignores it). Offsets are in
+-- bytes and start at zero. Methods, for a Buffer b:
+--   #b, b:size() -> number of bytes
+--   b[offset], b[offset] = value -> get/set an unsigned byte
+--   b:getByte(offset), b:setByte(offset, value)
+--   b:getInt16(offset), b:setInt16(offset, value)
+--   b:getInt32(offset), b:setInt32(offset, value)
+--   b:getFloat(offset), b:setFloat(offset, value)
+--   b:getDouble(offset), b:setDouble(offset, value)
+--   b:copy(offset, source, sourceOffset, count) -> copy from a
+--     Buffer or string, the source may overlap b
+--   b:getString(offset, count) -> string with the bytes
+--   b:fill(value, offset, count) -> set bytes to value
+--   b:compare(offset, other, otherOffset, count) -> zero if the
+--     bytes equal those of a Buffer or string
+--   b:find(pattern, offset, count) -> offset of a byte value,
+--     string or Buffer, or nil
+--   Omitted offsets are zero, omitted counts are the rest of
+--     the source, other or b.
+--   b:bigEndian(), b:littleEndian() -> view of b with that
+--     byte order, with the same methods. Buffers are little
+--     endian.
+-- Access outside the buffer is an error.
+SysBufferCreate(size) -> Buffer
+
+-- Create a new instance of the Lua engine. The optional
+-- budget is the maximum number of bytes the engine may
+-- allocate (see SysLuaEngineSetMemoryBudget).
+SysLuaEngineCreate(budget) -> ref to the engine
 
 -- Delete a Lua engine.
 SysLuaEngineDelete(engine) -> none
 
--- Evaluate Lua code. Param code is a string.
+-- Evaluate Lua code. Param code is a string, or a
+-- data handle with source code or precompiled bytecode.
 SysLuaEngineEval(engine, code) -> boolean
+
+-- Get the number of bytes allocated by a Lua engine.
+-- If engine is nil, the calling engine is used.
+SysLuaEngineGetMemoryInUse(engine) -> number
+
+-- Get the highest number of bytes allocated by a Lua engine.
+-- If engine is nil, the calling engine is used. If reset is
+-- true, a new measurement is started from the current usage.
+SysLuaEngineGetMemoryPeak(engine, reset) -> number
+
+-- Set the maximum number of bytes a Lua engine may allocate,
+-- zero for no limit. If engine is nil, the calling engine is
+-- used. Close to the budget, the engine does a full garbage
+-- collection. If the usage is still over the budget after it,
+-- the running script fails with a memory error.
+SysLuaEngineSetMemoryBudget(engine, budget) -> none
+
+-- Get the number of allocations that went over the memory
+-- budget. If engine is nil, the calling engine is used.
+SysLuaEngineGetMemoryBudgetHits(engine) -> number
+
+-- Set the number of kilobytes a Lua engine garbage collects
+-- each time its event loop runs out of pending events, zero
+-- to turn off idle collection (the default). If engine is nil,
+-- the calling engine is used.
+SysLuaEngineSetIdleGCStep(engine, kbytes) -> none
+
+-- Tell the calling engine that the event loop is idle. Called
+-- by EventMonitor:RunEventLoop().
+SysLuaEngineIdle() -> none
+
+-- Get the garbage collector pauses of a Lua engine: the number
+-- of pauses, the total time and the longest pause in ms. If
+-- engine is nil, the calling engine is used. If reset is true,
+-- a new measurement is started.
+SysLuaEngineGetGCPauses(engine, reset) -> number, number, number
+
+-- Get statistics for the memory pools of a Lua engine.
+-- If engine is nil, the calling engine is used. Returns an
+-- array with one table per size class, with the fields size,
+-- hits, misses and inUse. Empty if the engine does not use
+-- a pool allocator.
+SysLuaEngineGetAllocatorStats(engine) -> table
+
+-- Set the function the native event loop calls for events of
+-- type eventType, nil to remove it. The function gets:
+--   EVENT_TYPE_KEY_PRESSED/RELEASED: keyCode
+--   EVENT_TYPE_POINTER_PRESSED/RELEASED/DRAGGED: x, y, touchId
+--   EVENT_TYPE_CONN: connection, opType, result
+--   EVENT_TYPE_SENSOR: sensorType, value1, value2, value3
+--   EVENT_TYPE_WIDGET: widgetEventData
+--   Other event types: event
+-- Use eventType 0 for a function that gets all events as
+-- event objects. Event objects are only valid during the call.
+SysEventLoopSetHandler(eventType, fun) -> none
+
+-- Run the native event loop of the calling engine. Returns
+-- true, or false and the error message if the loop was stopped
+-- by an error in a handler.
+SysEventLoopRun(waitTime) -> boolean, string
+
+-- Make the native event loop exit.
+SysEventLoopExit() -> none
+
+-- Turn coalescing of drag events and sensor events on or off
+-- in the native event loop. When on, events that arrive between
+-- two waits are merged per touch id and per sensor type, and
+-- only the latest one is passed to the handler.
+SysEventLoopSetCoalescing(dragEvents, sensorEvents) -> none
+
+-- Get the number of drag events and sensor events that were
+-- dropped by coalescing.
+SysEventLoopGetMergedEvents() -> number, number
+
+-- Set a function that gets sensor events in batches, nil to
+-- stop batching. While set, sensor events do not go to the
+-- EVENT_TYPE_SENSOR handler. A batch is delivered when it has
+-- samples samples (at most 128, the default), or when its first
+-- sample is milliseconds old (0, the default, for no limit).
+-- The function gets a table with four numbers per sample
+-- (sensor type, value1, value2, value3) and the number of samples.
+-- The same table is reused for every batch, so copy the values
+-- that should be kept.
+SysEventLoopSetSensorBatchHandler(fun, samples, milliseconds) -> none
+
+-- Load Lua code (source or bytecode) from a data handle,
+-- without first copying it to a string. Returns the chunk
+-- as a function, or nil plus an error message.
+SysLoadHandle(handle, chunkName) -> function
 */
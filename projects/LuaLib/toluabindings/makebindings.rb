@@ -34,4 +34,6 @@ File.open("lua_maapi.pkg", "w") do |outFile|
   }
 end
 
-sh "../../../tolua/bin/tolua.exe -o lua_maapi.c lua_maapi.pkg"
+# -L binds the functions and constants on first access.
+# -T instead of -F gives smaller but slightly slower bindings.
+sh "../../../tolua/bin/tolua.exe -L -F -o lua_maapi.c lua_maapi.pkg"
@@ -0,0 +1,121 @@
+# Script to generate bindings for only the functions and constants
+# that an application uses. Run makebindings.rb first, this script
+# reads the lua_maapi.pkg file that it creates.
+#
+# Usage:
+#   ruby prunebindings.rb [-k keepfile] [-o output] source ...
+#
+# A source is a Lua file, or a MoSync resource list (.lst) whose
+# .include lines name the Lua files of the application. Every name
+# found in the sources keeps the binding of that name, also names
+# in strings and comments, so the scan errs on the safe side.
+#
+# Names that are built at runtime, for example "MAW_" .. name, cannot
+# be found by the scan. List them in a keep file, one name per line.
+# A name that ends with * keeps all bindings that start with it.
+# Lines starting with # are comments.
+#
+# The pruned package is written next to the output file, with the
+# extension .pkg, and the output has the same package name as
+# lua_maapi.c, so it can replace lua_maapi.c when building LuaLib.
+
+def sh(cmd)
+  $stderr.puts cmd
+  if (!system(cmd)) then
+    error "Command failed: '#{$?}'"
+  end
+end
+
+def error(message)
+  $stderr.puts message
+  exit 1
+end
+
+# Lua files of a source, following the .include lines of resource lists.
+def luaFiles(fileName)
+  if (File.extname(fileName) != ".lst") then
+    return [fileName]
+  end
+  IO.read(fileName).scan(/^\s*\.include\s+"([^"]+)"/).map { |match|
+    File.join(File.dirname(fileName), match[0])
+  }
+end
+
+def readKeepFile(fileName)
+  IO.readlines(fileName).map { |line| line.strip }.
+    reject { |line| line.empty? || line.start_with?("#") }
+end
+
+def keep?(name, names, patterns)
+  names.include?(name) || patterns.any? { |prefix| name.start_with?(prefix) }
+end
+
+keepFiles = []
+output = "lua_maapi_pruned.c"
+sources = []
+while (argument = ARGV.shift) do
+  case argument
+  when "-k" then keepFiles << ARGV.shift
+  when "-o" then output = ARGV.shift
+  else sources << argument
+  end
+end
+if (sources.empty?) then
+  error "usage: ruby prunebindings.rb [-k keepfile] [-o output] source ..."
+end
+
+# Names used by the application.
+names = {}
+sources.map { |source| luaFiles(source) }.flatten.each do |fileName|
+  IO.read(fileName).scan(/[A-Za-z_][A-Za-z0-9_]*/) { |name| names[name] = true }
+end
+patterns = []
+keepFiles.each do |fileName|
+  readKeepFile(fileName).each do |name|
+    if (name.end_with?("*")) then
+      patterns << name.chomp("*")
+    else
+      names[name] = true
+    end
+  end
+end
+
+# Remove the defines and functions that are not used, other lines
+# (typedefs and comments) are kept as they are.
+keptFunctions = []
+keptConstants = []
+functionCount = 0
+constantCount = 0
+pkg = IO.readlines("lua_maapi.pkg").select do |line|
+  if (line =~ /^#define\s+([A-Za-z_][A-Za-z0-9_]*)\s/) then
+    constantCount += 1
+    keep?($1, names, patterns) && keptConstants << $1
+  elsif (line =~ /^[A-Za-z_][^(]*?([A-Za-z_][A-Za-z0-9_]*)\s*\(.*\)\s*;\s*$/) then
+    functionCount += 1
+    keep?($1, names, patterns) && keptFunctions << $1
+  else
+    true
+  end
+end
+
+pkgFile = output.sub(/\.[^.\/]*$/, "") + ".pkg"
+File.open(pkgFile, "w") { |outFile| outFile.puts pkg }
+
+$stderr.puts "Kept #{keptFunctions.size} of #{functionCount} functions:"
+$stderr.puts "  " + keptFunctions.sort.join(" ")
+$stderr.puts "Kept #{keptConstants.size} of #{constantCount} constants:"
+$stderr.puts "  " + keptConstants.sort.join(" ")
+
+# Names that look like MoSync API names but have no binding, these
+# are either bound by LuaLib itself (such as SysBufferCreate) or
+# misspelled.
+unbound = names.keys.select { |name| name =~ /^(ma|Sys|gl)[A-Z]/ } -
+  keptFunctions - keptConstants
+if (!unbound.empty?) then
+  $stderr.puts "Not in the bindings:"
+  $stderr.puts "  " + unbound.sort.join(" ")
+end
+
+# The package is named lua_maapi whatever the file is called, since
+# LuaEngine opens it with tolua_lua_maapi_open.
+sh "../../../tolua/bin/tolua.exe -L -F -n lua_maapi -o #{output} #{pkgFile}"
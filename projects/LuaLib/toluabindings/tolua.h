@@ -43,6 +43,23 @@ struct tolua_Error
 	const char* type;
 };
 typedef struct tolua_Error tolua_Error;
+
+/* Function or constant bound on first access, see tolua_lazymodule.
+** For a function, func is set. For a string constant, string is set.
+** Otherwise the binding is the number constant in number.
+** If target is also set, func is a trampoline shared by the functions
+** of a signature and target is the function it calls, see tolua_target.
+*/
+typedef void (*tolua_CFunction) (void);
+struct tolua_LazyBinding
+{
+	const char* name;
+	lua_CFunction func;
+	double number;
+	const char* string;
+	tolua_CFunction target;
+};
+typedef struct tolua_LazyBinding tolua_LazyBinding;
 typedef char tolua_byte;
 typedef unsigned char tolua_ubyte;
 typedef int tolua_index;
@@ -50,6 +67,10 @@ typedef int lua_Object;
 
 #define tolua_own
 
+/* Function called by the running trampoline, whose upvalue is its binding */
+#define tolua_target(L) \
+	(((const tolua_LazyBinding*) lua_touserdata(L,lua_upvalueindex(1)))->target)
+
 TOLUA_API const char* tolua_typename (lua_State* L, int lo);
 TOLUA_API void tolua_error (lua_State* L, const char* msg, tolua_Error* err);
 TOLUA_API int tolua_isnoobj (lua_State* L, int lo, tolua_Error* err);
@@ -93,6 +114,9 @@ TOLUA_API void tolua_constant (lua_State* L, const char* name, double value);
 TOLUA_API void tolua_constant_string (lua_State* L, const char* name, const char* value);
 TOLUA_API void tolua_variable (lua_State* L, const char* name, lua_CFunction get, lua_CFunction set);
 TOLUA_API void tolua_array (lua_State* L, const char* name, lua_CFunction get, lua_CFunction set);
+TOLUA_API void tolua_lazymodule (lua_State* L, const tolua_LazyBinding* bindings, int count);
+TOLUA_API void tolua_setlazybindings (lua_State* L, int lazy);
+TOLUA_API void tolua_binding (lua_State* L, const tolua_LazyBinding* binding);
 
 
 TOLUA_API void tolua_pushvalue (lua_State* L, int lo);
@@ -16,16 +16,17 @@
 #include <string.h>
 
 #include "tolua.h"
+#include "tolua_event.h"
 
 /* Store at peer
 	* It stores, creating the corresponding table if needed,
-	* the pair key/value in the corresponding peer table
+	* the pair key/value in the corresponding peer table.
+	* The calling event keeps the peer table as its first upvalue.
 */
 static void storeatpeer (lua_State* L, int index)
 {
 	 /* stack: key value (to be stored) */
-		lua_pushstring(L,"tolua_peer");
-		lua_rawget(L,LUA_REGISTRYINDEX);        /* stack: k v peer */
+		lua_pushvalue(L,lua_upvalueindex(1));   /* stack: k v peer */
   lua_pushvalue(L, index);
 		lua_rawget(L,-2);                       /* stack: k v peer peer[u] */
 		if (!lua_istable(L,-1))
@@ -128,8 +129,7 @@ static int class_index_event (lua_State* L)
 	if (t == LUA_TUSERDATA)
 	{
 		/* Access alternative table */
-		lua_pushstring(L,"tolua_peer");
-		lua_rawget(L,LUA_REGISTRYINDEX);        /* stack: obj key peer */
+		lua_pushvalue(L,lua_upvalueindex(1));   /* stack: obj key peer */
 		lua_pushvalue(L,1);
 		lua_rawget(L,-2);                       /* stack: obj key peer peer[u] */
 		if (lua_istable(L,-1))
@@ -347,8 +347,7 @@ static int class_gc_event (lua_State* L)
 {
   int top = lua_gettop(L);
 	 void* u = *((void**)lua_touserdata(L,1));
-  lua_pushstring(L,"tolua_gc");
-  lua_rawget(L,LUA_REGISTRYINDEX);   /* gc */
+  lua_pushvalue(L,lua_upvalueindex(1));  /* gc */
   lua_pushlightuserdata(L,u);        /* gc u */
   lua_rawget(L,-2);                  /* gc func */
   if (!lua_isnil(L, -1))
@@ -381,10 +380,10 @@ static int class_gc_event (lua_State* L)
 TOLUA_API void tolua_moduleevents (lua_State* L)
 {
 	lua_pushstring(L,"__index");
-	lua_pushcfunction(L,module_index_event);
+	tolua_pushcfunction(L,module_index_event);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__newindex");
-	lua_pushcfunction(L,module_newindex_event);
+	tolua_pushcfunction(L,module_newindex_event);
 	lua_rawset(L,-3);
 }
 
@@ -404,42 +403,50 @@ TOLUA_API int tolua_ismodulemetatable (lua_State* L)
 }
 
 /* Register class events
-	* It expects the metatable on the top of the stack
+	* It expects the metatable on the top of the stack.
+	* The index events get the peer table and the gc event gets the gc table
+	* as upvalue, so that they need no registry lookup.
 */
 TOLUA_API void tolua_classevents (lua_State* L)
 {
 	lua_pushstring(L,"__index");
-	lua_pushcfunction(L,class_index_event);
+	lua_pushlightuserdata(L,&tolua_peerkey);
+	lua_rawget(L,LUA_REGISTRYINDEX);
+	lua_pushcclosure(L,class_index_event,1);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__newindex");
-	lua_pushcfunction(L,class_newindex_event);
+	lua_pushlightuserdata(L,&tolua_peerkey);
+	lua_rawget(L,LUA_REGISTRYINDEX);
+	lua_pushcclosure(L,class_newindex_event,1);
 	lua_rawset(L,-3);
  
 	lua_pushstring(L,"__add");
-	lua_pushcfunction(L,class_add_event);
+	tolua_pushcfunction(L,class_add_event);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__sub");
-	lua_pushcfunction(L,class_sub_event);
+	tolua_pushcfunction(L,class_sub_event);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__mul");
-	lua_pushcfunction(L,class_mul_event);
+	tolua_pushcfunction(L,class_mul_event);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__div");
-	lua_pushcfunction(L,class_div_event);
+	tolua_pushcfunction(L,class_div_event);
 	lua_rawset(L,-3);
 
 	lua_pushstring(L,"__lt");
-	lua_pushcfunction(L,class_lt_event);
+	tolua_pushcfunction(L,class_lt_event);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__le");
-	lua_pushcfunction(L,class_le_event);
+	tolua_pushcfunction(L,class_le_event);
 	lua_rawset(L,-3);
 	lua_pushstring(L,"__eq");
-	lua_pushcfunction(L,class_eq_event);
+	tolua_pushcfunction(L,class_eq_event);
 	lua_rawset(L,-3);
 
 	lua_pushstring(L,"__gc");
-	lua_pushcfunction(L,class_gc_event);
+	lua_pushlightuserdata(L,&tolua_gckey);
+	lua_rawget(L,LUA_REGISTRYINDEX);
+	lua_pushcclosure(L,class_gc_event,1);
 	lua_rawset(L,-3);
 }
 
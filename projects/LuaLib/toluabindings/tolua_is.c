@@ -13,6 +13,7 @@
  */
 
 #include "tolua.h"
+#include "tolua_event.h"
 #include "lauxlib.h"
 
 #include <stdlib.h>
@@ -94,62 +95,29 @@ TOLUA_API void tolua_error (lua_State* L, const char* msg, tolua_Error* err)
 static  int lua_isusertable (lua_State* L, int lo, const char* type)
 {
   int r = 0;
-  if (lo < 0) lo = lua_gettop(L)+lo+1;
-  lua_pushvalue(L,lo);
-  lua_rawget(L,LUA_REGISTRYINDEX);  /* get registry[t] */
-  if (lua_isstring(L,-1))
+  if (lua_istable(L,lo))
   {
-    r = strcmp(lua_tostring(L,-1),type)==0;
-    if (!r)
-    {
-      /* try const */
-      lua_pushstring(L,"const ");
-      lua_insert(L,-2);
-      lua_concat(L,2);
-      r = lua_isstring(L,-1) && strcmp(lua_tostring(L,-1),type)==0;
-    }
+    lua_pushvalue(L,lo);
+    r = (tolua_typecheck(L,type) & TOLUA_CHECK_TABLE) != 0;
+    lua_pop(L, 1);
   }
-  lua_pop(L, 1);
   return r;
 }
 
 /* the equivalent of lua_is* for usertype */
 static int lua_isusertype (lua_State* L, int lo, const char* type)
 {
+  int r = 0;
   if (lua_isuserdata(L,lo))
   {
-    /* check if it is of the same type */
-    int r;
-    const char *tn;
+    /* check if it is of the same type or a specialized class */
     if (lua_getmetatable(L,lo))        /* if metatable? */
     {
-      lua_rawget(L,LUA_REGISTRYINDEX);  /* get registry[mt] */
-      tn = lua_tostring(L,-1);
-      r = tn && (strcmp(tn,type) == 0);
+      r = (tolua_typecheck(L,type) & TOLUA_CHECK_TYPE) != 0;
       lua_pop(L, 1);
-      if (r)
-        return 1;
-      else
-      {
-        /* check if it is a specialized class */
-        lua_pushstring(L,"tolua_super");
-        lua_rawget(L,LUA_REGISTRYINDEX); /* get super */
-        lua_getmetatable(L,lo);
-        lua_rawget(L,-2);                /* get super[mt] */
-        if (lua_istable(L,-1))
-        {
-          int b;
-          lua_pushstring(L,type);
-          lua_rawget(L,-2);                /* get super[mt][type] */
-          b = lua_toboolean(L,-1);
-          lua_pop(L,3);
-          if (b)
-            return 1;
-        }
-      }
     }
   }
-  return 0;
+  return r;
 }
 
 TOLUA_API int tolua_isnoobj (lua_State* L, int lo, tolua_Error* err)
@@ -29,7 +29,21 @@ TOLUA_API const char* tolua_tostring (lua_State* L, int narg, const char* def)
 
 TOLUA_API void* tolua_touserdata (lua_State* L, int narg, void* def)
 {
- return lua_gettop(L)<abs(narg) ? def : lua_touserdata(L,narg);
+ void* u;
+ if (lua_gettop(L)<abs(narg))
+  return def;
+ u = lua_touserdata(L,narg);
+ /* a full userdata whose metatable has a __pointer field holds a pointer
+    to its data, such as a pooled struct; pass that pointer */
+ if (u!=NULL && lua_type(L,narg)==LUA_TUSERDATA && lua_getmetatable(L,narg))
+ {
+  lua_pushliteral(L,"__pointer");
+  lua_rawget(L,-2);
+  if (lua_toboolean(L,-1))
+   u = *((void**)u);
+  lua_pop(L,2);
+ }
+ return u;
 }
 
 TOLUA_API void* tolua_tousertype (lua_State* L, int narg, void* def)
@@ -275,10 +275,6 @@ function MessageHeaderReceived(buffer, result)
       Connection:Read(dataSize, ScriptReceived)
     end
   end
-  -- Free the result buffer.
-  if nil ~= buffer then
-    SysFree(buffer)
-  end
 end
 
 function ScriptReceived(buffer, result)
@@ -303,10 +299,6 @@ function ScriptReceived(buffer, result)
     -- Write response.
     WriteResponse(resultOrErrorMessage)
   end
-  -- Free the result buffer.
-  if nil ~= buffer then
-    SysFree(buffer)
-  end
 end
 
 function WriteResponse(value)
@@ -317,7 +309,7 @@ function WriteResponse(value)
   local response = "Lua Result: "..value
   -- Allocate buffer for the reply, reader plus string data.
   local dataSize = response:len()
-  local buffer = SysAlloc(8 + dataSize)
+  local buffer = SysBufferCreate(8 + dataSize)
   BufferWriteInt(buffer, 0, COMMAND_REPLY)
   BufferWriteInt(buffer, 4, dataSize)
   BufferWriteString(buffer, 8, response)
@@ -326,35 +318,23 @@ end
 
 function WriteResponseDone(buffer, result)
   log("Response written - result: "..result)
-  if nil ~= buffer then SysFree(buffer) end
   ReadCommand()
 end
 
+-- Ints in messages are little endian, like in a Buffer.
 function BufferReadInt(buffer, index)
-  return SysBufferGetInt(buffer, index / 4)
+  return buffer:getInt32(index)
 end
 
 function BufferWriteInt(buffer, index, value)
-  SysBufferSetByte(buffer, index, SysBitAnd(value, 255));
-  SysBufferSetByte(buffer, index + 1, SysBitAnd(SysBitShiftRight(value, 8), 255));
-  SysBufferSetByte(buffer, index + 2, SysBitAnd(SysBitShiftRight(value, 16), 255));
-  SysBufferSetByte(buffer, index + 3, SysBitAnd(SysBitShiftRight(value, 24), 255));
+  buffer:setInt32(index, value)
 end
 
 -- Write a Lua string to a buffer.
 -- Note that in Lua first element has index one,
 -- in a C buffer first byte has index zero.
 function BufferWriteString(buffer, index, theString)
-  local bufferIndex = index
-  local stringIndex = 1
-  for c in theString:gmatch(".") do
-    local b = theString:byte(stringIndex)
-    --log("Char: "..c)
-    --log("Byte: "..b)
-    SysBufferSetByte(buffer, bufferIndex, b)
-    bufferIndex = bufferIndex + 1
-    stringIndex = stringIndex + 1
-  end
+  buffer:copy(index, theString)
 end
 
 -- Start the program
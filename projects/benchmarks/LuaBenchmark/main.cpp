@@ -0,0 +1,949 @@
+/*
+ * Copyright (c) 2011 MoSync AB
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+/*
+ * File: main.cpp
+ *
+ * Benchmarks for MobileLua. Results are printed to the screen
+ * (and to the console). Run a Release build on a device to get
+ * meaningful numbers.
+ *
+ * Build LuaLib.luac with "make bytecode" in LuaLib/host before
+ * building this project.
+ */
+
+extern "C"
+{
+#include "lua.h"
+#include "inc/SystemAPI.h"
+}
+
+#include <ma.h>
+#include <mastring.h>
+#include <conprint.h>
+#include "LuaEngine.h"
+#include "MAHeaders.h"
+
+using namespace MobileLua;
+
+/**
+ * Number of times each benchmark is repeated.
+ */
+#define ITERATIONS 20
+
+/**
+ * Number of events in the replayed event stream.
+ */
+#define EVENT_STREAM_LENGTH 2000
+
+/**
+ * Number of recorded events that arrive between two
+ * waits in the coalescing benchmark.
+ */
+#define EVENTS_PER_WAIT 10
+
+/**
+ * Number of samples per batch in the sensor batching benchmark.
+ */
+#define SENSOR_BATCH_SIZE 32
+
+/**
+ * Size of the buffers in the buffer benchmarks, and the
+ * number of operations per iteration.
+ */
+#define BUFFER_BENCHMARK_SIZE 4096
+#define BUFFER_BENCHMARK_REPEATS 50
+
+/**
+ * Distance between source and destination in the
+ * overlapping copy benchmark.
+ */
+#define BUFFER_MOVE_DISTANCE 100
+
+/**
+ * Number of calls in a binding call benchmark, per iteration.
+ */
+#define BINDING_CALLS 10000
+
+/**
+ * Number of reads in a struct field benchmark, per iteration.
+ */
+#define STRUCT_READS 10000
+
+/**
+ * Number of structs created in a struct creation benchmark,
+ * per iteration.
+ */
+#define STRUCT_CREATES 2000
+
+/**
+ * Number of pieces of a string in a string building benchmark.
+ */
+#define STRING_PIECES 2000
+
+/**
+ * Operations in the buffer benchmarks. BUFFER_MOVE copies
+ * within one buffer, to an overlapping range.
+ */
+enum BufferOperation
+{
+	BUFFER_COPY,
+	BUFFER_MOVE,
+	BUFFER_FILL,
+	BUFFER_COMPARE,
+	BUFFER_FIND,
+	BUFFER_OPERATIONS
+};
+
+static const char* sBufferOperationNames[] =
+{
+	"copy", "overlapping copy", "fill", "compare", "find"
+};
+
+/**
+ * Writes a string to a buffer in the buffer benchmark,
+ * one byte at a time or with a bulk copy.
+ */
+static const char* sBufferByteLoop =
+	"for n = 1, Repeats do\n"
+	"  for i = 1, #Text do\n"
+	"    Buf:setByte(i - 1, Text:byte(i))\n"
+	"  end\n"
+	"end\n";
+
+static const char* sBufferBulkCopy =
+	"for n = 1, Repeats do\n"
+	"  Buf:copy(0, Text)\n"
+	"end\n";
+
+/**
+ * Calls of bound MoSync functions with representative signatures,
+ * for the binding call benchmark. The drawing goes to the back
+ * buffer, which is never shown. Nop is a Lua function, for
+ * comparison.
+ */
+static const char* sBindingCalls[] =
+{
+	"Nop()",
+	"maGetMilliSecondCount()",
+	"maSetColor(0)",
+	"maPlot(0, 0)",
+	"maFillRect(0, 0, 1, 1)"
+};
+
+/**
+ * Reads of two struct fields with the getter functions and by
+ * name, for the struct field benchmark. E is an MAEvent and R
+ * an MARect.
+ */
+static const char* sStructReads[][2] =
+{
+	{ "SysEventGetX(E) + SysEventGetY(E)", "E.x + E.y" },
+	{ "SysRectGetWidth(R) + SysRectGetHeight(R)", "R.width + R.height" }
+};
+
+/**
+ * Creation of a rect that is garbage right away, as when drawing,
+ * for the struct creation benchmark. SysRectCreate takes the rect
+ * from a pool.
+ */
+static const char* sStructCreates[] =
+{
+	"SysStructCreate('MARect')",
+	"SysRectCreate()"
+};
+
+/**
+ * Ways to build a string of Pieces lines, for the string building
+ * benchmark: concatenation, table.concat and a string builder.
+ */
+static const char* sStringBuilds[][2] =
+{
+	{
+		"..",
+		"local s = ''\n"
+		"for i = 1, Pieces do\n"
+		"  s = s .. 'line ' .. i .. '\\n'\n"
+		"end\n"
+		"Result = s\n"
+	},
+	{
+		"table.concat",
+		"local t = {}\n"
+		"for i = 1, Pieces do\n"
+		"  t[#t + 1] = 'line '\n"
+		"  t[#t + 1] = i\n"
+		"  t[#t + 1] = '\\n'\n"
+		"end\n"
+		"Result = table.concat(t)\n"
+	},
+	{
+		"StringBuilder",
+		"local sb = SysStringBuilderCreate()\n"
+		"for i = 1, Pieces do\n"
+		"  sb:append('line ', i, '\\n')\n"
+		"end\n"
+		"Result = sb:toString()\n"
+	}
+};
+
+/**
+ * Event handlers used by the event loop benchmarks.
+ */
+static const char* sEventHandlers =
+	"EventCount = 0\n"
+	"local function onTouch(x, y, touchId)\n"
+	"  EventCount = EventCount + 1\n"
+	"end\n"
+	"EventMonitor:OnTouchDown(onTouch)\n"
+	"EventMonitor:OnTouchDrag(onTouch)\n"
+	"EventMonitor:OnTouchUp(onTouch)\n"
+	"EventMonitor:OnSensor(function(sensorType, x, y, z)\n"
+	"  EventCount = EventCount + 1\n"
+	"end)\n";
+
+/**
+ * Sensor handlers used by the sensor batching benchmark. Both
+ * do the same work per sample.
+ */
+static const char* sSensorHandlers =
+	"SampleSum = 0\n"
+	"function OnSample(sensorType, x, y, z)\n"
+	"  SampleSum = SampleSum + x\n"
+	"end\n"
+	"function OnSampleBatch(samples, count)\n"
+	"  local sum = SampleSum\n"
+	"  for i = 2, count * 4, 4 do\n"
+	"    sum = sum + samples[i]\n"
+	"  end\n"
+	"  SampleSum = sum\n"
+	"end\n";
+
+/**
+ * The event stream replayed by replayGetEvent.
+ */
+static MAEvent* sReplayEvents;
+static int sReplayCount;
+static int sReplayIndex;
+
+/**
+ * Measure the time it takes to initialize an engine, with
+ * the MoSync API bound lazily or all at once.
+ * @param lazy true for lazy bindings.
+ * @param memory Set to the number of bytes Lua has
+ * allocated after initialize.
+ * @return Time in milliseconds for ITERATIONS engines.
+ */
+static int benchmarkInitialize(bool lazy, int* memory)
+{
+	int total = 0;
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		LuaEngine engine;
+		engine.setLazyBindings(lazy);
+
+		int start = maGetMilliSecondCount();
+		engine.initialize();
+		total += maGetMilliSecondCount() - start;
+
+		*memory = engine.getMemoryInUse();
+	}
+	return total;
+}
+
+/**
+ * Measure the time and memory it takes to load and run the
+ * Lua library in a fresh engine. Engine initialization is
+ * not included.
+ * @param luaLib Resource with the library, source or bytecode.
+ * @param peakMemory Set to the highest number of bytes that
+ * Lua allocated during the load, on top of the initialized engine.
+ * @return Average time in milliseconds.
+ */
+static int benchmarkLoadLuaLib(MAHandle luaLib, int* peakMemory)
+{
+	int total = 0;
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		LuaEngine engine;
+		engine.initialize();
+		int memoryBefore = engine.getMemoryInUse();
+		engine.resetMemoryPeak();
+
+		int start = maGetMilliSecondCount();
+		engine.eval(luaLib);
+		total += maGetMilliSecondCount() - start;
+
+		*peakMemory = engine.getMemoryPeak() - memoryBefore;
+	}
+	return total / ITERATIONS;
+}
+
+/**
+ * Fill in a recorded event stream: touch gestures of
+ * pointer drags, interleaved with accelerometer samples.
+ * This is what LuaPaint gets while painting with a sensor on.
+ */
+static void createEventStream(MAEvent* events, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		MAEvent& event = events[i];
+		if (1 == i % 2)
+		{
+			event.type = EVENT_TYPE_SENSOR;
+			event.sensor.type = SENSOR_TYPE_ACCELEROMETER;
+			event.sensor.values[0] = 0.01f * (i % 100);
+			event.sensor.values[1] = 0.5f;
+			event.sensor.values[2] = -9.81f;
+		}
+		else
+		{
+			if (0 == i % 100)
+			{
+				event.type = EVENT_TYPE_POINTER_PRESSED;
+			}
+			else if (98 == i % 100)
+			{
+				event.type = EVENT_TYPE_POINTER_RELEASED;
+			}
+			else
+			{
+				event.type = EVENT_TYPE_POINTER_DRAGGED;
+			}
+			event.point.x = i % 240;
+			event.point.y = (i / 2) % 320;
+			event.touchId = 0;
+		}
+	}
+}
+
+/**
+ * Replaces maGetEvent in Lua, to run the Lua event loop on
+ * the recorded stream. Ends the stream with a close event.
+ */
+static int replayGetEvent(lua_State* L)
+{
+	MAEvent* event = (MAEvent*) lua_touserdata(L, 1);
+	int result = 1;
+	if (sReplayIndex < sReplayCount)
+	{
+		*event = sReplayEvents[sReplayIndex];
+	}
+	else if (sReplayIndex == sReplayCount)
+	{
+		event->type = EVENT_TYPE_CLOSE;
+	}
+	else
+	{
+		result = 0;
+	}
+	++sReplayIndex;
+	lua_pushinteger(L, result);
+	return 1;
+}
+
+/**
+ * Replaces maWait in Lua, there is no need to wait
+ * for recorded events.
+ */
+static int replayWait(lua_State* L)
+{
+	return 0;
+}
+
+/**
+ * Measure how fast recorded events are delivered to Lua
+ * handlers, by the native event loop or by the Lua event loop.
+ * @param events The recorded events.
+ * @param count The number of events.
+ * @param native true to use the native dispatcher, false to
+ * run EventMonitor:RunLuaEventLoop.
+ * @return Events per second.
+ */
+static int benchmarkEventLoop(MAEvent* events, int count, bool native)
+{
+	LuaEngine engine;
+	engine.initialize();
+	engine.eval(LUALIB_BYTECODE);
+	engine.eval(sEventHandlers);
+
+	lua_State* L = (lua_State*) engine.mLuaState;
+	lua_register(L, "maGetEvent", replayGetEvent);
+	lua_register(L, "maWait", replayWait);
+	sReplayEvents = events;
+	sReplayCount = count;
+
+	int start = maGetMilliSecondCount();
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		if (native)
+		{
+			for (int j = 0; j < count; ++j)
+			{
+				engine.dispatchEvent(events[j]);
+			}
+		}
+		else
+		{
+			sReplayIndex = 0;
+			engine.eval("EventMonitor:RunLuaEventLoop()");
+		}
+	}
+	int time = maGetMilliSecondCount() - start;
+
+	// Check that the handlers got all events.
+	lua_getglobal(L, "EventCount");
+	if (lua_tointeger(L, -1) != count * ITERATIONS)
+	{
+		printf("Event count mismatch: %i\n", (int) lua_tointeger(L, -1));
+	}
+	lua_pop(L, 1);
+
+	return (0 == time) ? 0 : (count * ITERATIONS * 1000) / time;
+}
+
+/**
+ * Measure the native event loop with coalescing of drag
+ * and sensor events. The recorded events are posted in groups
+ * of EVENTS_PER_WAIT, as if that many arrived between two waits.
+ * @param events The recorded events.
+ * @param count The number of events.
+ * @param handlerCalls Set to the number of Lua handler calls
+ * per replay of the stream.
+ * @return Events per second.
+ */
+static int benchmarkCoalescing(MAEvent* events, int count, int* handlerCalls)
+{
+	LuaEngine engine;
+	engine.initialize();
+	engine.eval(LUALIB_BYTECODE);
+	engine.eval(sEventHandlers);
+	engine.setEventCoalescing(true, true);
+
+	int start = maGetMilliSecondCount();
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		for (int j = 0; j < count; ++j)
+		{
+			engine.postEvent(events[j]);
+			if (0 == (j + 1) % EVENTS_PER_WAIT)
+			{
+				engine.flushEvents();
+			}
+		}
+		engine.flushEvents();
+	}
+	int time = maGetMilliSecondCount() - start;
+
+	lua_State* L = (lua_State*) engine.mLuaState;
+	lua_getglobal(L, "EventCount");
+	*handlerCalls = lua_tointeger(L, -1) / ITERATIONS;
+	lua_pop(L, 1);
+
+	// All events are either delivered or merged.
+	int merged = engine.getMergedDragEvents()
+		+ engine.getMergedSensorEvents();
+	if (merged + *handlerCalls * ITERATIONS != count * ITERATIONS)
+	{
+		printf("Coalescing lost events: %i\n", merged);
+	}
+
+	return (0 == time) ? 0 : (count * ITERATIONS * 1000) / time;
+}
+
+/**
+ * Measure how fast synthetic accelerometer samples are delivered
+ * to Lua, one handler call per sample or in batches.
+ * @param count The number of samples.
+ * @param batched true to use EventMonitor:OnSensorBatch,
+ * false to use EventMonitor:OnSensor.
+ * @param sum Set to the sum computed by the Lua handler, to
+ * check that all samples arrived.
+ * @return Samples per second.
+ */
+static int benchmarkSensorEvents(int count, bool batched, double* sum)
+{
+	LuaEngine engine;
+	engine.initialize();
+	engine.eval(LUALIB_BYTECODE);
+	engine.eval(sSensorHandlers);
+	if (batched)
+	{
+		char script[64];
+		sprintf(script,
+			"EventMonitor:OnSensorBatch(OnSampleBatch, %i)",
+			SENSOR_BATCH_SIZE);
+		engine.eval(script);
+	}
+	else
+	{
+		engine.eval("EventMonitor:OnSensor(OnSample)");
+	}
+
+	MAEvent event;
+	event.type = EVENT_TYPE_SENSOR;
+	event.sensor.type = SENSOR_TYPE_ACCELEROMETER;
+
+	int start = maGetMilliSecondCount();
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		for (int j = 0; j < count; ++j)
+		{
+			event.sensor.values[0] = 0.01f * (j % 100);
+			event.sensor.values[1] = 0.5f;
+			event.sensor.values[2] = -9.81f;
+			engine.postEvent(event);
+		}
+		engine.deliverSensorBatch();
+	}
+	int time = maGetMilliSecondCount() - start;
+
+	lua_State* L = (lua_State*) engine.mLuaState;
+	lua_getglobal(L, "SampleSum");
+	*sum = lua_tonumber(L, -1);
+	lua_pop(L, 1);
+
+	return (0 == time) ? 0 : (count * ITERATIONS * 1000) / time;
+}
+
+/**
+ * Run a buffer operation on size bytes one byte at a time,
+ * like SysBufferCopyBytes used to copy.
+ */
+static int runBufferByteLoop(int operation, byte* a, byte* b, int size)
+{
+	int result = 0;
+	switch (operation)
+	{
+		case BUFFER_COPY:
+			for (int i = 0; i < size; ++i)
+			{
+				b[i] = a[i];
+			}
+			break;
+		case BUFFER_MOVE:
+			for (int i = size - 1; i >= 0; --i)
+			{
+				a[i + BUFFER_MOVE_DISTANCE] = a[i];
+			}
+			break;
+		case BUFFER_FILL:
+			for (int i = 0; i < size; ++i)
+			{
+				a[i] = 0xAA;
+			}
+			break;
+		case BUFFER_COMPARE:
+			for (int i = 0; i < size && 0 == result; ++i)
+			{
+				result = a[i] - b[i];
+			}
+			break;
+		case BUFFER_FIND:
+			result = -1;
+			for (int i = 0; i < size; ++i)
+			{
+				if (0xFF == a[i])
+				{
+					result = i;
+					break;
+				}
+			}
+			break;
+	}
+	return result;
+}
+
+/**
+ * Run a buffer operation on size bytes with the bulk
+ * buffer functions.
+ */
+static int runBufferBulk(int operation, byte* a, byte* b, int size)
+{
+	switch (operation)
+	{
+		case BUFFER_COPY:
+			SysBufferCopyBytes(a, 0, b, 0, size);
+			return 0;
+		case BUFFER_MOVE:
+			SysBufferCopyBytes(a, 0, a, BUFFER_MOVE_DISTANCE, size);
+			return 0;
+		case BUFFER_FILL:
+			SysBufferFillBytes(a, 0, 0xAA, size);
+			return 0;
+		case BUFFER_COMPARE:
+			return SysBufferCompareBytes(a, 0, b, 0, size);
+		case BUFFER_FIND:
+			return SysBufferFindByte(a, 0, size, 0xFF);
+	}
+	return 0;
+}
+
+/**
+ * Measure a buffer operation on BUFFER_BENCHMARK_SIZE bytes.
+ * Compare and find run over equal buffers without a match,
+ * so they go through all bytes.
+ * @param operation One of the BufferOperation values.
+ * @param bulk true to use the bulk buffer functions, false
+ * to loop over the bytes.
+ * @return Kilobytes per second.
+ */
+static int benchmarkBufferOperation(int operation, bool bulk)
+{
+	// Room for the overlapping copy.
+	int size = BUFFER_BENCHMARK_SIZE + BUFFER_MOVE_DISTANCE;
+	byte* a = new byte[size];
+	byte* b = new byte[size];
+	memset(a, 0x55, size);
+	memset(b, 0x55, size);
+
+	int check = 0;
+	int start = maGetMilliSecondCount();
+	for (int i = 0; i < ITERATIONS * BUFFER_BENCHMARK_REPEATS; ++i)
+	{
+		if (bulk)
+		{
+			check += runBufferBulk(operation, a, b, BUFFER_BENCHMARK_SIZE);
+		}
+		else
+		{
+			check += runBufferByteLoop(operation, a, b, BUFFER_BENCHMARK_SIZE);
+		}
+		// Keep compare and find from matching.
+		a[0] = b[0] = 0x55;
+	}
+	int time = maGetMilliSecondCount() - start;
+
+	delete[] a;
+	delete[] b;
+
+	// Find gives -1 when there is no match.
+	int expected = (BUFFER_FIND == operation)
+		? -ITERATIONS * BUFFER_BENCHMARK_REPEATS : 0;
+	if (expected != check)
+	{
+		printf("Buffer %s gave a wrong result\n",
+			sBufferOperationNames[operation]);
+	}
+
+	int kilobytes = (BUFFER_BENCHMARK_SIZE / 1024)
+		* ITERATIONS * BUFFER_BENCHMARK_REPEATS;
+	return (0 == time) ? 0 : (kilobytes * 1000) / time;
+}
+
+/**
+ * Measure writing a Lua string to a Buffer, one byte at a
+ * time or with Buffer:copy.
+ * @param bulk true to use Buffer:copy.
+ * @return Kilobytes per second.
+ */
+static int benchmarkBufferWriteString(bool bulk)
+{
+	LuaEngine engine;
+	engine.initialize();
+
+	char script[128];
+	sprintf(script,
+		"Buf = SysBufferCreate(%i)\n"
+		"Text = string.rep('x', %i)\n"
+		"Repeats = %i\n",
+		BUFFER_BENCHMARK_SIZE,
+		BUFFER_BENCHMARK_SIZE,
+		ITERATIONS);
+	engine.eval(script);
+
+	int start = maGetMilliSecondCount();
+	engine.eval(bulk ? sBufferBulkCopy : sBufferByteLoop);
+	int time = maGetMilliSecondCount() - start;
+
+	int kilobytes = (BUFFER_BENCHMARK_SIZE / 1024) * ITERATIONS;
+	return (0 == time) ? 0 : (kilobytes * 1000) / time;
+}
+
+/**
+ * Measure the overhead of calling a bound function from Lua: the
+ * argument checks and conversions of the generated wrapper. Compare
+ * bindings generated with and without the tolua -F option, and
+ * LuaLib built with and without TOLUA_RELEASE.
+ * @param call A call from sBindingCalls.
+ * @return Calls per second.
+ */
+static int benchmarkBindingCall(const char* call)
+{
+	LuaEngine engine;
+	engine.initialize();
+	engine.eval("function Nop() end");
+
+	char script[128];
+	sprintf(script,
+		"for i = 1, %i do\n"
+		"  %s\n"
+		"end\n",
+		BINDING_CALLS * ITERATIONS,
+		call);
+
+	int start = maGetMilliSecondCount();
+	engine.eval(script);
+	int time = maGetMilliSecondCount() - start;
+
+	return (0 == time) ? 0 : (BINDING_CALLS * ITERATIONS / time) * 1000;
+}
+
+/**
+ * Measure reading struct fields from Lua, with the getter
+ * functions or by name through the struct metatable.
+ * @param expression An expression from sStructReads.
+ * @return Expressions per second.
+ */
+static int benchmarkStructReads(const char* expression)
+{
+	LuaEngine engine;
+	engine.initialize();
+	engine.eval(
+		"E = SysStructCreate('MAEvent')\n"
+		"E.x, E.y = 10, 20\n"
+		"R = SysStructCreate('MARect')\n"
+		"R.width, R.height = 30, 40\n");
+
+	char script[160];
+	sprintf(script,
+		"local E, R = E, R\n"
+		"for i = 1, %i do\n"
+		"  local v = %s\n"
+		"end\n",
+		STRUCT_READS * ITERATIONS,
+		expression);
+
+	int start = maGetMilliSecondCount();
+	engine.eval(script);
+	int time = maGetMilliSecondCount() - start;
+
+	return (0 == time) ? 0 : (STRUCT_READS * ITERATIONS / time) * 1000;
+}
+
+/**
+ * Measure creating structs.
+ * @param expression Lua expression that creates a struct.
+ * @param misses Set to the number of times the rect pool grew.
+ * @return Structs per second.
+ */
+static int benchmarkStructCreates(const char* expression, int* misses)
+{
+	LuaEngine engine;
+	engine.initialize();
+
+	char script[160];
+	sprintf(script,
+		"for i = 1, %i do\n"
+		"  local r = %s\n"
+		"  r.width = i\n"
+		"end\n",
+		STRUCT_CREATES * ITERATIONS,
+		expression);
+
+	lua_State* L = (lua_State*) engine.mLuaState;
+	engine.eval("PoolMisses = SysStructGetPoolStats().MARect.misses");
+	lua_getglobal(L, "PoolMisses");
+	int missesBefore = lua_tointeger(L, -1);
+	lua_pop(L, 1);
+
+	int start = maGetMilliSecondCount();
+	engine.eval(script);
+	int time = maGetMilliSecondCount() - start;
+
+	engine.eval("PoolMisses = SysStructGetPoolStats().MARect.misses");
+	lua_getglobal(L, "PoolMisses");
+	*misses = lua_tointeger(L, -1) - missesBefore;
+	lua_pop(L, 1);
+
+	return (0 == time) ? 0 : (STRUCT_CREATES * ITERATIONS / time) * 1000;
+}
+
+/**
+ * Measure building a string.
+ * @param script Lua code that builds the string in Result.
+ * @param length Set to the length of the string.
+ * @return Strings per second.
+ */
+static int benchmarkStringBuild(const char* script, int* length)
+{
+	LuaEngine engine;
+	engine.initialize();
+
+	lua_State* L = (lua_State*) engine.mLuaState;
+	lua_pushinteger(L, STRING_PIECES);
+	lua_setglobal(L, "Pieces");
+
+	int start = maGetMilliSecondCount();
+	for (int i = 0; i < ITERATIONS; ++i)
+	{
+		engine.eval(script);
+	}
+	int time = maGetMilliSecondCount() - start;
+
+	lua_getglobal(L, "Result");
+	*length = (int) lua_objlen(L, -1);
+	lua_pop(L, 1);
+
+	return (0 == time) ? 0 : (ITERATIONS * 1000) / time;
+}
+
+/**
+ * Wait for a key press or a close event.
+ */
+static void waitForExit()
+{
+	MAEvent event;
+	while (true)
+	{
+		maWait(0);
+		while (maGetEvent(&event))
+		{
+			if (EVENT_TYPE_CLOSE == event.type ||
+				EVENT_TYPE_KEY_PRESSED == event.type)
+			{
+				return;
+			}
+		}
+	}
+}
+
+extern "C" int MAMain()
+{
+	printf("LuaBenchmark (%i iterations)\n", ITERATIONS);
+
+	// Startup: binding the MoSync API on first access versus
+	// binding all of it in initialize.
+	int lazyMemory;
+	int eagerMemory;
+	int lazyTime = benchmarkInitialize(true, &lazyMemory);
+	int eagerTime = benchmarkInitialize(false, &eagerMemory);
+	printf("Initialize, lazy bindings: %i ms, %i bytes\n",
+		lazyTime, lazyMemory);
+	printf("Initialize, eager bindings: %i ms, %i bytes\n",
+		eagerTime, eagerMemory);
+
+	// Startup: parsing LuaLib.lua versus loading precompiled bytecode.
+	// The resources are streamed in blocks, so the peak memory does
+	// not include a copy of the whole resource.
+	int sourcePeak;
+	int bytecodePeak;
+	int sourceTime = benchmarkLoadLuaLib(LUALIB, &sourcePeak);
+	int bytecodeTime = benchmarkLoadLuaLib(LUALIB_BYTECODE, &bytecodePeak);
+	printf("Load LuaLib source: %i ms, peak %i bytes\n",
+		sourceTime, sourcePeak);
+	printf("Load LuaLib bytecode: %i ms, peak %i bytes\n",
+		bytecodeTime, bytecodePeak);
+	printf("LuaLib resource size: %i bytes\n", maGetDataSize(LUALIB));
+
+	// Event dispatch: the native event loop versus the Lua
+	// event loop, on a recorded stream of drag and sensor events.
+	MAEvent* events = new MAEvent[EVENT_STREAM_LENGTH];
+	createEventStream(events, EVENT_STREAM_LENGTH);
+	int luaLoopRate = benchmarkEventLoop(events, EVENT_STREAM_LENGTH, false);
+	int nativeLoopRate = benchmarkEventLoop(events, EVENT_STREAM_LENGTH, true);
+	printf("Lua event loop: %i events/s\n", luaLoopRate);
+	printf("Native event loop: %i events/s\n", nativeLoopRate);
+
+	// Coalescing: handler calls per replay, when the events
+	// arrive in groups of EVENTS_PER_WAIT.
+	int handlerCalls;
+	int coalescingRate = benchmarkCoalescing(
+		events, EVENT_STREAM_LENGTH, &handlerCalls);
+	printf("Coalescing event loop: %i events/s, %i of %i handler calls\n",
+		coalescingRate, handlerCalls, EVENT_STREAM_LENGTH);
+	delete[] events;
+
+	// Sensor samples: one handler call per sample versus
+	// batches of SENSOR_BATCH_SIZE samples.
+	double sampleSum;
+	double batchSum;
+	int sampleRate = benchmarkSensorEvents(
+		EVENT_STREAM_LENGTH, false, &sampleSum);
+	int batchRate = benchmarkSensorEvents(
+		EVENT_STREAM_LENGTH, true, &batchSum);
+	printf("Sensor samples one by one: %i samples/s\n", sampleRate);
+	printf("Sensor samples in batches of %i: %i samples/s\n",
+		SENSOR_BATCH_SIZE, batchRate);
+	if (sampleSum != batchSum)
+	{
+		printf("Sensor batching lost samples\n");
+	}
+
+	// Buffers: the bulk buffer functions versus byte loops.
+	for (int i = 0; i < BUFFER_OPERATIONS; ++i)
+	{
+		int byteLoopRate = benchmarkBufferOperation(i, false);
+		int bulkRate = benchmarkBufferOperation(i, true);
+		printf("Buffer %s: %i KB/s byte loop, %i KB/s bulk\n",
+			sBufferOperationNames[i], byteLoopRate, bulkRate);
+	}
+	int stringLoopRate = benchmarkBufferWriteString(false);
+	int stringCopyRate = benchmarkBufferWriteString(true);
+	printf("Buffer write string: %i KB/s setByte, %i KB/s copy\n",
+		stringLoopRate, stringCopyRate);
+
+	// Binding calls: per-call overhead of the generated wrappers.
+	int callCount = sizeof(sBindingCalls) / sizeof(sBindingCalls[0]);
+	for (int i = 0; i < callCount; ++i)
+	{
+		printf("Call %s: %i calls/s\n",
+			sBindingCalls[i], benchmarkBindingCall(sBindingCalls[i]));
+	}
+
+	// Struct fields: getter functions versus field names.
+	int structCount = sizeof(sStructReads) / sizeof(sStructReads[0]);
+	for (int i = 0; i < structCount; ++i)
+	{
+		printf("Read %s: %i/s\n",
+			sStructReads[i][0], benchmarkStructReads(sStructReads[i][0]));
+		printf("Read %s: %i/s\n",
+			sStructReads[i][1], benchmarkStructReads(sStructReads[i][1]));
+	}
+
+	// Struct creation: garbage collected structs versus pooled.
+	int createCount = sizeof(sStructCreates) / sizeof(sStructCreates[0]);
+	for (int i = 0; i < createCount; ++i)
+	{
+		int misses;
+		int rate = benchmarkStructCreates(sStructCreates[i], &misses);
+		printf("Create %s: %i/s, %i pool misses\n",
+			sStructCreates[i], rate, misses);
+	}
+
+	// String building: concatenation versus a string builder.
+	int buildCount = sizeof(sStringBuilds) / sizeof(sStringBuilds[0]);
+	for (int i = 0; i < buildCount; ++i)
+	{
+		int length;
+		int rate = benchmarkStringBuild(sStringBuilds[i][1], &length);
+		printf("Build %i byte string with %s: %i/s\n",
+			length, sStringBuilds[i][0], rate);
+	}
+
+	printf("Press any key to exit\n");
+	waitForExit();
+
+	return 0;
+}
@@ -30,6 +30,9 @@ This is a Lua library built directly on top of the MoSync API.
 
 Call EventMonitor:RunEventLoop() to enter the MoSync event loop.
 This can be done from Lua or from C/C++ by evaluating Lua code.
+The event loop runs natively in the LuaEngine, which calls the
+functions registered with the EventMonitor. The Lua version of the
+loop is kept as EventMonitor:RunLuaEventLoop().
 ]]
 
 -- Create the global EventMonitor object.
@@ -51,36 +54,64 @@ EventMonitor = (function ()
   -- application by setting EventMonitor.WaitTime = <value>
   self.WaitTime = 0
 
+  -- The native event loop calls this function for all
+  -- connection events.
+  local connectionDispatcher = function(connection, opType, result)
+    local connectionFun = connectionFuns[connection]
+    if nil ~= connectionFun then
+      connectionFun(connection, opType, result)
+    end
+  end
+  SysEventLoopSetHandler(EVENT_TYPE_CONN, connectionDispatcher)
+
   self.OnTouchDown = function(self, fun)
     touchDownFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_POINTER_PRESSED, fun)
   end
 
   self.OnTouchUp = function(self, fun)
     touchUpFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_POINTER_RELEASED, fun)
   end
 
   self.OnTouchDrag = function(self, fun)
     touchDragFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_POINTER_DRAGGED, fun)
   end
 
   self.OnKeyDown = function(self, fun)
     keyDownFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_KEY_PRESSED, fun)
   end
 
   self.OnKeyUp = function(self, fun)
     keyUpFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_KEY_RELEASED, fun)
   end
 
   self.OnSensor = function(self, fun)
     sensorFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_SENSOR, fun)
+  end
+
+  -- Get sensor events in batches of samples, or when the
+  -- oldest sample is milliseconds old. The function gets a
+  -- table with four numbers per sample (sensor type, x, y, z)
+  -- and the number of samples. The table is reused for each
+  -- batch. Replaces OnSensor while set,
+  -- pass nil to stop batching. Only used by RunEventLoop.
+  self.OnSensorBatch = function(self, fun, samples, milliseconds)
+    SysEventLoopSetSensorBatchHandler(fun, samples, milliseconds)
   end
 
   self.OnWidget = function(self, fun)
     widgetFun = fun
+    SysEventLoopSetHandler(EVENT_TYPE_WIDGET, fun)
   end
 
   self.OnAny = function(self, fun)
     anyFun = fun
+    SysEventLoopSetHandler(0, fun)
   end
 
   self.SetConnectionFun = function(self, connection, fun)
@@ -91,14 +122,34 @@ EventMonitor = (function ()
     connectionFuns[connection] = nil
   end
   
+  -- Merge drag events and/or sensor events that arrive faster
+  -- than they are handled, so that only the latest is passed
+  -- to the On functions. Only used by RunEventLoop.
+  self.SetCoalescing = function(self, dragEvents, sensorEvents)
+    SysEventLoopSetCoalescing(dragEvents, sensorEvents)
+  end
+
   self.ExitEventLoop = function(self)
     isRunning = false
+    SysEventLoopExit()
   end
 
+  -- Run the native event loop. An error in an event handler
+  -- stops the loop and is raised again here.
   self.RunEventLoop = function(self)
+    local success, message = SysEventLoopRun(self.WaitTime)
+    if not success then
+      error(message, 0)
+    end
+  end
+
+  -- Run the event loop in Lua. This is slower than
+  -- RunEventLoop, since every event is decoded by Lua code.
+  self.RunLuaEventLoop = function(self)
 
-    -- Create a MoSync event object.
-    local event = SysEventCreate()
+    -- Create a MoSync event object. Its fields are read by
+    -- name, and it can also be passed to the SysEventGet functions.
+    local event = SysStructCreate("MAEvent")
 
     -- Set isRunning flag to true.
     isRunning = true
@@ -107,58 +158,46 @@ EventMonitor = (function ()
     while isRunning do
       maWait(self.WaitTime)
       while isRunning and 0 ~= maGetEvent(event) do
-        local eventType = SysEventGetType(event)
+        local eventType = event.type
         if EVENT_TYPE_CLOSE == eventType then
           isRunning = false
           break -- Exit inner while loop.
         elseif EVENT_TYPE_KEY_PRESSED == eventType then
           if nil ~= keyDownFun then
-            keyDownFun(SysEventGetKey(event))
+            keyDownFun(event.key)
           end
         elseif EVENT_TYPE_KEY_RELEASED == eventType then
           if nil ~= keyUpFun then
-            keyUpFun(SysEventGetKey(event))
+            keyUpFun(event.key)
           end
         elseif EVENT_TYPE_POINTER_PRESSED == eventType then
           if nil ~= touchDownFun then
-            touchDownFun(
-              SysEventGetX(event),
-              SysEventGetY(event),
-              SysEventGetTouchId(event))
+            touchDownFun(event.x, event.y, event.touchId)
           end
         elseif EVENT_TYPE_POINTER_RELEASED == eventType then
           if nil ~= touchUpFun then
-            touchUpFun(
-              SysEventGetX(event),
-              SysEventGetY(event),
-              SysEventGetTouchId(event))
+            touchUpFun(event.x, event.y, event.touchId)
           end
         elseif EVENT_TYPE_POINTER_DRAGGED == eventType then
           if nil ~= touchDragFun then
-            touchDragFun(
-              SysEventGetX(event),
-              SysEventGetY(event),
-              SysEventGetTouchId(event))
+            touchDragFun(event.x, event.y, event.touchId)
           end
         elseif EVENT_TYPE_CONN == eventType then
-          local connectionFun = connectionFuns[SysEventGetConnHandle(event)]
+          local connectionFun = connectionFuns[event.connHandle]
           if nil ~= connectionFun then
-            connectionFun(
-              SysEventGetConnHandle(event),
-              SysEventGetConnOpType(event),
-              SysEventGetConnResult(event))
+            connectionFun(event.connHandle, event.connOpType, event.connResult)
           end
         elseif EVENT_TYPE_SENSOR == eventType then
           if nil ~= sensorFun then
             sensorFun(
-              SysEventSensorGetType(event),
-              SysEventSensorGetValue1(event),
-              SysEventSensorGetValue2(event),
-              SysEventSensorGetValue3(event))
+              event.sensorType,
+              event.sensorValue1,
+              event.sensorValue2,
+              event.sensorValue3)
           end
         elseif EVENT_TYPE_WIDGET == eventType then
           if nil ~= widgetFun then
-            widgetFun(SysEventGetData(event))
+            widgetFun(event.data)
           end
         end -- End of ifs
 
@@ -167,12 +206,15 @@ EventMonitor = (function ()
           anyFun(event, result)
         end
       end -- End of inner event loop
-    end -- End of outer event loop
 
-    -- Free the event object.
-    SysFree(event)
+      -- There are no pending events, let the garbage collector
+      -- do some work while the application is idle.
+      if isRunning then
+        SysLuaEngineIdle()
+      end
+    end -- End of outer event loop
 
-  end -- End of function runEventLoop
+  end -- End of function RunLuaEventLoop
 
   return self
 
@@ -264,8 +306,8 @@ Connection.Create = function(notUsed)
           mReadDoneFun(mInBuffer, result)
         end
       else
-        -- There was an error, free input buffer and report it.
-        SysFree(mInBuffer)
+        -- There was an error, drop the input buffer and report it.
+        mInBuffer = nil
         mReadDoneFun(nil, result)
       end
     elseif CONNOP_WRITE == opType then
@@ -315,9 +357,9 @@ Connection.Create = function(notUsed)
     mNumberOfBytesRead = 0
     mReadDoneFun = readDoneFun
     -- Allocate input buffer. This will be handed to the readDoneFun
-    -- on success. That function is responsible for deallocating it.
+    -- on success. It is a Buffer, which is garbage collected.
     -- We add one byte for a zero termination character.
-    mInBuffer = SysAlloc(mNumberOfBytesToRead + 1)
+    mInBuffer = SysBufferCreate(mNumberOfBytesToRead + 1)
     -- Start reading bytes into the input buffer.
     maConnRead(mConnectionHandle, mInBuffer, mNumberOfBytesToRead)
     return true
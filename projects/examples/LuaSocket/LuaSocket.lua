@@ -66,7 +66,7 @@ Create function called on a connection event.
 ]]
 function CreateConnectionListener()
 
-  local outBuffer = SysAlloc(1000)
+  local request = SysStringBuilderCreate()
   local inBuffer = SysAlloc(1000)
 
   return function(connection, opType, result)
@@ -78,10 +78,13 @@ function CreateConnectionListener()
     -- if this is successful we write a request to get a web page.
     if CONNOP_CONNECT == opType and result > 0 then
       print("CONNOP_CONNECT successful, writing request.")
-      local numberOfBytes = WriteStringToBuffer(
-        "GET /index.html HTTP/1.0\r\nHost: www.openplay.se\r\n\r\n",
-        outBuffer)
-      maConnWrite(connection, outBuffer, numberOfBytes)
+      -- The bytes of the builder are written without a copy, so it
+      -- must not change until the write is done.
+      request:append(
+        "GET /index.html HTTP/1.0\r\n",
+        "Host: www.openplay.se\r\n",
+        "\r\n")
+      maConnWrite(connection, request, request:size())
 
     -- Next we get a confirm of the write operation, if successful
     -- we read the response.
@@ -100,7 +103,6 @@ function CreateConnectionListener()
       PrintBuffer(inBuffer, result)
       -- Clean up.
       SysFree(inBuffer)
-      SysFree(outBuffer)
       EventMonitor:RemoveConnectionFun(connection)
       maConnClose(connection)
       -- Print message.
@@ -111,25 +113,6 @@ function CreateConnectionListener()
   end
 end
 
---[[ 
-Copy string char values to a C buffer.
-Note that in Lua first element has index one,
-in a C buffer first byte has index zero.
-]]
-function WriteStringToBuffer(s, buffer)
-  --print(s)
-  local i = 0
-  for c in s:gmatch(".") do
-    i = i + 1
-    local b = s:byte(i)
-    --print("Char: " .. c)
-    --print("Byte: " .. b)
-    SysBufferSetByte(buffer, i - 1, b)
-  end
-  -- Return number of bytes written to buffer.
-  return i
-end
-
 function PrintBuffer(buffer, size)
   local line = ""
   for i = 0, size - 1 do
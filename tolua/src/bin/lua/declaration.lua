@@ -169,7 +169,44 @@ function classDeclaration:outchecktype (narg,var)
 	end
 end
 
-function classDeclaration:builddeclaration (narg, cplusplus)
+-- check if the argument can be decoded in fast mode (-F):
+-- a basic type, passed by value, with no default and no dimension
+function classDeclaration:isfast ()
+ local t = isbasic(self.type)
+ return (t=='number' or t=='string' or t=='userdata' or t=='boolean' or t=='state') and
+        self.dim == '' and self.def == '' and self.ret == ''
+end
+
+-- output type checking in fast mode
+-- A wrong argument raises the error with luaL_typerror.
+function classDeclaration:outfastcheck (narg)
+ outfastcheck(isbasic(self.type),narg)
+end
+
+-- output the fast mode check of an argument of the given basic type
+function outfastcheck (t, narg)
+ if t == 'state' then
+  return
+ elseif t == 'number' then
+  output(' if (lua_type(tolua_S,'..narg..') != LUA_TNUMBER)\n')
+ elseif t == 'boolean' then
+  output(' if (!lua_isboolean(tolua_S,'..narg..') && !lua_isnil(tolua_S,'..narg..'))\n')
+ else
+  output(' if (!lua_is'..t..'(tolua_S,'..narg..') && !lua_isnil(tolua_S,'..narg..'))\n')
+ end
+ output('  return luaL_typerror(tolua_S,'..narg..',"'..t..'");')
+end
+
+-- check if a number type is decoded as an integer in fast mode:
+-- signed integer types are, floating point and unsigned types
+-- go through lua_Number so that their full range is kept
+function isfastinteger (mod, type)
+ local m,t = applytypedef(gsub(type,'const ',''))
+ m = mod..' '..m..' '..t
+ return not strfind(m,'unsigned') and t ~= 'float' and t ~= 'double'
+end
+
+function classDeclaration:builddeclaration (narg, cplusplus, fast)
  local array = self.dim ~= '' and tonumber(self.dim)==nil
 	local line = ""
  local ptr = ''
@@ -221,7 +258,13 @@ function classDeclaration:builddeclaration (narg, cplusplus)
 		end
   local def = 0
   if self.def ~= '' then def = self.def end
-  if t then
+  if fast and t=='number' then
+   if isfastinteger(self.mod,type) then
+    line = concatparam(line,'lua_tointeger(tolua_S,',narg,'));')
+   else
+    line = concatparam(line,'lua_tonumber(tolua_S,',narg,'));')
+   end
+  elseif t then
 		  if t=='function' then t='value' end
    line = concatparam(line,'tolua_to'..t,'(tolua_S,',narg,',',def,'));')
   else
@@ -233,7 +276,7 @@ function classDeclaration:builddeclaration (narg, cplusplus)
 end
 
 -- Declare variable
-function classDeclaration:declare (narg)
+function classDeclaration:declare (narg, fast)
  if self.dim ~= '' and self.type~='char' and tonumber(self.dim)==nil then
 	 output('#ifdef __cplusplus\n')
 		output(self:builddeclaration(narg,true))
@@ -241,7 +284,7 @@ function classDeclaration:declare (narg)
 		output(self:builddeclaration(narg,false))
 	 output('#endif\n')
 	else
-		output(self:builddeclaration(narg,false))
+		output(self:builddeclaration(narg,false,fast))
 	end
 end
 
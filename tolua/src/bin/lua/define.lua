@@ -34,6 +34,18 @@ function classDefine:register ()
  end
 end
 
+-- add lazy binding
+function classDefine:lazyregister (bindings)
+ if self.dataType == "number" then
+  bindings[self.lname] = '{"'..self.lname..'",NULL,'..self.name..',NULL}'
+ elseif self.dataType == "string" then
+  bindings[self.lname] = '{"'..self.lname..'",NULL,0,'..self.name..'}'
+ else
+  return false
+ end
+ return true
+end
+
 -- Print method
 function classDefine:print (ident,close)
  print(ident.."Define{")
@@ -29,6 +29,17 @@ function classEnumerate:register ()
  end
 end
 
+-- add lazy bindings
+function classEnumerate:lazyregister (bindings)
+ local nspace = getnamespace(classContainer.curr)
+ local i=1
+ while self[i] do
+  bindings[self.lnames[i]] = '{"'..self.lnames[i]..'",NULL,'..nspace..self[i]..',NULL}'
+  i = i+1
+ end
+ return true
+end
+
 -- Print method
 function classEnumerate:print (ident,close)
  print(ident.."Enumerate{")
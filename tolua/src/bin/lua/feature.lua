@@ -28,6 +28,12 @@ end
 function classFeature:register ()
 end
 
+-- add lazy bindings of the feature to a table, indexed by Lua name
+-- returns true if the feature needs no other registration
+function classFeature:lazyregister (bindings)
+ return false
+end
+
 -- translate verbatim
 function classFeature:preamble ()
 end
@@ -47,6 +47,200 @@ function classFunction:decltype ()
 end
 
 
+-- Check if the function is bound in fast mode (-F)
+-- Plain functions that are not overloaded and whose arguments and
+-- return value are all basic types check each argument with a single
+-- test, raise errors with luaL_typerror and read integers with
+-- lua_tointeger. Like the other checks, the tests are elided under
+-- TOLUA_RELEASE.
+function classFunction:isfast ()
+ local overload = strsub(self.cname,-2,-1) - 1
+ if not flags.F or overload >= 0 or self:inclass() or
+    (self.type ~= '' and self.type ~= 'void' and
+     (not isbasic(self.type) or self.type == 'tolua_index')) then
+  return false
+ end
+ if self.args[1].type ~= 'void' then
+  local i=1
+  while self.args[i] do
+   if self.args[i].type == "..." or not self.args[i]:isfast() then
+    return false
+   end
+   i = i+1
+  end
+ end
+ return true
+end
+
+-- C types passed by trampolines (-T), with the signature letter of each
+-- Arguments are decoded and checked as in fast mode.
+_trampoline_types = {
+ ['int'] = 'i',
+ ['unsigned int'] = 'u',
+ ['short'] = 'h',
+ ['unsigned short'] = 'H',
+ ['long'] = 'l',
+ ['unsigned long'] = 'L',
+ ['char'] = 'c',
+ ['unsigned char'] = 'C',
+ ['float'] = 'f',
+ ['double'] = 'd',
+ ['bool'] = 'b',
+ ['const char*'] = 's',
+ ['char*'] = 'S',
+ ['const void*'] = 'P',
+ ['void*'] = 'p',
+}
+_trampoline_ctypes = {}
+for ctype,letter in pairs(_trampoline_types) do
+ _trampoline_ctypes[letter] = ctype
+end
+
+-- get the kind of basic type of a C type passed by trampolines
+function trampolinekind (ctype)
+ local letter = _trampoline_types[ctype]
+ if letter == 's' or letter == 'S' then
+  return 'string'
+ elseif letter == 'p' or letter == 'P' then
+  return 'userdata'
+ elseif letter == 'b' then
+  return 'boolean'
+ end
+ return 'number'
+end
+
+-- Signatures of the trampolines to output, in order of first use
+_trampolines = {n=0}
+
+-- Plain functions bound through trampolines, in order of output
+_trampolined = {n=0}
+
+-- get the signature letter of a type, or nil if trampolines do not
+-- pass it; typedefs are resolved so that the letter names the C type
+-- the function is called with
+function trampolineletter (type)
+ local m,t = applytypedef(gsub(type,'const ',''))
+ if strfind(t,'%*$') then
+  if strfind(type,'^const ') then
+   t = 'const '..t
+  end
+  return _trampoline_types[t]
+ end
+ local words = ' '..m..' '..t..' '
+ if strfind(words,' signed ') or strfind(words,' long .*long ') then
+  return nil
+ end
+ if strfind(words,' short ') then
+  t = 'short'
+ elseif strfind(words,' long ') then
+  t = 'long'
+ elseif t == 'unsigned' then
+  t = 'int'
+ end
+ if strfind(words,' unsigned ') then
+  t = 'unsigned '..t
+ end
+ return _trampoline_types[t]
+end
+
+-- get the trampoline signature of the function, or nil if it is
+-- not bound through a trampoline
+-- The signature is the letter of the return type, or v for void,
+-- followed by an underscore and the letters of the arguments.
+function classFunction:signature ()
+ if not flags.T or not self:isfast() or self.ptr ~= '' or
+    self.parent.lnames[self.lname] ~= 0 then
+  return nil
+ end
+ local sig = 'v'
+ if self.type ~= '' and self.type ~= 'void' then
+  sig = trampolineletter(self.type)
+  if not sig then
+   return nil
+  end
+ end
+ sig = sig..'_'
+ if self.args[1].type ~= 'void' then
+  local i=1
+  while self.args[i] do
+   local letter = self.args[i].ptr == '' and trampolineletter(self.args[i].type)
+   if not letter then
+    return nil
+   end
+   sig = sig..letter
+   i = i+1
+  end
+ end
+ return sig
+end
+
+-- Write the trampoline of a signature
+-- The function to call is the target of the binding, which is the
+-- upvalue of the trampoline.
+function outtrampoline (sig)
+ local ret = strsub(sig,1,1)
+ local args = strsub(sig,3)
+ local rtype = _trampoline_ctypes[ret] or 'void'
+ local params = {}
+ local proto = ''
+ local i=1
+ while i <= strlen(args) do
+  params[i] = _trampoline_ctypes[strsub(args,i,i)]
+  if i > 1 then proto = proto..',' end
+  proto = proto..params[i]
+  i = i+1
+ end
+ if proto == '' then proto = 'void' end
+
+ output('/* trampoline: '..rtype..' ('..proto..') */')
+ output('static int tolua_trampoline_'..sig..' (lua_State* tolua_S)')
+ output('{')
+ output(' '..rtype..' (*tolua_f)('..proto..') = ('..rtype..' (*)('..proto..')) tolua_target(tolua_S);')
+ output('#ifndef TOLUA_RELEASE\n')
+ local narg = 1
+ while params[narg] do
+  outfastcheck(trampolinekind(params[narg]),narg)
+  narg = narg+1
+ end
+ output(' if (lua_gettop(tolua_S) > '..(narg-1)..')\n')
+ output('  return luaL_argerror(tolua_S,'..narg..',"no value expected");')
+ output('#endif\n')
+ output(' {')
+ local call = ''
+ narg = 1
+ while params[narg] do
+  local t = trampolinekind(params[narg])
+  local get
+  if t == 'number' then
+   if isfastinteger('',params[narg]) then
+    get = 'lua_tointeger(tolua_S,'..narg..')'
+   else
+    get = 'lua_tonumber(tolua_S,'..narg..')'
+   end
+  else
+   get = 'tolua_to'..t..'(tolua_S,'..narg..',0)'
+  end
+  if narg > 1 then
+   call = call..','
+  end
+  call = call..'('..params[narg]..') '..get
+  narg = narg+1
+ end
+ if ret ~= 'v' then
+  output('  '..rtype..' tolua_ret = tolua_f('..call..');')
+  local t = trampolinekind(rtype)
+  output('  tolua_push'..t..'(tolua_S,(',_basic_ctype[t],')tolua_ret);')
+  output(' }')
+  output(' return 1;')
+ else
+  output('  tolua_f('..call..');')
+  output(' }')
+  output(' return 0;')
+ end
+ output('}')
+ output('\n')
+end
+
 -- Write binding function
 -- Outputs C/C++ binding function.
 function classFunction:supcode ()
@@ -54,6 +248,19 @@ function classFunction:supcode ()
  local nret = 0      -- number of returned values
  local class = self:inclass()
  local _,_,static = strfind(self.mod,'^%s*(static)')
+ local fast = self:isfast()
+
+ -- with -T, the function is called through the trampoline of its
+ -- signature and needs no binding function of its own
+ self.trampoline = self:signature()
+ if self.trampoline then
+  if not _trampolines[self.trampoline] then
+   _trampolines[self.trampoline] = true
+   tinsert(_trampolines,self.trampoline)
+  end
+  tinsert(_trampolined,self)
+  return
+ end
 
  if class then
   output("/* method:",self.name," of class ",class," */")
@@ -64,6 +271,24 @@ function classFunction:supcode ()
  output("{")
 
  -- check types
+ if fast then
+  output('#ifndef TOLUA_RELEASE\n')
+  local narg=1
+  if self.args[1].type ~= 'void' then
+   local i=1
+   while self.args[i] do
+    self.args[i]:outfastcheck(narg)
+    if isbasic(self.args[i].type) ~= 'state' then
+     narg = narg+1
+    end
+    i = i+1
+   end
+  end
+  output(' if (lua_gettop(tolua_S) > '..(narg-1)..')\n')
+  output('  return luaL_argerror(tolua_S,'..narg..',"no value expected");')
+  output('#endif\n')
+  output(' {')
+ else
 	if overload < 0 then
 	 output('#ifndef TOLUA_RELEASE\n')
 	end
@@ -116,6 +341,7 @@ function classFunction:supcode ()
 	 output('#endif\n')
 	end
 	output(' {')
+ end
  
  -- declare self, if the case
  local narg
@@ -131,7 +357,7 @@ function classFunction:supcode ()
  if self.args[1].type ~= 'void' then
   local i=1
   while self.args[i] and self.args[i].type ~= "..." do
-   self.args[i]:declare(narg)
+   self.args[i]:declare(narg,fast)
 			if isbasic(self.args[i].type) ~= "state" then
         narg = narg+1
 			end
@@ -275,7 +501,9 @@ function classFunction:supcode ()
  output(' return '..nret..';')
 
  -- call overloaded function or generate error
-	if overload < 0 then
+	if fast then
+	 -- errors are raised by the checks
+	elseif overload < 0 then
 	 output('#ifndef TOLUA_RELEASE\n')
   output('tolua_lerror:\n')
   output(' tolua_error(tolua_S,"#ferror in function \''..self.lname..'\'.",&tolua_err);')
@@ -292,7 +520,29 @@ end
 
 -- register function
 function classFunction:register ()
- output(' tolua_function(tolua_S,"'..self.lname..'",'..self.cname..');')
+ if self.trampoline then
+  output(' tolua_binding(tolua_S,&tolua_trampolined['..self.index..']);')
+ else
+  output(' tolua_function(tolua_S,"'..self.lname..'",'..self.cname..');')
+ end
+end
+
+-- get the binding of a function called through a trampoline
+function classFunction:trampolinebinding ()
+ return '{"'..self.lname..'",tolua_trampoline_'..self.trampoline..
+        ',0,NULL,(tolua_CFunction)'..self.name..'}'
+end
+
+-- add lazy binding
+-- the last overload is bound, as with tolua_function
+function classFunction:lazyregister (bindings)
+ if self.trampoline then
+  bindings[self.lname] = self:trampolinebinding()
+  self.lazy = true
+ else
+  bindings[self.lname] = '{"'..self.lname..'",'..self.cname..',0,NULL}'
+ end
+ return true
 end
 
 -- Print method
@@ -150,6 +150,61 @@ end
 function classPackage:register ()
  push(self)
 
+ -- with -L, global functions and constants are bound on first access
+ local bindings = {}
+ local lazy = {}
+ local i=1
+ while flags.L and self[i] do
+  lazy[i] = self[i]:lazyregister(bindings)
+  i = i+1
+ end
+
+ -- with -T, plain functions share the trampolines of their signatures
+ -- and are mapped with bindings that give the function to call;
+ -- those that are not bound lazily are listed here
+ local i=1
+ while _trampolines[i] do
+  outtrampoline(_trampolines[i])
+  i = i+1
+ end
+ local n = 0
+ local i=1
+ while _trampolined[i] do
+  local f = _trampolined[i]
+  if not f.lazy then
+   if n == 0 then
+    output("/* Bindings of functions called through trampolines */")
+    output("static const tolua_LazyBinding tolua_trampolined[] =\n")
+    output("{")
+   end
+   f.index = n
+   output(" "..f:trampolinebinding()..",\n")
+   n = n+1
+  end
+  i = i+1
+ end
+ if n > 0 then
+  output("};")
+  output("\n")
+ end
+
+ -- Lua compares strings as strcmp in the C locale
+ local names = {}
+ for name in pairs(bindings) do
+  tinsert(names,name)
+ end
+ sort(names)
+ if getn(names) > 0 then
+  output("/* Lazy bindings, sorted by name */")
+  output("static const tolua_LazyBinding tolua_lazy_bindings[] =\n")
+  output("{")
+  for i,name in ipairs(names) do
+   output(" "..bindings[name]..",\n")
+  end
+  output("};")
+  output("\n")
+ end
+
  output("/* Open lib function */")
  output('LUALIB_API int  luaopen_'..self.name..' (lua_State* tolua_S)')
  output("{")
@@ -159,9 +214,14 @@ function classPackage:register ()
  output(" tolua_beginmodule(tolua_S,NULL);")
  local i=1
  while self[i] do
-  self[i]:register()
+  if not lazy[i] then
+   self[i]:register()
+  end
   i = i+1
  end
+ if getn(names) > 0 then
+  output(" tolua_lazymodule(tolua_S,tolua_lazy_bindings,"..getn(names)..");")
+ end
  output(" tolua_endmodule(tolua_S);")
  output(" return 1;")
  output("}")
@@ -34,6 +34,10 @@ static void help (void)
          "  -H  file : create include file.\n"
          "  -n  name : set package name; default is input file root name.\n"
          "  -p       : parse only.\n"
+         "  -L       : bind global functions and constants on first access.\n"
+         "  -F       : check and decode arguments of plain functions in fast mode.\n"
+         "  -T       : call plain functions through shared trampolines, one per\n"
+         "             signature, instead of a binding function each (implies -F).\n"
          "  -P       : parse and print structure information (for debug).\n"
          "  -h       : print this message.\n"
          "Should the input file be omitted, stdin is assumed;\n"
@@ -89,6 +93,9 @@ int main (int argc, char* argv[])
      case 'h': help(); return 0;
      case 'p': setfield(L,t,"p",""); break;
      case 'P': setfield(L,t,"P",""); break;
+     case 'L': setfield(L,t,"L",""); break;
+     case 'F': setfield(L,t,"F",""); break;
+     case 'T': setfield(L,t,"T",""); setfield(L,t,"F",""); break;
      case 'o': setfield(L,t,"o",argv[++i]); break;
      case 'n': setfield(L,t,"n",argv[++i]); break;
      case 'H': setfield(L,t,"H",argv[++i]); break;
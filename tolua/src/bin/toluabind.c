@@ -1,6 +1,6 @@
 /*
 ** Lua binding: tolua
-** Generated automatically by tolua 5.1.4 on Mon Apr 18 15:22:28 2011.
+** Generated automatically by tolua 5.1.4 on Sat Oct 17 20:01:36 2026.
 */
 
 #include "tolua.h"
@@ -463,76 +463,80 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
    116,105,111,110, 32, 99,108, 97,115,115, 70,101, 97,116,117,
    114,101, 58,114,101,103,105,115,116,101,114, 32, 40, 41, 10,
    101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108,
-    97,115,115, 70,101, 97,116,117,114,101, 58,112,114,101, 97,
-   109, 98,108,101, 32, 40, 41, 10,101,110,100, 10,102,117,110,
-    99,116,105,111,110, 32, 99,108, 97,115,115, 70,101, 97,116,
-   117,114,101, 58,105,115,118, 97,114,105, 97, 98,108,101, 32,
-    40, 41, 10,114,101,116,117,114,110, 32,102, 97,108,115,101,
-    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,
-   108, 97,115,115, 70,101, 97,116,117,114,101, 58,114,101,113,
-   117,105,114,101, 99,111,108,108,101, 99,116,105,111,110, 32,
-    40,116, 41, 10,114,101,116,117,114,110, 32,102, 97,108,115,
-   101, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
-    99,108, 97,115,115, 70,101, 97,116,117,114,101, 58, 98,117,
-   105,108,100,110, 97,109,101,115, 32, 40, 41, 10,105,102, 32,
-   115,101,108,102, 46,110, 97,109,101, 32, 97,110,100, 32,115,
-   101,108,102, 46,110, 97,109,101,126, 61, 39, 39, 32,116,104,
-   101,110, 10,108,111, 99, 97,108, 32,110, 32, 61, 32,115,112,
-   108,105,116, 40,115,101,108,102, 46,110, 97,109,101, 44, 39,
-    64, 39, 41, 10,115,101,108,102, 46,110, 97,109,101, 32, 61,
-    32,110, 91, 49, 93, 10,105,102, 32,110,111,116, 32,110, 91,
-    50, 93, 32,116,104,101,110, 10,110, 91, 50, 93, 32, 61, 32,
-    97,112,112,108,121,114,101,110, 97,109,105,110,103, 40,110,
-    91, 49, 93, 41, 10,101,110,100, 10,115,101,108,102, 46,108,
-   110, 97,109,101, 32, 61, 32,110, 91, 50, 93, 32,111,114, 32,
-   103,115,117, 98, 40,110, 91, 49, 93, 44, 34, 37, 91, 46, 45,
-    37, 93, 34, 44, 34, 34, 41, 10,101,110,100, 10,115,101,108,
-   102, 46,110, 97,109,101, 32, 61, 32,103,101,116,111,110,108,
-   121,110, 97,109,101,115,112, 97, 99,101, 40, 41, 32, 46, 46,
-    32,115,101,108,102, 46,110, 97,109,101, 10,101,110,100, 10,
+    97,115,115, 70,101, 97,116,117,114,101, 58,108, 97,122,121,
+   114,101,103,105,115,116,101,114, 32, 40, 98,105,110,100,105,
+   110,103,115, 41, 10,114,101,116,117,114,110, 32,102, 97,108,
+   115,101, 10,101,110,100, 10,102,117,110, 99,116,105,111,110,
+    32, 99,108, 97,115,115, 70,101, 97,116,117,114,101, 58,112,
+   114,101, 97,109, 98,108,101, 32, 40, 41, 10,101,110,100, 10,
    102,117,110, 99,116,105,111,110, 32, 99,108, 97,115,115, 70,
-   101, 97,116,117,114,101, 58,105,110, 99,111,110,116, 97,105,
-   110,101,114, 32, 40,119,104,105, 99,104, 41, 10,105,102, 32,
-   115,101,108,102, 46,112, 97,114,101,110,116, 32,116,104,101,
-   110, 10,108,111, 99, 97,108, 32,112, 97,114,101,110,116, 32,
-    61, 32,115,101,108,102, 46,112, 97,114,101,110,116, 10,119,
-   104,105,108,101, 32,112, 97,114,101,110,116, 32,100,111, 10,
-   105,102, 32,112, 97,114,101,110,116, 46, 99,108, 97,115,115,
-   116,121,112,101, 32, 61, 61, 32,119,104,105, 99,104, 32,116,
-   104,101,110, 10,114,101,116,117,114,110, 32,112, 97,114,101,
-   110,116, 46,110, 97,109,101, 10,101,110,100, 10,112, 97,114,
-   101,110,116, 32, 61, 32,112, 97,114,101,110,116, 46,112, 97,
-   114,101,110,116, 10,101,110,100, 10,101,110,100, 10,114,101,
-   116,117,114,110, 32,110,105,108, 10,101,110,100, 10,102,117,
-   110, 99,116,105,111,110, 32, 99,108, 97,115,115, 70,101, 97,
-   116,117,114,101, 58,105,110, 99,108, 97,115,115, 32, 40, 41,
-    10,114,101,116,117,114,110, 32,115,101,108,102, 58,105,110,
-    99,111,110,116, 97,105,110,101,114, 40, 39, 99,108, 97,115,
-   115, 39, 41, 10,101,110,100, 10,102,117,110, 99,116,105,111,
+   101, 97,116,117,114,101, 58,105,115,118, 97,114,105, 97, 98,
+   108,101, 32, 40, 41, 10,114,101,116,117,114,110, 32,102, 97,
+   108,115,101, 10,101,110,100, 10,102,117,110, 99,116,105,111,
    110, 32, 99,108, 97,115,115, 70,101, 97,116,117,114,101, 58,
-   105,110,109,111,100,117,108,101, 32, 40, 41, 10,114,101,116,
-   117,114,110, 32,115,101,108,102, 58,105,110, 99,111,110,116,
-    97,105,110,101,114, 40, 39,109,111,100,117,108,101, 39, 41,
-    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,
-   108, 97,115,115, 70,101, 97,116,117,114,101, 58,105,110,110,
-    97,109,101,115,112, 97, 99,101, 32, 40, 41, 10,114,101,116,
-   117,114,110, 32,115,101,108,102, 58,105,110, 99,111,110,116,
-    97,105,110,101,114, 40, 39,110, 97,109,101,115,112, 97, 99,
+   114,101,113,117,105,114,101, 99,111,108,108,101, 99,116,105,
+   111,110, 32, 40,116, 41, 10,114,101,116,117,114,110, 32,102,
+    97,108,115,101, 10,101,110,100, 10,102,117,110, 99,116,105,
+   111,110, 32, 99,108, 97,115,115, 70,101, 97,116,117,114,101,
+    58, 98,117,105,108,100,110, 97,109,101,115, 32, 40, 41, 10,
+   105,102, 32,115,101,108,102, 46,110, 97,109,101, 32, 97,110,
+   100, 32,115,101,108,102, 46,110, 97,109,101,126, 61, 39, 39,
+    32,116,104,101,110, 10,108,111, 99, 97,108, 32,110, 32, 61,
+    32,115,112,108,105,116, 40,115,101,108,102, 46,110, 97,109,
+   101, 44, 39, 64, 39, 41, 10,115,101,108,102, 46,110, 97,109,
+   101, 32, 61, 32,110, 91, 49, 93, 10,105,102, 32,110,111,116,
+    32,110, 91, 50, 93, 32,116,104,101,110, 10,110, 91, 50, 93,
+    32, 61, 32, 97,112,112,108,121,114,101,110, 97,109,105,110,
+   103, 40,110, 91, 49, 93, 41, 10,101,110,100, 10,115,101,108,
+   102, 46,108,110, 97,109,101, 32, 61, 32,110, 91, 50, 93, 32,
+   111,114, 32,103,115,117, 98, 40,110, 91, 49, 93, 44, 34, 37,
+    91, 46, 45, 37, 93, 34, 44, 34, 34, 41, 10,101,110,100, 10,
+   115,101,108,102, 46,110, 97,109,101, 32, 61, 32,103,101,116,
+   111,110,108,121,110, 97,109,101,115,112, 97, 99,101, 40, 41,
+    32, 46, 46, 32,115,101,108,102, 46,110, 97,109,101, 10,101,
+   110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,
+   115,115, 70,101, 97,116,117,114,101, 58,105,110, 99,111,110,
+   116, 97,105,110,101,114, 32, 40,119,104,105, 99,104, 41, 10,
+   105,102, 32,115,101,108,102, 46,112, 97,114,101,110,116, 32,
+   116,104,101,110, 10,108,111, 99, 97,108, 32,112, 97,114,101,
+   110,116, 32, 61, 32,115,101,108,102, 46,112, 97,114,101,110,
+   116, 10,119,104,105,108,101, 32,112, 97,114,101,110,116, 32,
+   100,111, 10,105,102, 32,112, 97,114,101,110,116, 46, 99,108,
+    97,115,115,116,121,112,101, 32, 61, 61, 32,119,104,105, 99,
+   104, 32,116,104,101,110, 10,114,101,116,117,114,110, 32,112,
+    97,114,101,110,116, 46,110, 97,109,101, 10,101,110,100, 10,
+   112, 97,114,101,110,116, 32, 61, 32,112, 97,114,101,110,116,
+    46,112, 97,114,101,110,116, 10,101,110,100, 10,101,110,100,
+    10,114,101,116,117,114,110, 32,110,105,108, 10,101,110,100,
+    10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,115,115,
+    70,101, 97,116,117,114,101, 58,105,110, 99,108, 97,115,115,
+    32, 40, 41, 10,114,101,116,117,114,110, 32,115,101,108,102,
+    58,105,110, 99,111,110,116, 97,105,110,101,114, 40, 39, 99,
+   108, 97,115,115, 39, 41, 10,101,110,100, 10,102,117,110, 99,
+   116,105,111,110, 32, 99,108, 97,115,115, 70,101, 97,116,117,
+   114,101, 58,105,110,109,111,100,117,108,101, 32, 40, 41, 10,
+   114,101,116,117,114,110, 32,115,101,108,102, 58,105,110, 99,
+   111,110,116, 97,105,110,101,114, 40, 39,109,111,100,117,108,
    101, 39, 41, 10,101,110,100, 10,102,117,110, 99,116,105,111,
    110, 32, 99,108, 97,115,115, 70,101, 97,116,117,114,101, 58,
-    99,102,117,110, 99,110, 97,109,101, 32, 40,110, 41, 10,105,
-   102, 32,115,101,108,102, 46,112, 97,114,101,110,116, 32,116,
-   104,101,110, 10,110, 32, 61, 32,115,101,108,102, 46,112, 97,
-   114,101,110,116, 58, 99,102,117,110, 99,110, 97,109,101, 40,
-   110, 41, 10,101,110,100, 10,105,102, 32,115,101,108,102, 46,
-   108,110, 97,109,101, 32, 97,110,100, 10,115,116,114,115,117,
-    98, 40,115,101,108,102, 46,108,110, 97,109,101, 44, 49, 44,
-    49, 41,126, 61, 34, 46, 34, 10,116,104,101,110, 10,114,101,
-   116,117,114,110, 32,110, 46, 46, 39, 95, 39, 46, 46,115,101,
-   108,102, 46,108,110, 97,109,101, 10,101,108,115,101, 10,114,
-   101,116,117,114,110, 32,110, 46, 46, 39, 95, 39, 46, 46,115,
-   101,108,102, 46,110, 97,109,101, 10,101,110,100, 10,101,110,
-   100,32
+   105,110,110, 97,109,101,115,112, 97, 99,101, 32, 40, 41, 10,
+   114,101,116,117,114,110, 32,115,101,108,102, 58,105,110, 99,
+   111,110,116, 97,105,110,101,114, 40, 39,110, 97,109,101,115,
+   112, 97, 99,101, 39, 41, 10,101,110,100, 10,102,117,110, 99,
+   116,105,111,110, 32, 99,108, 97,115,115, 70,101, 97,116,117,
+   114,101, 58, 99,102,117,110, 99,110, 97,109,101, 32, 40,110,
+    41, 10,105,102, 32,115,101,108,102, 46,112, 97,114,101,110,
+   116, 32,116,104,101,110, 10,110, 32, 61, 32,115,101,108,102,
+    46,112, 97,114,101,110,116, 58, 99,102,117,110, 99,110, 97,
+   109,101, 40,110, 41, 10,101,110,100, 10,105,102, 32,115,101,
+   108,102, 46,108,110, 97,109,101, 32, 97,110,100, 10,115,116,
+   114,115,117, 98, 40,115,101,108,102, 46,108,110, 97,109,101,
+    44, 49, 44, 49, 41,126, 61, 34, 46, 34, 10,116,104,101,110,
+    10,114,101,116,117,114,110, 32,110, 46, 46, 39, 95, 39, 46,
+    46,115,101,108,102, 46,108,110, 97,109,101, 10,101,108,115,
+   101, 10,114,101,116,117,114,110, 32,110, 46, 46, 39, 95, 39,
+    46, 46,115,101,108,102, 46,110, 97,109,101, 10,101,110,100,
+    10,101,110,100,32
   };
   luaL_loadbuffer(tolua_S,(char*)B,sizeof(B),"tolua: embedded Lua code") ||
   lua_pcall(tolua_S,0,LUA_MULTRET,0);
@@ -1562,188 +1566,258 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
     41, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
     99,108, 97,115,115, 80, 97, 99,107, 97,103,101, 58,114,101,
    103,105,115,116,101,114, 32, 40, 41, 10,112,117,115,104, 40,
-   115,101,108,102, 41, 10,111,117,116,112,117,116, 40, 34, 47,
-    42, 32, 79,112,101,110, 32,108,105, 98, 32,102,117,110, 99,
-   116,105,111,110, 32, 42, 47, 34, 41, 10,111,117,116,112,117,
-   116, 40, 39, 76, 85, 65, 76, 73, 66, 95, 65, 80, 73, 32,105,
-   110,116, 32,108,117, 97,111,112,101,110, 95, 39, 46, 46,115,
-   101,108,102, 46,110, 97,109,101, 46, 46, 39, 32, 40,108,117,
-    97, 95, 83,116, 97,116,101, 42, 32,116,111,108,117, 97, 95,
-    83, 41, 39, 41, 10,111,117,116,112,117,116, 40, 34,123, 34,
-    41, 10,111,117,116,112,117,116, 40, 34, 32,116,111,108,117,
-    97, 95,111,112,101,110, 40,116,111,108,117, 97, 95, 83, 41,
-    59, 34, 41, 10,111,117,116,112,117,116, 40, 34, 32,116,111,
-   108,117, 97, 95,114,101,103, 95,116,121,112,101,115, 40,116,
-   111,108,117, 97, 95, 83, 41, 59, 34, 41, 10,111,117,116,112,
-   117,116, 40, 34, 32,116,111,108,117, 97, 95,109,111,100,117,
-   108,101, 40,116,111,108,117, 97, 95, 83, 44, 78, 85, 76, 76,
-    44, 34, 44,115,101,108,102, 58,104, 97,115,118, 97,114, 40,
-    41, 44, 34, 41, 59, 34, 41, 10,111,117,116,112,117,116, 40,
-    34, 32,116,111,108,117, 97, 95, 98,101,103,105,110,109,111,
-   100,117,108,101, 40,116,111,108,117, 97, 95, 83, 44, 78, 85,
-    76, 76, 41, 59, 34, 41, 10,108,111, 99, 97,108, 32,105, 61,
-    49, 10,119,104,105,108,101, 32,115,101,108,102, 91,105, 93,
-    32,100,111, 10,115,101,108,102, 91,105, 93, 58,114,101,103,
-   105,115,116,101,114, 40, 41, 10,105, 32, 61, 32,105, 43, 49,
-    10,101,110,100, 10,111,117,116,112,117,116, 40, 34, 32,116,
-   111,108,117, 97, 95,101,110,100,109,111,100,117,108,101, 40,
-   116,111,108,117, 97, 95, 83, 41, 59, 34, 41, 10,111,117,116,
+   115,101,108,102, 41, 10,108,111, 99, 97,108, 32, 98,105,110,
+   100,105,110,103,115, 32, 61, 32,123,125, 10,108,111, 99, 97,
+   108, 32,108, 97,122,121, 32, 61, 32,123,125, 10,108,111, 99,
+    97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,102,108,
+    97,103,115, 46, 76, 32, 97,110,100, 32,115,101,108,102, 91,
+   105, 93, 32,100,111, 10,108, 97,122,121, 91,105, 93, 32, 61,
+    32,115,101,108,102, 91,105, 93, 58,108, 97,122,121,114,101,
+   103,105,115,116,101,114, 40, 98,105,110,100,105,110,103,115,
+    41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,108,
+   111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,
+    95,116,114, 97,109,112,111,108,105,110,101,115, 91,105, 93,
+    32,100,111, 10,111,117,116,116,114, 97,109,112,111,108,105,
+   110,101, 40, 95,116,114, 97,109,112,111,108,105,110,101,115,
+    91,105, 93, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,
+   100, 10,108,111, 99, 97,108, 32,110, 32, 61, 32, 48, 10,108,
+   111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,
+    95,116,114, 97,109,112,111,108,105,110,101,100, 91,105, 93,
+    32,100,111, 10,108,111, 99, 97,108, 32,102, 32, 61, 32, 95,
+   116,114, 97,109,112,111,108,105,110,101,100, 91,105, 93, 10,
+   105,102, 32,110,111,116, 32,102, 46,108, 97,122,121, 32,116,
+   104,101,110, 10,105,102, 32,110, 32, 61, 61, 32, 48, 32,116,
+   104,101,110, 10,111,117,116,112,117,116, 40, 34, 47, 42, 32,
+    66,105,110,100,105,110,103,115, 32,111,102, 32,102,117,110,
+    99,116,105,111,110,115, 32, 99, 97,108,108,101,100, 32,116,
+   104,114,111,117,103,104, 32,116,114, 97,109,112,111,108,105,
+   110,101,115, 32, 42, 47, 34, 41, 10,111,117,116,112,117,116,
+    40, 34,115,116, 97,116,105, 99, 32, 99,111,110,115,116, 32,
+   116,111,108,117, 97, 95, 76, 97,122,121, 66,105,110,100,105,
+   110,103, 32,116,111,108,117, 97, 95,116,114, 97,109,112,111,
+   108,105,110,101,100, 91, 93, 32, 61, 92,110, 34, 41, 10,111,
+   117,116,112,117,116, 40, 34,123, 34, 41, 10,101,110,100, 10,
+   102, 46,105,110,100,101,120, 32, 61, 32,110, 10,111,117,116,
+   112,117,116, 40, 34, 32, 34, 46, 46,102, 58,116,114, 97,109,
+   112,111,108,105,110,101, 98,105,110,100,105,110,103, 40, 41,
+    46, 46, 34, 44, 92,110, 34, 41, 10,110, 32, 61, 32,110, 43,
+    49, 10,101,110,100, 10,105, 32, 61, 32,105, 43, 49, 10,101,
+   110,100, 10,105,102, 32,110, 32, 62, 32, 48, 32,116,104,101,
+   110, 10,111,117,116,112,117,116, 40, 34,125, 59, 34, 41, 10,
+   111,117,116,112,117,116, 40, 34, 92,110, 34, 41, 10,101,110,
+   100, 10,108,111, 99, 97,108, 32,110, 97,109,101,115, 32, 61,
+    32,123,125, 10,102,111,114, 32,110, 97,109,101, 32,105,110,
+    32,112, 97,105,114,115, 40, 98,105,110,100,105,110,103,115,
+    41, 32,100,111, 10,116,105,110,115,101,114,116, 40,110, 97,
+   109,101,115, 44,110, 97,109,101, 41, 10,101,110,100, 10,115,
+   111,114,116, 40,110, 97,109,101,115, 41, 10,105,102, 32,103,
+   101,116,110, 40,110, 97,109,101,115, 41, 32, 62, 32, 48, 32,
+   116,104,101,110, 10,111,117,116,112,117,116, 40, 34, 47, 42,
+    32, 76, 97,122,121, 32, 98,105,110,100,105,110,103,115, 44,
+    32,115,111,114,116,101,100, 32, 98,121, 32,110, 97,109,101,
+    32, 42, 47, 34, 41, 10,111,117,116,112,117,116, 40, 34,115,
+   116, 97,116,105, 99, 32, 99,111,110,115,116, 32,116,111,108,
+   117, 97, 95, 76, 97,122,121, 66,105,110,100,105,110,103, 32,
+   116,111,108,117, 97, 95,108, 97,122,121, 95, 98,105,110,100,
+   105,110,103,115, 91, 93, 32, 61, 92,110, 34, 41, 10,111,117,
+   116,112,117,116, 40, 34,123, 34, 41, 10,102,111,114, 32,105,
+    44,110, 97,109,101, 32,105,110, 32,105,112, 97,105,114,115,
+    40,110, 97,109,101,115, 41, 32,100,111, 10,111,117,116,112,
+   117,116, 40, 34, 32, 34, 46, 46, 98,105,110,100,105,110,103,
+   115, 91,110, 97,109,101, 93, 46, 46, 34, 44, 92,110, 34, 41,
+    10,101,110,100, 10,111,117,116,112,117,116, 40, 34,125, 59,
+    34, 41, 10,111,117,116,112,117,116, 40, 34, 92,110, 34, 41,
+    10,101,110,100, 10,111,117,116,112,117,116, 40, 34, 47, 42,
+    32, 79,112,101,110, 32,108,105, 98, 32,102,117,110, 99,116,
+   105,111,110, 32, 42, 47, 34, 41, 10,111,117,116,112,117,116,
+    40, 39, 76, 85, 65, 76, 73, 66, 95, 65, 80, 73, 32,105,110,
+   116, 32,108,117, 97,111,112,101,110, 95, 39, 46, 46,115,101,
+   108,102, 46,110, 97,109,101, 46, 46, 39, 32, 40,108,117, 97,
+    95, 83,116, 97,116,101, 42, 32,116,111,108,117, 97, 95, 83,
+    41, 39, 41, 10,111,117,116,112,117,116, 40, 34,123, 34, 41,
+    10,111,117,116,112,117,116, 40, 34, 32,116,111,108,117, 97,
+    95,111,112,101,110, 40,116,111,108,117, 97, 95, 83, 41, 59,
+    34, 41, 10,111,117,116,112,117,116, 40, 34, 32,116,111,108,
+   117, 97, 95,114,101,103, 95,116,121,112,101,115, 40,116,111,
+   108,117, 97, 95, 83, 41, 59, 34, 41, 10,111,117,116,112,117,
+   116, 40, 34, 32,116,111,108,117, 97, 95,109,111,100,117,108,
+   101, 40,116,111,108,117, 97, 95, 83, 44, 78, 85, 76, 76, 44,
+    34, 44,115,101,108,102, 58,104, 97,115,118, 97,114, 40, 41,
+    44, 34, 41, 59, 34, 41, 10,111,117,116,112,117,116, 40, 34,
+    32,116,111,108,117, 97, 95, 98,101,103,105,110,109,111,100,
+   117,108,101, 40,116,111,108,117, 97, 95, 83, 44, 78, 85, 76,
+    76, 41, 59, 34, 41, 10,108,111, 99, 97,108, 32,105, 61, 49,
+    10,119,104,105,108,101, 32,115,101,108,102, 91,105, 93, 32,
+   100,111, 10,105,102, 32,110,111,116, 32,108, 97,122,121, 91,
+   105, 93, 32,116,104,101,110, 10,115,101,108,102, 91,105, 93,
+    58,114,101,103,105,115,116,101,114, 40, 41, 10,101,110,100,
+    10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,105,102,
+    32,103,101,116,110, 40,110, 97,109,101,115, 41, 32, 62, 32,
+    48, 32,116,104,101,110, 10,111,117,116,112,117,116, 40, 34,
+    32,116,111,108,117, 97, 95,108, 97,122,121,109,111,100,117,
+   108,101, 40,116,111,108,117, 97, 95, 83, 44,116,111,108,117,
+    97, 95,108, 97,122,121, 95, 98,105,110,100,105,110,103,115,
+    44, 34, 46, 46,103,101,116,110, 40,110, 97,109,101,115, 41,
+    46, 46, 34, 41, 59, 34, 41, 10,101,110,100, 10,111,117,116,
+   112,117,116, 40, 34, 32,116,111,108,117, 97, 95,101,110,100,
+   109,111,100,117,108,101, 40,116,111,108,117, 97, 95, 83, 41,
+    59, 34, 41, 10,111,117,116,112,117,116, 40, 34, 32,114,101,
+   116,117,114,110, 32, 49, 59, 34, 41, 10,111,117,116,112,117,
+   116, 40, 34,125, 34, 41, 10,111,117,116,112,117,116, 40, 34,
+    47, 42, 32, 79,112,101,110, 32,116,111,108,117, 97, 32,102,
+   117,110, 99,116,105,111,110, 32, 42, 47, 34, 41, 10,111,117,
+   116,112,117,116, 40, 34, 84, 79, 76, 85, 65, 95, 65, 80, 73,
+    32,105,110,116, 32,116,111,108,117, 97, 95, 34, 46, 46,115,
+   101,108,102, 46,110, 97,109,101, 46, 46, 34, 95,111,112,101,
+   110, 32, 40,108,117, 97, 95, 83,116, 97,116,101, 42, 32,116,
+   111,108,117, 97, 95, 83, 41, 34, 41, 10,111,117,116,112,117,
+   116, 40, 34,123, 34, 41, 10,111,117,116,112,117,116, 40, 34,
+    32,108,117, 97, 95,112,117,115,104, 99,102,117,110, 99,116,
+   105,111,110, 40,116,111,108,117, 97, 95, 83, 44, 32,108,117,
+    97,111,112,101,110, 95, 34, 46, 46,115,101,108,102, 46,110,
+    97,109,101, 46, 46, 34, 41, 59, 34, 41, 10,111,117,116,112,
+   117,116, 40, 39, 32,108,117, 97, 95,112,117,115,104,115,116,
+   114,105,110,103, 40,116,111,108,117, 97, 95, 83, 44, 32, 34,
+    39, 46, 46,115,101,108,102, 46,110, 97,109,101, 46, 46, 39,
+    34, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 34, 32,
+   108,117, 97, 95, 99, 97,108,108, 40,116,111,108,117, 97, 95,
+    83, 44, 32, 49, 44, 32, 48, 41, 59, 34, 41, 10,111,117,116,
    112,117,116, 40, 34, 32,114,101,116,117,114,110, 32, 49, 59,
     34, 41, 10,111,117,116,112,117,116, 40, 34,125, 34, 41, 10,
-   111,117,116,112,117,116, 40, 34, 47, 42, 32, 79,112,101,110,
-    32,116,111,108,117, 97, 32,102,117,110, 99,116,105,111,110,
-    32, 42, 47, 34, 41, 10,111,117,116,112,117,116, 40, 34, 84,
-    79, 76, 85, 65, 95, 65, 80, 73, 32,105,110,116, 32,116,111,
-   108,117, 97, 95, 34, 46, 46,115,101,108,102, 46,110, 97,109,
-   101, 46, 46, 34, 95,111,112,101,110, 32, 40,108,117, 97, 95,
-    83,116, 97,116,101, 42, 32,116,111,108,117, 97, 95, 83, 41,
-    34, 41, 10,111,117,116,112,117,116, 40, 34,123, 34, 41, 10,
-   111,117,116,112,117,116, 40, 34, 32,108,117, 97, 95,112,117,
-   115,104, 99,102,117,110, 99,116,105,111,110, 40,116,111,108,
-   117, 97, 95, 83, 44, 32,108,117, 97,111,112,101,110, 95, 34,
-    46, 46,115,101,108,102, 46,110, 97,109,101, 46, 46, 34, 41,
-    59, 34, 41, 10,111,117,116,112,117,116, 40, 39, 32,108,117,
-    97, 95,112,117,115,104,115,116,114,105,110,103, 40,116,111,
-   108,117, 97, 95, 83, 44, 32, 34, 39, 46, 46,115,101,108,102,
-    46,110, 97,109,101, 46, 46, 39, 34, 41, 59, 39, 41, 10,111,
-   117,116,112,117,116, 40, 34, 32,108,117, 97, 95, 99, 97,108,
-   108, 40,116,111,108,117, 97, 95, 83, 44, 32, 49, 44, 32, 48,
-    41, 59, 34, 41, 10,111,117,116,112,117,116, 40, 34, 32,114,
-   101,116,117,114,110, 32, 49, 59, 34, 41, 10,111,117,116,112,
-   117,116, 40, 34,125, 34, 41, 10,112,111,112, 40, 41, 10,101,
-   110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,
-   115,115, 80, 97, 99,107, 97,103,101, 58,104,101, 97,100,101,
-   114, 32, 40, 41, 10,111,117,116,112,117,116, 40, 39, 47, 42,
-    92,110, 39, 41, 32,111,117,116,112,117,116, 40, 39, 42, 42,
-    32, 76,117, 97, 32, 98,105,110,100,105,110,103, 58, 32, 39,
-    46, 46,115,101,108,102, 46,110, 97,109,101, 46, 46, 39, 92,
-   110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 42, 42, 32,
-    71,101,110,101,114, 97,116,101,100, 32, 97,117,116,111,109,
-    97,116,105, 99, 97,108,108,121, 32, 98,121, 32, 39, 46, 46,
-    84, 79, 76, 85, 65, 95, 86, 69, 82, 83, 73, 79, 78, 46, 46,
-    39, 32,111,110, 32, 39, 46, 46,100, 97,116,101, 40, 41, 46,
-    46, 39, 46, 92,110, 39, 41, 10,111,117,116,112,117,116, 40,
-    39, 42, 47, 92,110, 92,110, 39, 41, 10,105,102, 32,110,111,
-   116, 32,102,108, 97,103,115, 46,104, 32,116,104,101,110, 10,
-   111,117,116,112,117,116, 40, 39, 47, 42, 32, 69,120,112,111,
-   114,116,101,100, 32,102,117,110, 99,116,105,111,110, 32, 42,
-    47, 39, 41, 10,111,117,116,112,117,116, 40, 39, 84, 79, 76,
-    85, 65, 95, 65, 80, 73, 32,105,110,116, 32,116,111,108,117,
-    97, 95, 39, 46, 46,115,101,108,102, 46,110, 97,109,101, 46,
-    46, 39, 95,111,112,101,110, 32, 40,108,117, 97, 95, 83,116,
-    97,116,101, 42, 32,116,111,108,117, 97, 95, 83, 41, 59, 39,
-    41, 10,111,117,116,112,117,116, 40, 39, 76, 85, 65, 76, 73,
-    66, 95, 65, 80, 73, 32,105,110,116, 32,108,117, 97,111,112,
-   101,110, 95, 39, 46, 46,115,101,108,102, 46,110, 97,109,101,
-    46, 46, 39, 32, 40,108,117, 97, 95, 83,116, 97,116,101, 42,
-    32,116,111,108,117, 97, 95, 83, 41, 59, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 92,110, 39, 41, 10,101,110,100, 10,
-   101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 95, 80,
-    97, 99,107, 97,103,101, 32, 40,115,101,108,102, 41, 10,115,
-   101,116,109,101,116, 97,116, 97, 98,108,101, 40,115,101,108,
-   102, 44, 99,108, 97,115,115, 80, 97, 99,107, 97,103,101, 41,
-    10,114,101,116,117,114,110, 32,115,101,108,102, 10,101,110,
-   100, 10,102,117,110, 99,116,105,111,110, 32,101,120,116,114,
-    97, 99,116, 95, 99,111,100,101, 40,102,110, 44,115, 41, 10,
-   108,111, 99, 97,108, 32, 99,111,100,101, 32, 61, 32, 39, 92,
-   110, 36, 35,105,110, 99,108,117,100,101, 32, 34, 39, 46, 46,
-   102,110, 46, 46, 39, 34, 92,110, 39, 10,115, 61, 32, 34, 92,
-   110, 34, 32, 46, 46, 32,115, 32, 46, 46, 32, 34, 92,110, 34,
-    10,108,111, 99, 97,108, 32, 95, 44,101, 44, 99, 44,116, 32,
-    61, 32,115,116,114,102,105,110,100, 40,115, 44, 32, 34, 92,
-   110, 40, 91, 94, 92,110, 93, 45, 41, 91, 84,116, 93, 91, 79,
-   111, 93, 91, 76,108, 93, 91, 85,117, 93, 91, 65, 97, 93, 95,
-    40, 91, 94, 37,115, 93, 42, 41, 91, 94, 92,110, 93, 42, 92,
-   110, 34, 41, 10,119,104,105,108,101, 32,101, 32,100,111, 10,
-   116, 32, 61, 32,115,116,114,108,111,119,101,114, 40,116, 41,
-    10,105,102, 32,116, 32, 61, 61, 32, 34, 98,101,103,105,110,
-    34, 32,116,104,101,110, 10, 95, 44,101, 44, 99, 32, 61, 32,
-   115,116,114,102,105,110,100, 40,115, 44, 34, 40, 46, 45, 41,
-    92,110, 91, 94, 92,110, 93, 42, 91, 84,116, 93, 91, 79,111,
-    93, 91, 76,108, 93, 91, 85,117, 93, 91, 65, 97, 93, 95, 91,
-    69,101, 93, 91, 78,110, 93, 91, 68,100, 93, 91, 94, 92,110,
-    93, 42, 92,110, 34, 44,101, 41, 10,105,102, 32,110,111,116,
-    32,101, 32,116,104,101,110, 10,116,111,108,117, 97, 95,101,
-   114,114,111,114, 40, 34, 85,110, 98, 97,108, 97,110, 99,101,
-   100, 32, 39,116,111,108,117, 97, 95, 98,101,103,105,110, 39,
-    32,100,105,114,101, 99,116,105,118,101, 32,105,110, 32,104,
-   101, 97,100,101,114, 32,102,105,108,101, 34, 41, 10,101,110,
-   100, 10,101,110,100, 10, 99,111,100,101, 32, 61, 32, 99,111,
-   100,101, 32, 46, 46, 32, 99, 32, 46, 46, 32, 34, 92,110, 34,
-    10, 95, 44,101, 44, 99, 44,116, 32, 61, 32,115,116,114,102,
-   105,110,100, 40,115, 44, 32, 34, 92,110, 40, 91, 94, 92,110,
-    93, 45, 41, 91, 84,116, 93, 91, 79,111, 93, 91, 76,108, 93,
-    91, 85,117, 93, 91, 65, 97, 93, 95, 40, 91, 94, 37,115, 93,
-    42, 41, 91, 94, 92,110, 93, 42, 92,110, 34, 44,101, 41, 10,
-   101,110,100, 10,114,101,116,117,114,110, 32, 99,111,100,101,
-    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 80,
-    97, 99,107, 97,103,101, 32, 40,110, 97,109,101, 44,102,110,
-    41, 10,108,111, 99, 97,108, 32,101,120,116, 32, 61, 32, 34,
-   112,107,103, 34, 10,105,102, 32,102,110, 32,116,104,101,110,
-    10,108,111, 99, 97,108, 32,115,116, 44, 32,109,115,103, 32,
-    61, 32,114,101, 97,100,102,114,111,109, 40,102,108, 97,103,
-   115, 46,102, 41, 10,105,102, 32,110,111,116, 32,115,116, 32,
+   112,111,112, 40, 41, 10,101,110,100, 10,102,117,110, 99,116,
+   105,111,110, 32, 99,108, 97,115,115, 80, 97, 99,107, 97,103,
+   101, 58,104,101, 97,100,101,114, 32, 40, 41, 10,111,117,116,
+   112,117,116, 40, 39, 47, 42, 92,110, 39, 41, 32,111,117,116,
+   112,117,116, 40, 39, 42, 42, 32, 76,117, 97, 32, 98,105,110,
+   100,105,110,103, 58, 32, 39, 46, 46,115,101,108,102, 46,110,
+    97,109,101, 46, 46, 39, 92,110, 39, 41, 10,111,117,116,112,
+   117,116, 40, 39, 42, 42, 32, 71,101,110,101,114, 97,116,101,
+   100, 32, 97,117,116,111,109, 97,116,105, 99, 97,108,108,121,
+    32, 98,121, 32, 39, 46, 46, 84, 79, 76, 85, 65, 95, 86, 69,
+    82, 83, 73, 79, 78, 46, 46, 39, 32,111,110, 32, 39, 46, 46,
+   100, 97,116,101, 40, 41, 46, 46, 39, 46, 92,110, 39, 41, 10,
+   111,117,116,112,117,116, 40, 39, 42, 47, 92,110, 92,110, 39,
+    41, 10,105,102, 32,110,111,116, 32,102,108, 97,103,115, 46,
+   104, 32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39,
+    47, 42, 32, 69,120,112,111,114,116,101,100, 32,102,117,110,
+    99,116,105,111,110, 32, 42, 47, 39, 41, 10,111,117,116,112,
+   117,116, 40, 39, 84, 79, 76, 85, 65, 95, 65, 80, 73, 32,105,
+   110,116, 32,116,111,108,117, 97, 95, 39, 46, 46,115,101,108,
+   102, 46,110, 97,109,101, 46, 46, 39, 95,111,112,101,110, 32,
+    40,108,117, 97, 95, 83,116, 97,116,101, 42, 32,116,111,108,
+   117, 97, 95, 83, 41, 59, 39, 41, 10,111,117,116,112,117,116,
+    40, 39, 76, 85, 65, 76, 73, 66, 95, 65, 80, 73, 32,105,110,
+   116, 32,108,117, 97,111,112,101,110, 95, 39, 46, 46,115,101,
+   108,102, 46,110, 97,109,101, 46, 46, 39, 32, 40,108,117, 97,
+    95, 83,116, 97,116,101, 42, 32,116,111,108,117, 97, 95, 83,
+    41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 92,110,
+    39, 41, 10,101,110,100, 10,101,110,100, 10,102,117,110, 99,
+   116,105,111,110, 32, 95, 80, 97, 99,107, 97,103,101, 32, 40,
+   115,101,108,102, 41, 10,115,101,116,109,101,116, 97,116, 97,
+    98,108,101, 40,115,101,108,102, 44, 99,108, 97,115,115, 80,
+    97, 99,107, 97,103,101, 41, 10,114,101,116,117,114,110, 32,
+   115,101,108,102, 10,101,110,100, 10,102,117,110, 99,116,105,
+   111,110, 32,101,120,116,114, 97, 99,116, 95, 99,111,100,101,
+    40,102,110, 44,115, 41, 10,108,111, 99, 97,108, 32, 99,111,
+   100,101, 32, 61, 32, 39, 92,110, 36, 35,105,110, 99,108,117,
+   100,101, 32, 34, 39, 46, 46,102,110, 46, 46, 39, 34, 92,110,
+    39, 10,115, 61, 32, 34, 92,110, 34, 32, 46, 46, 32,115, 32,
+    46, 46, 32, 34, 92,110, 34, 10,108,111, 99, 97,108, 32, 95,
+    44,101, 44, 99, 44,116, 32, 61, 32,115,116,114,102,105,110,
+   100, 40,115, 44, 32, 34, 92,110, 40, 91, 94, 92,110, 93, 45,
+    41, 91, 84,116, 93, 91, 79,111, 93, 91, 76,108, 93, 91, 85,
+   117, 93, 91, 65, 97, 93, 95, 40, 91, 94, 37,115, 93, 42, 41,
+    91, 94, 92,110, 93, 42, 92,110, 34, 41, 10,119,104,105,108,
+   101, 32,101, 32,100,111, 10,116, 32, 61, 32,115,116,114,108,
+   111,119,101,114, 40,116, 41, 10,105,102, 32,116, 32, 61, 61,
+    32, 34, 98,101,103,105,110, 34, 32,116,104,101,110, 10, 95,
+    44,101, 44, 99, 32, 61, 32,115,116,114,102,105,110,100, 40,
+   115, 44, 34, 40, 46, 45, 41, 92,110, 91, 94, 92,110, 93, 42,
+    91, 84,116, 93, 91, 79,111, 93, 91, 76,108, 93, 91, 85,117,
+    93, 91, 65, 97, 93, 95, 91, 69,101, 93, 91, 78,110, 93, 91,
+    68,100, 93, 91, 94, 92,110, 93, 42, 92,110, 34, 44,101, 41,
+    10,105,102, 32,110,111,116, 32,101, 32,116,104,101,110, 10,
+   116,111,108,117, 97, 95,101,114,114,111,114, 40, 34, 85,110,
+    98, 97,108, 97,110, 99,101,100, 32, 39,116,111,108,117, 97,
+    95, 98,101,103,105,110, 39, 32,100,105,114,101, 99,116,105,
+   118,101, 32,105,110, 32,104,101, 97,100,101,114, 32,102,105,
+   108,101, 34, 41, 10,101,110,100, 10,101,110,100, 10, 99,111,
+   100,101, 32, 61, 32, 99,111,100,101, 32, 46, 46, 32, 99, 32,
+    46, 46, 32, 34, 92,110, 34, 10, 95, 44,101, 44, 99, 44,116,
+    32, 61, 32,115,116,114,102,105,110,100, 40,115, 44, 32, 34,
+    92,110, 40, 91, 94, 92,110, 93, 45, 41, 91, 84,116, 93, 91,
+    79,111, 93, 91, 76,108, 93, 91, 85,117, 93, 91, 65, 97, 93,
+    95, 40, 91, 94, 37,115, 93, 42, 41, 91, 94, 92,110, 93, 42,
+    92,110, 34, 44,101, 41, 10,101,110,100, 10,114,101,116,117,
+   114,110, 32, 99,111,100,101, 10,101,110,100, 10,102,117,110,
+    99,116,105,111,110, 32, 80, 97, 99,107, 97,103,101, 32, 40,
+   110, 97,109,101, 44,102,110, 41, 10,108,111, 99, 97,108, 32,
+   101,120,116, 32, 61, 32, 34,112,107,103, 34, 10,105,102, 32,
+   102,110, 32,116,104,101,110, 10,108,111, 99, 97,108, 32,115,
+   116, 44, 32,109,115,103, 32, 61, 32,114,101, 97,100,102,114,
+   111,109, 40,102,108, 97,103,115, 46,102, 41, 10,105,102, 32,
+   110,111,116, 32,115,116, 32,116,104,101,110, 10,101,114,114,
+   111,114, 40, 39, 35, 39, 46, 46,109,115,103, 41, 10,101,110,
+   100, 10,108,111, 99, 97,108, 32, 95, 59, 32, 95, 44, 32, 95,
+    44, 32,101,120,116, 32, 61, 32,115,116,114,102,105,110,100,
+    40,102,110, 44, 34, 46, 42, 37, 46, 40, 46, 42, 41, 36, 34,
+    41, 10,101,110,100, 10,108,111, 99, 97,108, 32, 99,111,100,
+   101, 32, 61, 32, 34, 92,110, 34, 32, 46, 46, 32,114,101, 97,
+   100, 40, 39, 42, 97, 39, 41, 10,105,102, 32,101,120,116, 32,
+    61, 61, 32, 39,104, 39, 32,111,114, 32,101,120,116, 32, 61,
+    61, 32, 39,104,112,112, 39, 32,116,104,101,110, 10, 99,111,
+   100,101, 32, 61, 32,101,120,116,114, 97, 99,116, 95, 99,111,
+   100,101, 40,102,110, 44, 99,111,100,101, 41, 10,101,110,100,
+    10,105,102, 32,102,110, 32,116,104,101,110, 10,114,101, 97,
+   100,102,114,111,109, 40, 41, 10,101,110,100, 10, 99,111,100,
+   101, 32, 61, 32,103,115,117, 98, 40, 99,111,100,101, 44, 39,
+    37,115, 42, 37, 36,114,101,110, 97,109,105,110,103, 37,115,
+    42, 40, 46, 45, 41, 37,115, 42, 92,110, 39, 44, 32,102,117,
+   110, 99,116,105,111,110, 32, 40,114, 41, 32, 97,112,112,101,
+   110,100,114,101,110, 97,109,105,110,103, 40,114, 41, 32,114,
+   101,116,117,114,110, 32, 34, 92,110, 34, 32,101,110,100, 41,
+    10,108,111, 99, 97,108, 32,110,115,117, 98,115,116, 10,114,
+   101,112,101, 97,116, 10, 99,111,100,101, 44,110,115,117, 98,
+   115,116, 32, 61, 32,103,115,117, 98, 40, 99,111,100,101, 44,
+    39, 92,110, 37,115, 42, 37, 36, 40, 46, 41,102,105,108,101,
+    37,115, 42, 34, 40, 46, 45, 41, 34, 37,115, 42, 92,110, 39,
+    44, 10,102,117,110, 99,116,105,111,110, 32, 40,107,105,110,
+   100, 44,102,110, 41, 10,108,111, 99, 97,108, 32, 95, 44, 32,
+    95, 44, 32,101,120,116, 32, 61, 32,115,116,114,102,105,110,
+   100, 40,102,110, 44, 34, 46, 42, 37, 46, 40, 46, 42, 41, 36,
+    34, 41, 10,108,111, 99, 97,108, 32,102,112, 44,109,115,103,
+    32, 61, 32,111,112,101,110,102,105,108,101, 40,102,110, 44,
+    39,114, 39, 41, 10,105,102, 32,110,111,116, 32,102,112, 32,
    116,104,101,110, 10,101,114,114,111,114, 40, 39, 35, 39, 46,
-    46,109,115,103, 41, 10,101,110,100, 10,108,111, 99, 97,108,
-    32, 95, 59, 32, 95, 44, 32, 95, 44, 32,101,120,116, 32, 61,
-    32,115,116,114,102,105,110,100, 40,102,110, 44, 34, 46, 42,
-    37, 46, 40, 46, 42, 41, 36, 34, 41, 10,101,110,100, 10,108,
-   111, 99, 97,108, 32, 99,111,100,101, 32, 61, 32, 34, 92,110,
-    34, 32, 46, 46, 32,114,101, 97,100, 40, 39, 42, 97, 39, 41,
-    10,105,102, 32,101,120,116, 32, 61, 61, 32, 39,104, 39, 32,
-   111,114, 32,101,120,116, 32, 61, 61, 32, 39,104,112,112, 39,
-    32,116,104,101,110, 10, 99,111,100,101, 32, 61, 32,101,120,
-   116,114, 97, 99,116, 95, 99,111,100,101, 40,102,110, 44, 99,
-   111,100,101, 41, 10,101,110,100, 10,105,102, 32,102,110, 32,
-   116,104,101,110, 10,114,101, 97,100,102,114,111,109, 40, 41,
-    10,101,110,100, 10, 99,111,100,101, 32, 61, 32,103,115,117,
-    98, 40, 99,111,100,101, 44, 39, 37,115, 42, 37, 36,114,101,
-   110, 97,109,105,110,103, 37,115, 42, 40, 46, 45, 41, 37,115,
-    42, 92,110, 39, 44, 32,102,117,110, 99,116,105,111,110, 32,
-    40,114, 41, 32, 97,112,112,101,110,100,114,101,110, 97,109,
-   105,110,103, 40,114, 41, 32,114,101,116,117,114,110, 32, 34,
-    92,110, 34, 32,101,110,100, 41, 10,108,111, 99, 97,108, 32,
-   110,115,117, 98,115,116, 10,114,101,112,101, 97,116, 10, 99,
-   111,100,101, 44,110,115,117, 98,115,116, 32, 61, 32,103,115,
-   117, 98, 40, 99,111,100,101, 44, 39, 92,110, 37,115, 42, 37,
-    36, 40, 46, 41,102,105,108,101, 37,115, 42, 34, 40, 46, 45,
-    41, 34, 37,115, 42, 92,110, 39, 44, 10,102,117,110, 99,116,
-   105,111,110, 32, 40,107,105,110,100, 44,102,110, 41, 10,108,
-   111, 99, 97,108, 32, 95, 44, 32, 95, 44, 32,101,120,116, 32,
-    61, 32,115,116,114,102,105,110,100, 40,102,110, 44, 34, 46,
-    42, 37, 46, 40, 46, 42, 41, 36, 34, 41, 10,108,111, 99, 97,
-   108, 32,102,112, 44,109,115,103, 32, 61, 32,111,112,101,110,
-   102,105,108,101, 40,102,110, 44, 39,114, 39, 41, 10,105,102,
-    32,110,111,116, 32,102,112, 32,116,104,101,110, 10,101,114,
-   114,111,114, 40, 39, 35, 39, 46, 46,109,115,103, 46, 46, 39,
-    58, 32, 39, 46, 46,102,110, 41, 10,101,110,100, 10,108,111,
-    99, 97,108, 32,115, 32, 61, 32,114,101, 97,100, 40,102,112,
-    44, 39, 42, 97, 39, 41, 10, 99,108,111,115,101,102,105,108,
-   101, 40,102,112, 41, 10,105,102, 32,107,105,110,100, 32, 61,
-    61, 32, 39, 99, 39, 32,111,114, 32,107,105,110,100, 32, 61,
-    61, 32, 39,104, 39, 32,116,104,101,110, 10,114,101,116,117,
-   114,110, 32,101,120,116,114, 97, 99,116, 95, 99,111,100,101,
-    40,102,110, 44,115, 41, 10,101,108,115,101,105,102, 32,107,
-   105,110,100, 32, 61, 61, 32, 39,112, 39, 32,116,104,101,110,
-    10,114,101,116,117,114,110, 32, 34, 92,110, 92,110, 34, 32,
-    46, 46, 32,115, 10,101,108,115,101,105,102, 32,107,105,110,
-   100, 32, 61, 61, 32, 39,108, 39, 32,116,104,101,110, 10,114,
-   101,116,117,114,110, 32, 34, 92,110, 36, 91, 92,110, 34, 32,
-    46, 46, 32,115, 32, 46, 46, 32, 34, 92,110, 36, 93, 92,110,
-    34, 10,101,108,115,101, 10,101,114,114,111,114, 40, 39, 35,
-    73,110,118, 97,108,105,100, 32,105,110, 99,108,117,100,101,
-    32,100,105,114,101, 99,116,105,118,101, 32, 40,117,115,101,
-    32, 36, 99,102,105,108,101, 44, 32, 36,112,102,105,108,101,
-    32,111,114, 32, 36,108,102,105,108,101, 41, 39, 41, 10,101,
-   110,100, 10,101,110,100, 41, 10,117,110,116,105,108, 32,110,
-   115,117, 98,115,116, 61, 61, 48, 10,108,111, 99, 97,108, 32,
-   116, 32, 61, 32, 95, 80, 97, 99,107, 97,103,101, 40, 95, 67,
-   111,110,116, 97,105,110,101,114,123,110, 97,109,101, 61,110,
-    97,109,101, 44, 32, 99,111,100,101, 61, 99,111,100,101,125,
-    41, 10,112,117,115,104, 40,116, 41, 10,116, 58,112,114,101,
-   112,114,111, 99,101,115,115, 40, 41, 10,116, 58,112, 97,114,
-   115,101, 40,116, 46, 99,111,100,101, 41, 10,112,111,112, 40,
-    41, 10,114,101,116,117,114,110, 32,116, 10,101,110,100,32
+    46,109,115,103, 46, 46, 39, 58, 32, 39, 46, 46,102,110, 41,
+    10,101,110,100, 10,108,111, 99, 97,108, 32,115, 32, 61, 32,
+   114,101, 97,100, 40,102,112, 44, 39, 42, 97, 39, 41, 10, 99,
+   108,111,115,101,102,105,108,101, 40,102,112, 41, 10,105,102,
+    32,107,105,110,100, 32, 61, 61, 32, 39, 99, 39, 32,111,114,
+    32,107,105,110,100, 32, 61, 61, 32, 39,104, 39, 32,116,104,
+   101,110, 10,114,101,116,117,114,110, 32,101,120,116,114, 97,
+    99,116, 95, 99,111,100,101, 40,102,110, 44,115, 41, 10,101,
+   108,115,101,105,102, 32,107,105,110,100, 32, 61, 61, 32, 39,
+   112, 39, 32,116,104,101,110, 10,114,101,116,117,114,110, 32,
+    34, 92,110, 92,110, 34, 32, 46, 46, 32,115, 10,101,108,115,
+   101,105,102, 32,107,105,110,100, 32, 61, 61, 32, 39,108, 39,
+    32,116,104,101,110, 10,114,101,116,117,114,110, 32, 34, 92,
+   110, 36, 91, 92,110, 34, 32, 46, 46, 32,115, 32, 46, 46, 32,
+    34, 92,110, 36, 93, 92,110, 34, 10,101,108,115,101, 10,101,
+   114,114,111,114, 40, 39, 35, 73,110,118, 97,108,105,100, 32,
+   105,110, 99,108,117,100,101, 32,100,105,114,101, 99,116,105,
+   118,101, 32, 40,117,115,101, 32, 36, 99,102,105,108,101, 44,
+    32, 36,112,102,105,108,101, 32,111,114, 32, 36,108,102,105,
+   108,101, 41, 39, 41, 10,101,110,100, 10,101,110,100, 41, 10,
+   117,110,116,105,108, 32,110,115,117, 98,115,116, 61, 61, 48,
+    10,108,111, 99, 97,108, 32,116, 32, 61, 32, 95, 80, 97, 99,
+   107, 97,103,101, 40, 95, 67,111,110,116, 97,105,110,101,114,
+   123,110, 97,109,101, 61,110, 97,109,101, 44, 32, 99,111,100,
+   101, 61, 99,111,100,101,125, 41, 10,112,117,115,104, 40,116,
+    41, 10,116, 58,112,114,101,112,114,111, 99,101,115,115, 40,
+    41, 10,116, 58,112, 97,114,115,101, 40,116, 46, 99,111,100,
+   101, 41, 10,112,111,112, 40, 41, 10,114,101,116,117,114,110,
+    32,116, 10,101,110,100,32
   };
   luaL_loadbuffer(tolua_S,(char*)B,sizeof(B),"tolua: embedded Lua code") ||
   lua_pcall(tolua_S,0,LUA_MULTRET,0);
@@ -1891,34 +1965,54 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
     46,100, 97,116, 97, 84,121,112,101, 46, 46, 39, 92,110, 39,
     41, 10,101,110,100, 10,101,110,100, 10,102,117,110, 99,116,
    105,111,110, 32, 99,108, 97,115,115, 68,101,102,105,110,101,
-    58,112,114,105,110,116, 32, 40,105,100,101,110,116, 44, 99,
-   108,111,115,101, 41, 10,112,114,105,110,116, 40,105,100,101,
-   110,116, 46, 46, 34, 68,101,102,105,110,101,123, 34, 41, 10,
-   112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,
-   110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,102,
-    46,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41, 10,112,114,
-   105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,108,110,
-    97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,102, 46,
-   108,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41, 10,112,114,
-   105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,100, 97,
-   116, 97, 84,121,112,101, 32, 61, 32, 39, 34, 46, 46,115,101,
-   108,102, 46,100, 97,116, 97, 84,121,112,101, 46, 46, 34, 39,
-    44, 34, 41, 10,112,114,105,110,116, 40,105,100,101,110,116,
-    46, 46, 34,125, 34, 46, 46, 99,108,111,115,101, 41, 10,101,
-   110,100, 10,102,117,110, 99,116,105,111,110, 32, 95, 68,101,
-   102,105,110,101, 32, 40,116, 41, 10,115,101,116,109,101,116,
-    97,116, 97, 98,108,101, 40,116, 44, 99,108, 97,115,115, 68,
-   101,102,105,110,101, 41, 10,116, 58, 98,117,105,108,100,110,
-    97,109,101,115, 40, 41, 10,105,102, 32,116, 46,110, 97,109,
-   101, 32, 61, 61, 32, 39, 39, 32,116,104,101,110, 10,101,114,
-   114,111,114, 40, 34, 35,105,110,118, 97,108,105,100, 32,100,
-   101,102,105,110,101, 34, 41, 10,101,110,100, 10, 97,112,112,
-   101,110,100, 40,116, 41, 10,114,101,116,117,114,110, 32,116,
-    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 68,
-   101,102,105,110,101, 32, 40,110, 44,116, 41, 10,114,101,116,
-   117,114,110, 32, 95, 68,101,102,105,110,101,123, 10,110, 97,
-   109,101, 32, 61, 32,110, 44, 10,100, 97,116, 97, 84,121,112,
-   101, 32, 61, 32,116, 10,125, 10,101,110,100,32
+    58,108, 97,122,121,114,101,103,105,115,116,101,114, 32, 40,
+    98,105,110,100,105,110,103,115, 41, 10,105,102, 32,115,101,
+   108,102, 46,100, 97,116, 97, 84,121,112,101, 32, 61, 61, 32,
+    34,110,117,109, 98,101,114, 34, 32,116,104,101,110, 10, 98,
+   105,110,100,105,110,103,115, 91,115,101,108,102, 46,108,110,
+    97,109,101, 93, 32, 61, 32, 39,123, 34, 39, 46, 46,115,101,
+   108,102, 46,108,110, 97,109,101, 46, 46, 39, 34, 44, 78, 85,
+    76, 76, 44, 39, 46, 46,115,101,108,102, 46,110, 97,109,101,
+    46, 46, 39, 44, 78, 85, 76, 76,125, 39, 10,101,108,115,101,
+   105,102, 32,115,101,108,102, 46,100, 97,116, 97, 84,121,112,
+   101, 32, 61, 61, 32, 34,115,116,114,105,110,103, 34, 32,116,
+   104,101,110, 10, 98,105,110,100,105,110,103,115, 91,115,101,
+   108,102, 46,108,110, 97,109,101, 93, 32, 61, 32, 39,123, 34,
+    39, 46, 46,115,101,108,102, 46,108,110, 97,109,101, 46, 46,
+    39, 34, 44, 78, 85, 76, 76, 44, 48, 44, 39, 46, 46,115,101,
+   108,102, 46,110, 97,109,101, 46, 46, 39,125, 39, 10,101,108,
+   115,101, 10,114,101,116,117,114,110, 32,102, 97,108,115,101,
+    10,101,110,100, 10,114,101,116,117,114,110, 32,116,114,117,
+   101, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
+    99,108, 97,115,115, 68,101,102,105,110,101, 58,112,114,105,
+   110,116, 32, 40,105,100,101,110,116, 44, 99,108,111,115,101,
+    41, 10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46,
+    34, 68,101,102,105,110,101,123, 34, 41, 10,112,114,105,110,
+   116, 40,105,100,101,110,116, 46, 46, 34, 32,110, 97,109,101,
+    32, 61, 32, 39, 34, 46, 46,115,101,108,102, 46,110, 97,109,
+   101, 46, 46, 34, 39, 44, 34, 41, 10,112,114,105,110,116, 40,
+   105,100,101,110,116, 46, 46, 34, 32,108,110, 97,109,101, 32,
+    61, 32, 39, 34, 46, 46,115,101,108,102, 46,108,110, 97,109,
+   101, 46, 46, 34, 39, 44, 34, 41, 10,112,114,105,110,116, 40,
+   105,100,101,110,116, 46, 46, 34, 32,100, 97,116, 97, 84,121,
+   112,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,102, 46,100,
+    97,116, 97, 84,121,112,101, 46, 46, 34, 39, 44, 34, 41, 10,
+   112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,125,
+    34, 46, 46, 99,108,111,115,101, 41, 10,101,110,100, 10,102,
+   117,110, 99,116,105,111,110, 32, 95, 68,101,102,105,110,101,
+    32, 40,116, 41, 10,115,101,116,109,101,116, 97,116, 97, 98,
+   108,101, 40,116, 44, 99,108, 97,115,115, 68,101,102,105,110,
+   101, 41, 10,116, 58, 98,117,105,108,100,110, 97,109,101,115,
+    40, 41, 10,105,102, 32,116, 46,110, 97,109,101, 32, 61, 61,
+    32, 39, 39, 32,116,104,101,110, 10,101,114,114,111,114, 40,
+    34, 35,105,110,118, 97,108,105,100, 32,100,101,102,105,110,
+   101, 34, 41, 10,101,110,100, 10, 97,112,112,101,110,100, 40,
+   116, 41, 10,114,101,116,117,114,110, 32,116, 10,101,110,100,
+    10,102,117,110, 99,116,105,111,110, 32, 68,101,102,105,110,
+   101, 32, 40,110, 44,116, 41, 10,114,101,116,117,114,110, 32,
+    95, 68,101,102,105,110,101,123, 10,110, 97,109,101, 32, 61,
+    32,110, 44, 10,100, 97,116, 97, 84,121,112,101, 32, 61, 32,
+   116, 10,125, 10,101,110,100,32
   };
   luaL_loadbuffer(tolua_S,(char*)B,sizeof(B),"tolua: embedded Lua code") ||
   lua_pcall(tolua_S,0,LUA_MULTRET,0);
@@ -1949,54 +2043,69 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
    102, 91,105, 93, 46, 46, 39, 41, 59, 39, 41, 10,105, 32, 61,
     32,105, 43, 49, 10,101,110,100, 10,101,110,100, 10,102,117,
    110, 99,116,105,111,110, 32, 99,108, 97,115,115, 69,110,117,
-   109,101,114, 97,116,101, 58,112,114,105,110,116, 32, 40,105,
-   100,101,110,116, 44, 99,108,111,115,101, 41, 10,112,114,105,
-   110,116, 40,105,100,101,110,116, 46, 46, 34, 69,110,117,109,
-   101,114, 97,116,101,123, 34, 41, 10,112,114,105,110,116, 40,
-   105,100,101,110,116, 46, 46, 34, 32,110, 97,109,101, 32, 61,
-    32, 34, 46, 46,115,101,108,102, 46,110, 97,109,101, 41, 10,
-   108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101,
-    32,115,101,108,102, 91,105, 93, 32,100,111, 10,112,114,105,
-   110,116, 40,105,100,101,110,116, 46, 46, 34, 32, 39, 34, 46,
-    46,115,101,108,102, 91,105, 93, 46, 46, 34, 39, 40, 34, 46,
-    46,115,101,108,102, 46,108,110, 97,109,101,115, 91,105, 93,
-    46, 46, 34, 41, 44, 34, 41, 10,105, 32, 61, 32,105, 43, 49,
-    10,101,110,100, 10,112,114,105,110,116, 40,105,100,101,110,
-   116, 46, 46, 34,125, 34, 46, 46, 99,108,111,115,101, 41, 10,
-   101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 95, 69,
-   110,117,109,101,114, 97,116,101, 32, 40,116, 41, 10,115,101,
-   116,109,101,116, 97,116, 97, 98,108,101, 40,116, 44, 99,108,
-    97,115,115, 69,110,117,109,101,114, 97,116,101, 41, 10, 97,
-   112,112,101,110,100, 40,116, 41, 10, 97,112,112,101,110,100,
-   101,110,117,109, 40,116, 41, 10,114,101,116,117,114,110, 32,
-   116, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
-    69,110,117,109,101,114, 97,116,101, 32, 40,110, 44, 98, 41,
-    10,108,111, 99, 97,108, 32,116, 32, 61, 32,115,112,108,105,
-   116, 40,115,116,114,115,117, 98, 40, 98, 44, 50, 44, 45, 50,
-    41, 44, 39, 44, 39, 41, 10,108,111, 99, 97,108, 32,105, 32,
-    61, 32, 49, 10,108,111, 99, 97,108, 32,101, 32, 61, 32,123,
-   110, 61, 48,125, 10,119,104,105,108,101, 32,116, 91,105, 93,
-    32,100,111, 10,108,111, 99, 97,108, 32,116,116, 32, 61, 32,
-   115,112,108,105,116, 40,116, 91,105, 93, 44, 39, 61, 39, 41,
-    10,101, 46,110, 32, 61, 32,101, 46,110, 32, 43, 32, 49, 10,
-   101, 91,101, 46,110, 93, 32, 61, 32,116,116, 91, 49, 93, 10,
-   105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,105, 32, 61,
-    32, 49, 10,101, 46,108,110, 97,109,101,115, 32, 61, 32,123,
-   125, 10,119,104,105,108,101, 32,101, 91,105, 93, 32,100,111,
-    10,108,111, 99, 97,108, 32,116, 32, 61, 32,115,112,108,105,
-   116, 40,101, 91,105, 93, 44, 39, 64, 39, 41, 10,101, 91,105,
-    93, 32, 61, 32,116, 91, 49, 93, 10,105,102, 32,110,111,116,
-    32,116, 91, 50, 93, 32,116,104,101,110, 10,116, 91, 50, 93,
-    32, 61, 32, 97,112,112,108,121,114,101,110, 97,109,105,110,
-   103, 40,116, 91, 49, 93, 41, 10,101,110,100, 10,101, 46,108,
-   110, 97,109,101,115, 91,105, 93, 32, 61, 32,116, 91, 50, 93,
-    32,111,114, 32,116, 91, 49, 93, 10,105, 32, 61, 32,105, 43,
-    49, 10,101,110,100, 10,101, 46,110, 97,109,101, 32, 61, 32,
-   110, 10,105,102, 32,110,126, 61, 34, 34, 32,116,104,101,110,
-    10, 84,121,112,101,100,101,102, 40, 34,105,110,116, 32, 34,
-    46, 46,110, 41, 10,101,110,100, 10,114,101,116,117,114,110,
-    32, 95, 69,110,117,109,101,114, 97,116,101, 40,101, 41, 10,
-   101,110,100,32
+   109,101,114, 97,116,101, 58,108, 97,122,121,114,101,103,105,
+   115,116,101,114, 32, 40, 98,105,110,100,105,110,103,115, 41,
+    10,108,111, 99, 97,108, 32,110,115,112, 97, 99,101, 32, 61,
+    32,103,101,116,110, 97,109,101,115,112, 97, 99,101, 40, 99,
+   108, 97,115,115, 67,111,110,116, 97,105,110,101,114, 46, 99,
+   117,114,114, 41, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,
+   119,104,105,108,101, 32,115,101,108,102, 91,105, 93, 32,100,
+   111, 10, 98,105,110,100,105,110,103,115, 91,115,101,108,102,
+    46,108,110, 97,109,101,115, 91,105, 32, 61, 32, 39,123, 34,
+    39, 46, 46,115,101,108,102, 46,108,110, 97,109,101,115, 91,
+   105, 93, 46, 46, 39, 34, 44, 78, 85, 76, 76, 44, 39, 46, 46,
+   110,115,112, 97, 99,101, 46, 46,115,101,108,102, 91,105, 93,
+    46, 46, 39, 44, 78, 85, 76, 76,125, 39, 10,105, 32, 61, 32,
+   105, 43, 49, 10,101,110,100, 10,114,101,116,117,114,110, 32,
+   116,114,117,101, 10,101,110,100, 10,102,117,110, 99,116,105,
+   111,110, 32, 99,108, 97,115,115, 69,110,117,109,101,114, 97,
+   116,101, 58,112,114,105,110,116, 32, 40,105,100,101,110,116,
+    44, 99,108,111,115,101, 41, 10,112,114,105,110,116, 40,105,
+   100,101,110,116, 46, 46, 34, 69,110,117,109,101,114, 97,116,
+   101,123, 34, 41, 10,112,114,105,110,116, 40,105,100,101,110,
+   116, 46, 46, 34, 32,110, 97,109,101, 32, 61, 32, 34, 46, 46,
+   115,101,108,102, 46,110, 97,109,101, 41, 10,108,111, 99, 97,
+   108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,
+   102, 91,105, 93, 32,100,111, 10,112,114,105,110,116, 40,105,
+   100,101,110,116, 46, 46, 34, 32, 39, 34, 46, 46,115,101,108,
+   102, 91,105, 93, 46, 46, 34, 39, 40, 34, 46, 46,115,101,108,
+   102, 46,108,110, 97,109,101,115, 91,105, 93, 46, 46, 34, 41,
+    44, 34, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100,
+    10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
+   125, 34, 46, 46, 99,108,111,115,101, 41, 10,101,110,100, 10,
+   102,117,110, 99,116,105,111,110, 32, 95, 69,110,117,109,101,
+   114, 97,116,101, 32, 40,116, 41, 10,115,101,116,109,101,116,
+    97,116, 97, 98,108,101, 40,116, 44, 99,108, 97,115,115, 69,
+   110,117,109,101,114, 97,116,101, 41, 10, 97,112,112,101,110,
+   100, 40,116, 41, 10, 97,112,112,101,110,100,101,110,117,109,
+    40,116, 41, 10,114,101,116,117,114,110, 32,116, 10,101,110,
+   100, 10,102,117,110, 99,116,105,111,110, 32, 69,110,117,109,
+   101,114, 97,116,101, 32, 40,110, 44, 98, 41, 10,108,111, 99,
+    97,108, 32,116, 32, 61, 32,115,112,108,105,116, 40,115,116,
+   114,115,117, 98, 40, 98, 44, 50, 44, 45, 50, 41, 44, 39, 44,
+    39, 41, 10,108,111, 99, 97,108, 32,105, 32, 61, 32, 49, 10,
+   108,111, 99, 97,108, 32,101, 32, 61, 32,123,110, 61, 48,125,
+    10,119,104,105,108,101, 32,116, 91,105, 93, 32,100,111, 10,
+   108,111, 99, 97,108, 32,116,116, 32, 61, 32,115,112,108,105,
+   116, 40,116, 91,105, 93, 44, 39, 61, 39, 41, 10,101, 46,110,
+    32, 61, 32,101, 46,110, 32, 43, 32, 49, 10,101, 91,101, 46,
+   110, 93, 32, 61, 32,116,116, 91, 49, 93, 10,105, 32, 61, 32,
+   105, 43, 49, 10,101,110,100, 10,105, 32, 61, 32, 49, 10,101,
+    46,108,110, 97,109,101,115, 32, 61, 32,123,125, 10,119,104,
+   105,108,101, 32,101, 91,105, 93, 32,100,111, 10,108,111, 99,
+    97,108, 32,116, 32, 61, 32,115,112,108,105,116, 40,101, 91,
+   105, 93, 44, 39, 64, 39, 41, 10,101, 91,105, 93, 32, 61, 32,
+   116, 91, 49, 93, 10,105,102, 32,110,111,116, 32,116, 91, 50,
+    93, 32,116,104,101,110, 10,116, 91, 50, 93, 32, 61, 32, 97,
+   112,112,108,121,114,101,110, 97,109,105,110,103, 40,116, 91,
+    49, 93, 41, 10,101,110,100, 10,101, 46,108,110, 97,109,101,
+   115, 91,105, 93, 32, 61, 32,116, 91, 50, 93, 32,111,114, 32,
+   116, 91, 49, 93, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,
+   100, 10,101, 46,110, 97,109,101, 32, 61, 32,110, 10,105,102,
+    32,110,126, 61, 34, 34, 32,116,104,101,110, 10, 84,121,112,
+   101,100,101,102, 40, 34,105,110,116, 32, 34, 46, 46,110, 41,
+    10,101,110,100, 10,114,101,116,117,114,110, 32, 95, 69,110,
+   117,109,101,114, 97,116,101, 40,101, 41, 10,101,110,100,32
   };
   luaL_loadbuffer(tolua_S,(char*)B,sizeof(B),"tolua: embedded Lua code") ||
   lua_pcall(tolua_S,0,LUA_MULTRET,0);
@@ -2199,424 +2308,499 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
     44, 38,116,111,108,117, 97, 95,101,114,114, 41, 39, 10,101,
    110,100, 10,101,110,100, 10,102,117,110, 99,116,105,111,110,
     32, 99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,
-   111,110, 58, 98,117,105,108,100,100,101, 99,108, 97,114, 97,
-   116,105,111,110, 32, 40,110, 97,114,103, 44, 32, 99,112,108,
-   117,115,112,108,117,115, 41, 10,108,111, 99, 97,108, 32, 97,
-   114,114, 97,121, 32, 61, 32,115,101,108,102, 46,100,105,109,
-    32,126, 61, 32, 39, 39, 32, 97,110,100, 32,116,111,110,117,
-   109, 98,101,114, 40,115,101,108,102, 46,100,105,109, 41, 61,
-    61,110,105,108, 10,108,111, 99, 97,108, 32,108,105,110,101,
-    32, 61, 32, 34, 34, 10,108,111, 99, 97,108, 32,112,116,114,
-    32, 61, 32, 39, 39, 10,108,111, 99, 97,108, 32,109,111,100,
-    10,108,111, 99, 97,108, 32,116,121,112,101, 32, 61, 32,115,
-   101,108,102, 46,116,121,112,101, 10,105,102, 32,115,101,108,
-   102, 46,100,105,109, 32,126, 61, 32, 39, 39, 32,116,104,101,
-   110, 10,116,121,112,101, 32, 61, 32,103,115,117, 98, 40,115,
-   101,108,102, 46,116,121,112,101, 44, 39, 99,111,110,115,116,
-    37,115, 42, 39, 44, 39, 39, 41, 10,101,110,100, 10,108,111,
-    99, 97,108, 32, 99,116,121,112,101, 32, 61, 32,116,121,112,
-   101, 10,105,102, 32, 99,116,121,112,101, 61, 61, 34,108,117,
-    97, 95, 79, 98,106,101, 99,116, 34, 32,111,114, 32, 99,116,
-   121,112,101, 61, 61, 34,108,117, 97, 95, 70,117,110, 99,116,
-   105,111,110, 34, 32,116,104,101,110, 10, 99,116,121,112,101,
-    32, 61, 32, 34,105,110,116, 34, 10,101,110,100, 10,105,102,
-    32,115,101,108,102, 46,112,116,114,126, 61, 39, 39, 32,116,
-   104,101,110, 32,112,116,114, 32, 61, 32, 39, 42, 39, 32,101,
-   110,100, 10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,
-   116,112, 97,114, 97,109, 40,108,105,110,101, 44, 34, 32, 34,
-    44,115,101,108,102, 46,109,111,100, 44, 99,116,121,112,101,
-    44,112,116,114, 41, 10,105,102, 32, 97,114,114, 97,121, 32,
-   116,104,101,110, 10,108,105,110,101, 32, 61, 32, 99,111,110,
-    99, 97,116,112, 97,114, 97,109, 40,108,105,110,101, 44, 39,
-    42, 39, 41, 10,101,110,100, 10,108,105,110,101, 32, 61, 32,
-    99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,105,110,
-   101, 44,115,101,108,102, 46,110, 97,109,101, 41, 10,105,102,
-    32,115,101,108,102, 46,100,105,109, 32,126, 61, 32, 39, 39,
-    32,116,104,101,110, 10,105,102, 32,116,111,110,117,109, 98,
-   101,114, 40,115,101,108,102, 46,100,105,109, 41,126, 61,110,
-   105,108, 32,116,104,101,110, 10,108,105,110,101, 32, 61, 32,
-    99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,105,110,
-   101, 44, 39, 91, 39, 44,115,101,108,102, 46,100,105,109, 44,
-    39, 93, 59, 39, 41, 10,101,108,115,101, 10,105,102, 32, 99,
-   112,108,117,115,112,108,117,115, 32,116,104,101,110, 10,108,
-   105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,112, 97,114,
-    97,109, 40,108,105,110,101, 44, 39, 32, 61, 32,110,101,119,
-    39, 44,116,121,112,101, 44,112,116,114, 44, 39, 91, 39, 46,
-    46,115,101,108,102, 46,100,105,109, 46, 46, 39, 93, 59, 39,
-    41, 10,101,108,115,101, 10,108,105,110,101, 32, 61, 32, 99,
-   111,110, 99, 97,116,112, 97,114, 97,109, 40,108,105,110,101,
-    44, 39, 32, 61, 32, 40, 39, 44,116,121,112,101, 44,112,116,
-   114, 44, 39, 42, 41, 39, 44, 10, 39,109, 97,108,108,111, 99,
-    40, 40, 39, 44,115,101,108,102, 46,100,105,109, 44, 39, 41,
-    42,115,105,122,101,111,102, 40, 39, 44,116,121,112,101, 44,
-   112,116,114, 44, 39, 41, 41, 59, 39, 41, 10,101,110,100, 10,
-   101,110,100, 10,101,108,115,101, 10,108,111, 99, 97,108, 32,
-   116, 32, 61, 32,105,115, 98, 97,115,105, 99, 40,116,121,112,
-   101, 41, 10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,
-   116,112, 97,114, 97,109, 40,108,105,110,101, 44, 39, 32, 61,
-    32, 39, 41, 10,105,102, 32,116, 32, 61, 61, 32, 39,115,116,
-    97,116,101, 39, 32,116,104,101,110, 10,108,105,110,101, 32,
-    61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,
-   105,110,101, 44, 32, 39,116,111,108,117, 97, 95, 83, 59, 39,
-    41, 10,101,108,115,101, 10,105,102, 32,110,111,116, 32,116,
-    32, 97,110,100, 32,112,116,114, 61, 61, 39, 39, 32,116,104,
-   101,110, 32,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,
-   116,112, 97,114, 97,109, 40,108,105,110,101, 44, 39, 42, 39,
-    41, 32,101,110,100, 10,108,111, 99, 97,108, 32, 99,116, 32,
-    61, 32,116,121,112,101, 10,105,102, 32,116, 32, 61, 61, 32,
-    39,118, 97,108,117,101, 39, 32,111,114, 32,116, 32, 61, 61,
-    32, 39,102,117,110, 99,116,105,111,110, 39, 32,116,104,101,
-   110, 10, 99,116, 32, 61, 32, 39,105,110,116, 39, 10,101,110,
-   100, 10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,
-   112, 97,114, 97,109, 40,108,105,110,101, 44, 39, 40, 40, 39,
-    44,115,101,108,102, 46,109,111,100, 44, 99,116, 41, 10,105,
-   102, 32,110,111,116, 32,116, 32,116,104,101,110, 10,108,105,
+   111,110, 58,105,115,102, 97,115,116, 32, 40, 41, 10,108,111,
+    99, 97,108, 32,116, 32, 61, 32,105,115, 98, 97,115,105, 99,
+    40,115,101,108,102, 46,116,121,112,101, 41, 10,114,101,116,
+   117,114,110, 32, 40,116, 61, 61, 39,110,117,109, 98,101,114,
+    39, 32,111,114, 32,116, 61, 61, 39,115,116,114,105,110,103,
+    39, 32,111,114, 32,116, 61, 61, 39,117,115,101,114,100, 97,
+   116, 97, 39, 32,111,114, 32,116, 61, 61, 39, 98,111,111,108,
+   101, 97,110, 39, 32,111,114, 32,116, 61, 61, 39,115,116, 97,
+   116,101, 39, 41, 32, 97,110,100, 10,115,101,108,102, 46,100,
+   105,109, 32, 61, 61, 32, 39, 39, 32, 97,110,100, 32,115,101,
+   108,102, 46,100,101,102, 32, 61, 61, 32, 39, 39, 32, 97,110,
+   100, 32,115,101,108,102, 46,114,101,116, 32, 61, 61, 32, 39,
+    39, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
+    99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,111,
+   110, 58,111,117,116,102, 97,115,116, 99,104,101, 99,107, 32,
+    40,110, 97,114,103, 41, 10,111,117,116,102, 97,115,116, 99,
+   104,101, 99,107, 40,105,115, 98, 97,115,105, 99, 40,115,101,
+   108,102, 46,116,121,112,101, 41, 44,110, 97,114,103, 41, 10,
+   101,110,100, 10,102,117,110, 99,116,105,111,110, 32,111,117,
+   116,102, 97,115,116, 99,104,101, 99,107, 32, 40,116, 44, 32,
+   110, 97,114,103, 41, 10,105,102, 32,116, 32, 61, 61, 32, 39,
+   115,116, 97,116,101, 39, 32,116,104,101,110, 10,114,101,116,
+   117,114,110, 10,101,108,115,101,105,102, 32,116, 32, 61, 61,
+    32, 39,110,117,109, 98,101,114, 39, 32,116,104,101,110, 10,
+   111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40,108,117,
+    97, 95,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,
+    39, 46, 46,110, 97,114,103, 46, 46, 39, 41, 32, 33, 61, 32,
+    76, 85, 65, 95, 84, 78, 85, 77, 66, 69, 82, 41, 92,110, 39,
+    41, 10,101,108,115,101,105,102, 32,116, 32, 61, 61, 32, 39,
+    98,111,111,108,101, 97,110, 39, 32,116,104,101,110, 10,111,
+   117,116,112,117,116, 40, 39, 32,105,102, 32, 40, 33,108,117,
+    97, 95,105,115, 98,111,111,108,101, 97,110, 40,116,111,108,
+   117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46, 46, 39,
+    41, 32, 38, 38, 32, 33,108,117, 97, 95,105,115,110,105,108,
+    40,116,111,108,117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,
+   103, 46, 46, 39, 41, 41, 92,110, 39, 41, 10,101,108,115,101,
+    10,111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40, 33,
+   108,117, 97, 95,105,115, 39, 46, 46,116, 46, 46, 39, 40,116,
+   111,108,117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46,
+    46, 39, 41, 32, 38, 38, 32, 33,108,117, 97, 95,105,115,110,
+   105,108, 40,116,111,108,117, 97, 95, 83, 44, 39, 46, 46,110,
+    97,114,103, 46, 46, 39, 41, 41, 92,110, 39, 41, 10,101,110,
+   100, 10,111,117,116,112,117,116, 40, 39, 32,114,101,116,117,
+   114,110, 32,108,117, 97, 76, 95,116,121,112,101,114,114,111,
+   114, 40,116,111,108,117, 97, 95, 83, 44, 39, 46, 46,110, 97,
+   114,103, 46, 46, 39, 44, 34, 39, 46, 46,116, 46, 46, 39, 34,
+    41, 59, 39, 41, 10,101,110,100, 10,102,117,110, 99,116,105,
+   111,110, 32,105,115,102, 97,115,116,105,110,116,101,103,101,
+   114, 32, 40,109,111,100, 44, 32,116,121,112,101, 41, 10,108,
+   111, 99, 97,108, 32,109, 44,116, 32, 61, 32, 97,112,112,108,
+   121,116,121,112,101,100,101,102, 40,103,115,117, 98, 40,116,
+   121,112,101, 44, 39, 99,111,110,115,116, 32, 39, 44, 39, 39,
+    41, 41, 10,109, 32, 61, 32,109,111,100, 46, 46, 39, 32, 39,
+    46, 46,109, 46, 46, 39, 32, 39, 46, 46,116, 10,114,101,116,
+   117,114,110, 32,110,111,116, 32,115,116,114,102,105,110,100,
+    40,109, 44, 39,117,110,115,105,103,110,101,100, 39, 41, 32,
+    97,110,100, 32,116, 32,126, 61, 32, 39,102,108,111, 97,116,
+    39, 32, 97,110,100, 32,116, 32,126, 61, 32, 39,100,111,117,
+    98,108,101, 39, 10,101,110,100, 10,102,117,110, 99,116,105,
+   111,110, 32, 99,108, 97,115,115, 68,101, 99,108, 97,114, 97,
+   116,105,111,110, 58, 98,117,105,108,100,100,101, 99,108, 97,
+   114, 97,116,105,111,110, 32, 40,110, 97,114,103, 44, 32, 99,
+   112,108,117,115,112,108,117,115, 44, 32,102, 97,115,116, 41,
+    10,108,111, 99, 97,108, 32, 97,114,114, 97,121, 32, 61, 32,
+   115,101,108,102, 46,100,105,109, 32,126, 61, 32, 39, 39, 32,
+    97,110,100, 32,116,111,110,117,109, 98,101,114, 40,115,101,
+   108,102, 46,100,105,109, 41, 61, 61,110,105,108, 10,108,111,
+    99, 97,108, 32,108,105,110,101, 32, 61, 32, 34, 34, 10,108,
+   111, 99, 97,108, 32,112,116,114, 32, 61, 32, 39, 39, 10,108,
+   111, 99, 97,108, 32,109,111,100, 10,108,111, 99, 97,108, 32,
+   116,121,112,101, 32, 61, 32,115,101,108,102, 46,116,121,112,
+   101, 10,105,102, 32,115,101,108,102, 46,100,105,109, 32,126,
+    61, 32, 39, 39, 32,116,104,101,110, 10,116,121,112,101, 32,
+    61, 32,103,115,117, 98, 40,115,101,108,102, 46,116,121,112,
+   101, 44, 39, 99,111,110,115,116, 37,115, 42, 39, 44, 39, 39,
+    41, 10,101,110,100, 10,108,111, 99, 97,108, 32, 99,116,121,
+   112,101, 32, 61, 32,116,121,112,101, 10,105,102, 32, 99,116,
+   121,112,101, 61, 61, 34,108,117, 97, 95, 79, 98,106,101, 99,
+   116, 34, 32,111,114, 32, 99,116,121,112,101, 61, 61, 34,108,
+   117, 97, 95, 70,117,110, 99,116,105,111,110, 34, 32,116,104,
+   101,110, 10, 99,116,121,112,101, 32, 61, 32, 34,105,110,116,
+    34, 10,101,110,100, 10,105,102, 32,115,101,108,102, 46,112,
+   116,114,126, 61, 39, 39, 32,116,104,101,110, 32,112,116,114,
+    32, 61, 32, 39, 42, 39, 32,101,110,100, 10,108,105,110,101,
+    32, 61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,
+   108,105,110,101, 44, 34, 32, 34, 44,115,101,108,102, 46,109,
+   111,100, 44, 99,116,121,112,101, 44,112,116,114, 41, 10,105,
+   102, 32, 97,114,114, 97,121, 32,116,104,101,110, 10,108,105,
    110,101, 32, 61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,
    109, 40,108,105,110,101, 44, 39, 42, 39, 41, 10,101,110,100,
     10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,112,
-    97,114, 97,109, 40,108,105,110,101, 44, 39, 41, 32, 39, 41,
-    10,105,102, 32,105,115,101,110,117,109, 40,116,121,112,101,
-    41, 32,116,104,101,110, 10,108,105,110,101, 32, 61, 32, 99,
+    97,114, 97,109, 40,108,105,110,101, 44,115,101,108,102, 46,
+   110, 97,109,101, 41, 10,105,102, 32,115,101,108,102, 46,100,
+   105,109, 32,126, 61, 32, 39, 39, 32,116,104,101,110, 10,105,
+   102, 32,116,111,110,117,109, 98,101,114, 40,115,101,108,102,
+    46,100,105,109, 41,126, 61,110,105,108, 32,116,104,101,110,
+    10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,112,
+    97,114, 97,109, 40,108,105,110,101, 44, 39, 91, 39, 44,115,
+   101,108,102, 46,100,105,109, 44, 39, 93, 59, 39, 41, 10,101,
+   108,115,101, 10,105,102, 32, 99,112,108,117,115,112,108,117,
+   115, 32,116,104,101,110, 10,108,105,110,101, 32, 61, 32, 99,
    111,110, 99, 97,116,112, 97,114, 97,109, 40,108,105,110,101,
-    44, 39, 40,105,110,116, 41, 32, 39, 41, 10,101,110,100, 10,
-   108,111, 99, 97,108, 32,100,101,102, 32, 61, 32, 48, 10,105,
-   102, 32,115,101,108,102, 46,100,101,102, 32,126, 61, 32, 39,
-    39, 32,116,104,101,110, 32,100,101,102, 32, 61, 32,115,101,
-   108,102, 46,100,101,102, 32,101,110,100, 10,105,102, 32,116,
-    32,116,104,101,110, 10,105,102, 32,116, 61, 61, 39,102,117,
-   110, 99,116,105,111,110, 39, 32,116,104,101,110, 32,116, 61,
-    39,118, 97,108,117,101, 39, 32,101,110,100, 10,108,105,110,
-   101, 32, 61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109,
-    40,108,105,110,101, 44, 39,116,111,108,117, 97, 95,116,111,
-    39, 46, 46,116, 44, 39, 40,116,111,108,117, 97, 95, 83, 44,
+    44, 39, 32, 61, 32,110,101,119, 39, 44,116,121,112,101, 44,
+   112,116,114, 44, 39, 91, 39, 46, 46,115,101,108,102, 46,100,
+   105,109, 46, 46, 39, 93, 59, 39, 41, 10,101,108,115,101, 10,
+   108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,112, 97,
+   114, 97,109, 40,108,105,110,101, 44, 39, 32, 61, 32, 40, 39,
+    44,116,121,112,101, 44,112,116,114, 44, 39, 42, 41, 39, 44,
+    10, 39,109, 97,108,108,111, 99, 40, 40, 39, 44,115,101,108,
+   102, 46,100,105,109, 44, 39, 41, 42,115,105,122,101,111,102,
+    40, 39, 44,116,121,112,101, 44,112,116,114, 44, 39, 41, 41,
+    59, 39, 41, 10,101,110,100, 10,101,110,100, 10,101,108,115,
+   101, 10,108,111, 99, 97,108, 32,116, 32, 61, 32,105,115, 98,
+    97,115,105, 99, 40,116,121,112,101, 41, 10,108,105,110,101,
+    32, 61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,
+   108,105,110,101, 44, 39, 32, 61, 32, 39, 41, 10,105,102, 32,
+   116, 32, 61, 61, 32, 39,115,116, 97,116,101, 39, 32,116,104,
+   101,110, 10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,
+   116,112, 97,114, 97,109, 40,108,105,110,101, 44, 32, 39,116,
+   111,108,117, 97, 95, 83, 59, 39, 41, 10,101,108,115,101, 10,
+   105,102, 32,110,111,116, 32,116, 32, 97,110,100, 32,112,116,
+   114, 61, 61, 39, 39, 32,116,104,101,110, 32,108,105,110,101,
+    32, 61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,
+   108,105,110,101, 44, 39, 42, 39, 41, 32,101,110,100, 10,108,
+   111, 99, 97,108, 32, 99,116, 32, 61, 32,116,121,112,101, 10,
+   105,102, 32,116, 32, 61, 61, 32, 39,118, 97,108,117,101, 39,
+    32,111,114, 32,116, 32, 61, 61, 32, 39,102,117,110, 99,116,
+   105,111,110, 39, 32,116,104,101,110, 10, 99,116, 32, 61, 32,
+    39,105,110,116, 39, 10,101,110,100, 10,108,105,110,101, 32,
+    61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,
+   105,110,101, 44, 39, 40, 40, 39, 44,115,101,108,102, 46,109,
+   111,100, 44, 99,116, 41, 10,105,102, 32,110,111,116, 32,116,
+    32,116,104,101,110, 10,108,105,110,101, 32, 61, 32, 99,111,
+   110, 99, 97,116,112, 97,114, 97,109, 40,108,105,110,101, 44,
+    39, 42, 39, 41, 10,101,110,100, 10,108,105,110,101, 32, 61,
+    32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,105,
+   110,101, 44, 39, 41, 32, 39, 41, 10,105,102, 32,105,115,101,
+   110,117,109, 40,116,121,112,101, 41, 32,116,104,101,110, 10,
+   108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,112, 97,
+   114, 97,109, 40,108,105,110,101, 44, 39, 40,105,110,116, 41,
+    32, 39, 41, 10,101,110,100, 10,108,111, 99, 97,108, 32,100,
+   101,102, 32, 61, 32, 48, 10,105,102, 32,115,101,108,102, 46,
+   100,101,102, 32,126, 61, 32, 39, 39, 32,116,104,101,110, 32,
+   100,101,102, 32, 61, 32,115,101,108,102, 46,100,101,102, 32,
+   101,110,100, 10,105,102, 32,102, 97,115,116, 32, 97,110,100,
+    32,116, 61, 61, 39,110,117,109, 98,101,114, 39, 32,116,104,
+   101,110, 10,105,102, 32,105,115,102, 97,115,116,105,110,116,
+   101,103,101,114, 40,115,101,108,102, 46,109,111,100, 44,116,
+   121,112,101, 41, 32,116,104,101,110, 10,108,105,110,101, 32,
+    61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,
+   105,110,101, 44, 39,108,117, 97, 95,116,111,105,110,116,101,
+   103,101,114, 40,116,111,108,117, 97, 95, 83, 44, 39, 44,110,
+    97,114,103, 44, 39, 41, 41, 59, 39, 41, 10,101,108,115,101,
+    10,108,105,110,101, 32, 61, 32, 99,111,110, 99, 97,116,112,
+    97,114, 97,109, 40,108,105,110,101, 44, 39,108,117, 97, 95,
+   116,111,110,117,109, 98,101,114, 40,116,111,108,117, 97, 95,
+    83, 44, 39, 44,110, 97,114,103, 44, 39, 41, 41, 59, 39, 41,
+    10,101,110,100, 10,101,108,115,101,105,102, 32,116, 32,116,
+   104,101,110, 10,105,102, 32,116, 61, 61, 39,102,117,110, 99,
+   116,105,111,110, 39, 32,116,104,101,110, 32,116, 61, 39,118,
+    97,108,117,101, 39, 32,101,110,100, 10,108,105,110,101, 32,
+    61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,
+   105,110,101, 44, 39,116,111,108,117, 97, 95,116,111, 39, 46,
+    46,116, 44, 39, 40,116,111,108,117, 97, 95, 83, 44, 39, 44,
+   110, 97,114,103, 44, 39, 44, 39, 44,100,101,102, 44, 39, 41,
+    41, 59, 39, 41, 10,101,108,115,101, 10,108,105,110,101, 32,
+    61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109, 40,108,
+   105,110,101, 44, 39,116,111,108,117, 97, 95,116,111,117,115,
+   101,114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,
     39, 44,110, 97,114,103, 44, 39, 44, 39, 44,100,101,102, 44,
-    39, 41, 41, 59, 39, 41, 10,101,108,115,101, 10,108,105,110,
-   101, 32, 61, 32, 99,111,110, 99, 97,116,112, 97,114, 97,109,
-    40,108,105,110,101, 44, 39,116,111,108,117, 97, 95,116,111,
-   117,115,101,114,116,121,112,101, 40,116,111,108,117, 97, 95,
-    83, 44, 39, 44,110, 97,114,103, 44, 39, 44, 39, 44,100,101,
-   102, 44, 39, 41, 41, 59, 39, 41, 10,101,110,100, 10,101,110,
-   100, 10,101,110,100, 10,114,101,116,117,114,110, 32,108,105,
-   110,101, 10,101,110,100, 10,102,117,110, 99,116,105,111,110,
-    32, 99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,
-   111,110, 58,100,101, 99,108, 97,114,101, 32, 40,110, 97,114,
+    39, 41, 41, 59, 39, 41, 10,101,110,100, 10,101,110,100, 10,
+   101,110,100, 10,114,101,116,117,114,110, 32,108,105,110,101,
+    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,
+   108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,111,110,
+    58,100,101, 99,108, 97,114,101, 32, 40,110, 97,114,103, 44,
+    32,102, 97,115,116, 41, 10,105,102, 32,115,101,108,102, 46,
+   100,105,109, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,115,
+   101,108,102, 46,116,121,112,101,126, 61, 39, 99,104, 97,114,
+    39, 32, 97,110,100, 32,116,111,110,117,109, 98,101,114, 40,
+   115,101,108,102, 46,100,105,109, 41, 61, 61,110,105,108, 32,
+   116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 35,105,
+   102,100,101,102, 32, 95, 95, 99,112,108,117,115,112,108,117,
+   115, 92,110, 39, 41, 10,111,117,116,112,117,116, 40,115,101,
+   108,102, 58, 98,117,105,108,100,100,101, 99,108, 97,114, 97,
+   116,105,111,110, 40,110, 97,114,103, 44,116,114,117,101, 41,
+    41, 10,111,117,116,112,117,116, 40, 39, 35,101,108,115,101,
+    92,110, 39, 41, 10,111,117,116,112,117,116, 40,115,101,108,
+   102, 58, 98,117,105,108,100,100,101, 99,108, 97,114, 97,116,
+   105,111,110, 40,110, 97,114,103, 44,102, 97,108,115,101, 41,
+    41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,
+   102, 92,110, 39, 41, 10,101,108,115,101, 10,111,117,116,112,
+   117,116, 40,115,101,108,102, 58, 98,117,105,108,100,100,101,
+    99,108, 97,114, 97,116,105,111,110, 40,110, 97,114,103, 44,
+   102, 97,108,115,101, 44,102, 97,115,116, 41, 41, 10,101,110,
+   100, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
+    99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,111,
+   110, 58,103,101,116, 97,114,114, 97,121, 32, 40,110, 97,114,
    103, 41, 10,105,102, 32,115,101,108,102, 46,100,105,109, 32,
-   126, 61, 32, 39, 39, 32, 97,110,100, 32,115,101,108,102, 46,
-   116,121,112,101,126, 61, 39, 99,104, 97,114, 39, 32, 97,110,
-   100, 32,116,111,110,117,109, 98,101,114, 40,115,101,108,102,
-    46,100,105,109, 41, 61, 61,110,105,108, 32,116,104,101,110,
-    10,111,117,116,112,117,116, 40, 39, 35,105,102,100,101,102,
-    32, 95, 95, 99,112,108,117,115,112,108,117,115, 92,110, 39,
-    41, 10,111,117,116,112,117,116, 40,115,101,108,102, 58, 98,
-   117,105,108,100,100,101, 99,108, 97,114, 97,116,105,111,110,
-    40,110, 97,114,103, 44,116,114,117,101, 41, 41, 10,111,117,
-   116,112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39, 41,
-    10,111,117,116,112,117,116, 40,115,101,108,102, 58, 98,117,
-   105,108,100,100,101, 99,108, 97,114, 97,116,105,111,110, 40,
-   110, 97,114,103, 44,102, 97,108,115,101, 41, 41, 10,111,117,
+   126, 61, 32, 39, 39, 32,116,104,101,110, 10,108,111, 99, 97,
+   108, 32,116,121,112,101, 32, 61, 32,103,115,117, 98, 40,115,
+   101,108,102, 46,116,121,112,101, 44, 39, 99,111,110,115,116,
+    32, 39, 44, 39, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    32,123, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,105,
+   102,110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76,
+    69, 65, 83, 69, 92,110, 39, 41, 10,108,111, 99, 97,108, 32,
+   100,101,102, 59, 32,105,102, 32,115,101,108,102, 46,100,101,
+   102,126, 61, 39, 39, 32,116,104,101,110, 32,100,101,102, 61,
+    49, 32,101,108,115,101, 32,100,101,102, 61, 48, 32,101,110,
+   100, 10,108,111, 99, 97,108, 32,116, 32, 61, 32,105,115, 98,
+    97,115,105, 99, 40,116,121,112,101, 41, 10,105,102, 32, 40,
+   116, 41, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
+    39, 32,105,102, 32, 40, 33,116,111,108,117, 97, 95,105,115,
+    39, 46, 46,116, 46, 46, 39, 97,114,114, 97,121, 40,116,111,
+   108,117, 97, 95, 83, 44, 39, 44,110, 97,114,103, 44, 39, 44,
+    39, 44,115,101,108,102, 46,100,105,109, 44, 39, 44, 39, 44,
+   100,101,102, 44, 39, 44, 38,116,111,108,117, 97, 95,101,114,
+   114, 41, 41, 39, 41, 10,101,108,115,101, 10,111,117,116,112,
+   117,116, 40, 39, 32,105,102, 32, 40, 33,116,111,108,117, 97,
+    95,105,115,117,115,101,114,116,121,112,101, 97,114,114, 97,
+   121, 40,116,111,108,117, 97, 95, 83, 44, 39, 44,110, 97,114,
+   103, 44, 39, 44, 34, 39, 44,116,121,112,101, 44, 39, 34, 44,
+    39, 44,115,101,108,102, 46,100,105,109, 44, 39, 44, 39, 44,
+   100,101,102, 44, 39, 44, 38,116,111,108,117, 97, 95,101,114,
+   114, 41, 41, 39, 41, 10,101,110,100, 10,111,117,116,112,117,
+   116, 40, 39, 32,103,111,116,111, 32,116,111,108,117, 97, 95,
+   108,101,114,114,111,114, 59, 39, 41, 10,111,117,116,112,117,
+   116, 40, 39, 32,101,108,115,101, 92,110, 39, 41, 10,111,117,
    116,112,117,116, 40, 39, 35,101,110,100,105,102, 92,110, 39,
-    41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,115,
-   101,108,102, 58, 98,117,105,108,100,100,101, 99,108, 97,114,
-    97,116,105,111,110, 40,110, 97,114,103, 44,102, 97,108,115,
-   101, 41, 41, 10,101,110,100, 10,101,110,100, 10,102,117,110,
-    99,116,105,111,110, 32, 99,108, 97,115,115, 68,101, 99,108,
-    97,114, 97,116,105,111,110, 58,103,101,116, 97,114,114, 97,
-   121, 32, 40,110, 97,114,103, 41, 10,105,102, 32,115,101,108,
-   102, 46,100,105,109, 32,126, 61, 32, 39, 39, 32,116,104,101,
-   110, 10,108,111, 99, 97,108, 32,116,121,112,101, 32, 61, 32,
-   103,115,117, 98, 40,115,101,108,102, 46,116,121,112,101, 44,
-    39, 99,111,110,115,116, 32, 39, 44, 39, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 32,123, 39, 41, 10,111,117,116,112,
-   117,116, 40, 39, 35,105,102,110,100,101,102, 32, 84, 79, 76,
-    85, 65, 95, 82, 69, 76, 69, 65, 83, 69, 92,110, 39, 41, 10,
-   108,111, 99, 97,108, 32,100,101,102, 59, 32,105,102, 32,115,
-   101,108,102, 46,100,101,102,126, 61, 39, 39, 32,116,104,101,
-   110, 32,100,101,102, 61, 49, 32,101,108,115,101, 32,100,101,
-   102, 61, 48, 32,101,110,100, 10,108,111, 99, 97,108, 32,116,
+    41, 10,111,117,116,112,117,116, 40, 39, 32,123, 39, 41, 10,
+   111,117,116,112,117,116, 40, 39, 32,105,110,116, 32,105, 59,
+    39, 41, 10,111,117,116,112,117,116, 40, 39, 32,102,111,114,
+    40,105, 61, 48, 59, 32,105, 60, 39, 46, 46,115,101,108,102,
+    46,100,105,109, 46, 46, 39, 59,105, 43, 43, 41, 39, 41, 10,
+   108,111, 99, 97,108, 32,116, 32, 61, 32,105,115, 98, 97,115,
+   105, 99, 40,116,121,112,101, 41, 10,108,111, 99, 97,108, 32,
+   112,116,114, 32, 61, 32, 39, 39, 10,105,102, 32,115,101,108,
+   102, 46,112,116,114,126, 61, 39, 39, 32,116,104,101,110, 32,
+   112,116,114, 32, 61, 32, 39, 42, 39, 32,101,110,100, 10,111,
+   117,116,112,117,116, 40, 39, 32, 39, 44,115,101,108,102, 46,
+   110, 97,109,101, 46, 46, 39, 91,105, 93, 32, 61, 32, 39, 41,
+    10,105,102, 32,110,111,116, 32,116, 32, 97,110,100, 32,112,
+   116,114, 61, 61, 39, 39, 32,116,104,101,110, 32,111,117,116,
+   112,117,116, 40, 39, 42, 39, 41, 32,101,110,100, 10,111,117,
+   116,112,117,116, 40, 39, 40, 40, 39, 44,116,121,112,101, 41,
+    10,105,102, 32,110,111,116, 32,116, 32,116,104,101,110, 10,
+   111,117,116,112,117,116, 40, 39, 42, 39, 41, 10,101,110,100,
+    10,111,117,116,112,117,116, 40, 39, 41, 32, 39, 41, 10,108,
+   111, 99, 97,108, 32,100,101,102, 32, 61, 32, 48, 10,105,102,
+    32,115,101,108,102, 46,100,101,102, 32,126, 61, 32, 39, 39,
+    32,116,104,101,110, 32,100,101,102, 32, 61, 32,115,101,108,
+   102, 46,100,101,102, 32,101,110,100, 10,105,102, 32,116, 32,
+   116,104,101,110, 10,105,102, 32,116, 61, 61, 39,102,117,110,
+    99,116,105,111,110, 39, 32,116,104,101,110, 32,116, 61, 39,
+   118, 97,108,117,101, 39, 32,101,110,100, 10,111,117,116,112,
+   117,116, 40, 39,116,111,108,117, 97, 95,116,111,102,105,101,
+   108,100, 39, 46, 46,116, 46, 46, 39, 40,116,111,108,117, 97,
+    95, 83, 44, 39, 44,110, 97,114,103, 44, 39, 44,105, 43, 49,
+    44, 39, 44,100,101,102, 44, 39, 41, 41, 59, 39, 41, 10,101,
+   108,115,101, 10,111,117,116,112,117,116, 40, 39,116,111,108,
+   117, 97, 95,116,111,102,105,101,108,100,117,115,101,114,116,
+   121,112,101, 40,116,111,108,117, 97, 95, 83, 44, 39, 44,110,
+    97,114,103, 44, 39, 44,105, 43, 49, 44, 39, 44,100,101,102,
+    44, 39, 41, 41, 59, 39, 41, 10,101,110,100, 10,111,117,116,
+   112,117,116, 40, 39, 32,125, 39, 41, 10,111,117,116,112,117,
+   116, 40, 39, 32,125, 39, 41, 10,101,110,100, 10,101,110,100,
+    10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,115,115,
+    68,101, 99,108, 97,114, 97,116,105,111,110, 58,115,101,116,
+    97,114,114, 97,121, 32, 40,110, 97,114,103, 41, 10,105,102,
+    32,110,111,116, 32,115,116,114,102,105,110,100, 40,115,101,
+   108,102, 46,116,121,112,101, 44, 39, 99,111,110,115,116, 39,
+    41, 32, 97,110,100, 32,115,101,108,102, 46,100,105,109, 32,
+   126, 61, 32, 39, 39, 32,116,104,101,110, 10,108,111, 99, 97,
+   108, 32,116,121,112,101, 32, 61, 32,103,115,117, 98, 40,115,
+   101,108,102, 46,116,121,112,101, 44, 39, 99,111,110,115,116,
+    32, 39, 44, 39, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    32,123, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,105,
+   110,116, 32,105, 59, 39, 41, 10,111,117,116,112,117,116, 40,
+    39, 32,102,111,114, 40,105, 61, 48, 59, 32,105, 60, 39, 46,
+    46,115,101,108,102, 46,100,105,109, 46, 46, 39, 59,105, 43,
+    43, 41, 39, 41, 10,108,111, 99, 97,108, 32,116, 44, 99,116,
     32, 61, 32,105,115, 98, 97,115,105, 99, 40,116,121,112,101,
-    41, 10,105,102, 32, 40,116, 41, 32,116,104,101,110, 10,111,
-   117,116,112,117,116, 40, 39, 32,105,102, 32, 40, 33,116,111,
-   108,117, 97, 95,105,115, 39, 46, 46,116, 46, 46, 39, 97,114,
-   114, 97,121, 40,116,111,108,117, 97, 95, 83, 44, 39, 44,110,
-    97,114,103, 44, 39, 44, 39, 44,115,101,108,102, 46,100,105,
-   109, 44, 39, 44, 39, 44,100,101,102, 44, 39, 44, 38,116,111,
-   108,117, 97, 95,101,114,114, 41, 41, 39, 41, 10,101,108,115,
-   101, 10,111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40,
-    33,116,111,108,117, 97, 95,105,115,117,115,101,114,116,121,
-   112,101, 97,114,114, 97,121, 40,116,111,108,117, 97, 95, 83,
-    44, 39, 44,110, 97,114,103, 44, 39, 44, 34, 39, 44,116,121,
-   112,101, 44, 39, 34, 44, 39, 44,115,101,108,102, 46,100,105,
-   109, 44, 39, 44, 39, 44,100,101,102, 44, 39, 44, 38,116,111,
-   108,117, 97, 95,101,114,114, 41, 41, 39, 41, 10,101,110,100,
-    10,111,117,116,112,117,116, 40, 39, 32,103,111,116,111, 32,
-   116,111,108,117, 97, 95,108,101,114,114,111,114, 59, 39, 41,
-    10,111,117,116,112,117,116, 40, 39, 32,101,108,115,101, 92,
-   110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,
-   100,105,102, 92,110, 39, 41, 10,111,117,116,112,117,116, 40,
-    39, 32,123, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,
-   105,110,116, 32,105, 59, 39, 41, 10,111,117,116,112,117,116,
-    40, 39, 32,102,111,114, 40,105, 61, 48, 59, 32,105, 60, 39,
-    46, 46,115,101,108,102, 46,100,105,109, 46, 46, 39, 59,105,
-    43, 43, 41, 39, 41, 10,108,111, 99, 97,108, 32,116, 32, 61,
-    32,105,115, 98, 97,115,105, 99, 40,116,121,112,101, 41, 10,
-   108,111, 99, 97,108, 32,112,116,114, 32, 61, 32, 39, 39, 10,
-   105,102, 32,115,101,108,102, 46,112,116,114,126, 61, 39, 39,
-    32,116,104,101,110, 32,112,116,114, 32, 61, 32, 39, 42, 39,
-    32,101,110,100, 10,111,117,116,112,117,116, 40, 39, 32, 39,
-    44,115,101,108,102, 46,110, 97,109,101, 46, 46, 39, 91,105,
-    93, 32, 61, 32, 39, 41, 10,105,102, 32,110,111,116, 32,116,
-    32, 97,110,100, 32,112,116,114, 61, 61, 39, 39, 32,116,104,
-   101,110, 32,111,117,116,112,117,116, 40, 39, 42, 39, 41, 32,
-   101,110,100, 10,111,117,116,112,117,116, 40, 39, 40, 40, 39,
-    44,116,121,112,101, 41, 10,105,102, 32,110,111,116, 32,116,
-    32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 42,
-    39, 41, 10,101,110,100, 10,111,117,116,112,117,116, 40, 39,
-    41, 32, 39, 41, 10,108,111, 99, 97,108, 32,100,101,102, 32,
-    61, 32, 48, 10,105,102, 32,115,101,108,102, 46,100,101,102,
-    32,126, 61, 32, 39, 39, 32,116,104,101,110, 32,100,101,102,
-    32, 61, 32,115,101,108,102, 46,100,101,102, 32,101,110,100,
-    10,105,102, 32,116, 32,116,104,101,110, 10,105,102, 32,116,
-    61, 61, 39,102,117,110, 99,116,105,111,110, 39, 32,116,104,
-   101,110, 32,116, 61, 39,118, 97,108,117,101, 39, 32,101,110,
-   100, 10,111,117,116,112,117,116, 40, 39,116,111,108,117, 97,
-    95,116,111,102,105,101,108,100, 39, 46, 46,116, 46, 46, 39,
-    40,116,111,108,117, 97, 95, 83, 44, 39, 44,110, 97,114,103,
-    44, 39, 44,105, 43, 49, 44, 39, 44,100,101,102, 44, 39, 41,
-    41, 59, 39, 41, 10,101,108,115,101, 10,111,117,116,112,117,
-   116, 40, 39,116,111,108,117, 97, 95,116,111,102,105,101,108,
+    41, 10,105,102, 32,116, 32,116,104,101,110, 10,105,102, 32,
+   116, 61, 61, 39,102,117,110, 99,116,105,111,110, 39, 32,116,
+   104,101,110, 32,116, 61, 39,118, 97,108,117,101, 39, 32,101,
+   110,100, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,
+   117, 97, 95,112,117,115,104,102,105,101,108,100, 39, 46, 46,
+   116, 46, 46, 39, 40,116,111,108,117, 97, 95, 83, 44, 39, 44,
+   110, 97,114,103, 44, 39, 44,105, 43, 49, 44, 40, 39, 44, 99,
+   116, 44, 39, 41, 39, 44,115,101,108,102, 46,110, 97,109,101,
+    44, 39, 91,105, 93, 41, 59, 39, 41, 10,101,108,115,101, 10,
+   105,102, 32,115,101,108,102, 46,112,116,114, 32, 61, 61, 32,
+    39, 39, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
+    39, 32,123, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,
+   105,102,100,101,102, 32, 95, 95, 99,112,108,117,115,112,108,
+   117,115, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    32,118,111,105,100, 42, 32,116,111,108,117, 97, 95,111, 98,
+   106, 32, 61, 32,110,101,119, 39, 44,116,121,112,101, 44, 39,
+    40, 39, 44,115,101,108,102, 46,110, 97,109,101, 44, 39, 91,
+   105, 93, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    32,116,111,108,117, 97, 95,112,117,115,104,102,105,101,108,
    100,117,115,101,114,116,121,112,101, 40,116,111,108,117, 97,
     95, 83, 44, 39, 44,110, 97,114,103, 44, 39, 44,105, 43, 49,
-    44, 39, 44,100,101,102, 44, 39, 41, 41, 59, 39, 41, 10,101,
-   110,100, 10,111,117,116,112,117,116, 40, 39, 32,125, 39, 41,
+    44,116,111,108,117, 97, 95, 99,108,111,110,101, 40,116,111,
+   108,117, 97, 95, 83, 44,116,111,108,117, 97, 95,111, 98,106,
+    44, 39, 46, 46, 32, 40, 95, 99,111,108,108,101, 99,116, 91,
+   116,121,112,101, 93, 32,111,114, 32, 39, 78, 85, 76, 76, 39,
+    41, 32, 46, 46, 39, 41, 44, 34, 39, 44,116,121,112,101, 44,
+    39, 34, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    35,101,108,115,101, 92,110, 39, 41, 10,111,117,116,112,117,
+   116, 40, 39, 32,118,111,105,100, 42, 32,116,111,108,117, 97,
+    95,111, 98,106, 32, 61, 32,116,111,108,117, 97, 95, 99,111,
+   112,121, 40,116,111,108,117, 97, 95, 83, 44, 40,118,111,105,
+   100, 42, 41, 38, 39, 44,115,101,108,102, 46,110, 97,109,101,
+    44, 39, 91,105, 93, 44,115,105,122,101,111,102, 40, 39, 44,
+   116,121,112,101, 44, 39, 41, 41, 59, 39, 41, 10,111,117,116,
+   112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,117,115,
+   104,102,105,101,108,100,117,115,101,114,116,121,112,101, 40,
+   116,111,108,117, 97, 95, 83, 44, 39, 44,110, 97,114,103, 44,
+    39, 44,105, 43, 49, 44,116,111,108,117, 97, 95, 99,108,111,
+   110,101, 40,116,111,108,117, 97, 95, 83, 44,116,111,108,117,
+    97, 95,111, 98,106, 44, 78, 85, 76, 76, 41, 44, 34, 39, 44,
+   116,121,112,101, 44, 39, 34, 41, 59, 39, 41, 10,111,117,116,
+   112,117,116, 40, 39, 35,101,110,100,105,102, 92,110, 39, 41,
     10,111,117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,101,
-   110,100, 10,101,110,100, 10,102,117,110, 99,116,105,111,110,
-    32, 99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,
-   111,110, 58,115,101,116, 97,114,114, 97,121, 32, 40,110, 97,
-   114,103, 41, 10,105,102, 32,110,111,116, 32,115,116,114,102,
-   105,110,100, 40,115,101,108,102, 46,116,121,112,101, 44, 39,
-    99,111,110,115,116, 39, 41, 32, 97,110,100, 32,115,101,108,
-   102, 46,100,105,109, 32,126, 61, 32, 39, 39, 32,116,104,101,
-   110, 10,108,111, 99, 97,108, 32,116,121,112,101, 32, 61, 32,
-   103,115,117, 98, 40,115,101,108,102, 46,116,121,112,101, 44,
-    39, 99,111,110,115,116, 32, 39, 44, 39, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 32,123, 39, 41, 10,111,117,116,112,
-   117,116, 40, 39, 32,105,110,116, 32,105, 59, 39, 41, 10,111,
-   117,116,112,117,116, 40, 39, 32,102,111,114, 40,105, 61, 48,
-    59, 32,105, 60, 39, 46, 46,115,101,108,102, 46,100,105,109,
-    46, 46, 39, 59,105, 43, 43, 41, 39, 41, 10,108,111, 99, 97,
-   108, 32,116, 44, 99,116, 32, 61, 32,105,115, 98, 97,115,105,
-    99, 40,116,121,112,101, 41, 10,105,102, 32,116, 32,116,104,
-   101,110, 10,105,102, 32,116, 61, 61, 39,102,117,110, 99,116,
-   105,111,110, 39, 32,116,104,101,110, 32,116, 61, 39,118, 97,
-   108,117,101, 39, 32,101,110,100, 10,111,117,116,112,117,116,
-    40, 39, 32,116,111,108,117, 97, 95,112,117,115,104,102,105,
-   101,108,100, 39, 46, 46,116, 46, 46, 39, 40,116,111,108,117,
-    97, 95, 83, 44, 39, 44,110, 97,114,103, 44, 39, 44,105, 43,
-    49, 44, 40, 39, 44, 99,116, 44, 39, 41, 39, 44,115,101,108,
-   102, 46,110, 97,109,101, 44, 39, 91,105, 93, 41, 59, 39, 41,
-    10,101,108,115,101, 10,105,102, 32,115,101,108,102, 46,112,
-   116,114, 32, 61, 61, 32, 39, 39, 32,116,104,101,110, 10,111,
-   117,116,112,117,116, 40, 39, 32,123, 39, 41, 10,111,117,116,
-   112,117,116, 40, 39, 35,105,102,100,101,102, 32, 95, 95, 99,
-   112,108,117,115,112,108,117,115, 92,110, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 32,118,111,105,100, 42, 32,116,111,
-   108,117, 97, 95,111, 98,106, 32, 61, 32,110,101,119, 39, 44,
-   116,121,112,101, 44, 39, 40, 39, 44,115,101,108,102, 46,110,
-    97,109,101, 44, 39, 91,105, 93, 41, 59, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,117,
-   115,104,102,105,101,108,100,117,115,101,114,116,121,112,101,
-    40,116,111,108,117, 97, 95, 83, 44, 39, 44,110, 97,114,103,
-    44, 39, 44,105, 43, 49, 44,116,111,108,117, 97, 95, 99,108,
-   111,110,101, 40,116,111,108,117, 97, 95, 83, 44,116,111,108,
-   117, 97, 95,111, 98,106, 44, 39, 46, 46, 32, 40, 95, 99,111,
-   108,108,101, 99,116, 91,116,121,112,101, 93, 32,111,114, 32,
-    39, 78, 85, 76, 76, 39, 41, 32, 46, 46, 39, 41, 44, 34, 39,
-    44,116,121,112,101, 44, 39, 34, 41, 59, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39, 41,
-    10,111,117,116,112,117,116, 40, 39, 32,118,111,105,100, 42,
-    32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,116,111,
-   108,117, 97, 95, 99,111,112,121, 40,116,111,108,117, 97, 95,
-    83, 44, 40,118,111,105,100, 42, 41, 38, 39, 44,115,101,108,
-   102, 46,110, 97,109,101, 44, 39, 91,105, 93, 44,115,105,122,
-   101,111,102, 40, 39, 44,116,121,112,101, 44, 39, 41, 41, 59,
-    39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,
-   117, 97, 95,112,117,115,104,102,105,101,108,100,117,115,101,
-   114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44, 39,
-    44,110, 97,114,103, 44, 39, 44,105, 43, 49, 44,116,111,108,
-   117, 97, 95, 99,108,111,110,101, 40,116,111,108,117, 97, 95,
-    83, 44,116,111,108,117, 97, 95,111, 98,106, 44, 78, 85, 76,
-    76, 41, 44, 34, 39, 44,116,121,112,101, 44, 39, 34, 41, 59,
-    39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,
-   105,102, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,
-    32,125, 39, 41, 10,101,108,115,101, 10,111,117,116,112,117,
-   116, 40, 39, 32,116,111,108,117, 97, 95,112,117,115,104,102,
-   105,101,108,100,117,115,101,114,116,121,112,101, 40,116,111,
-   108,117, 97, 95, 83, 44, 39, 44,110, 97,114,103, 44, 39, 44,
-   105, 43, 49, 44, 40,118,111,105,100, 42, 41, 39, 44,115,101,
-   108,102, 46,110, 97,109,101, 44, 39, 91,105, 93, 44, 34, 39,
-    44,116,121,112,101, 44, 39, 34, 41, 59, 39, 41, 10,101,110,
-   100, 10,101,110,100, 10,111,117,116,112,117,116, 40, 39, 32,
-   125, 39, 41, 10,101,110,100, 10,101,110,100, 10,102,117,110,
-    99,116,105,111,110, 32, 99,108, 97,115,115, 68,101, 99,108,
-    97,114, 97,116,105,111,110, 58,102,114,101,101, 97,114,114,
-    97,121, 32, 40, 41, 10,105,102, 32,115,101,108,102, 46,100,
-   105,109, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,116,111,
-   110,117,109, 98,101,114, 40,115,101,108,102, 46,100,105,109,
-    41, 61, 61,110,105,108, 32,116,104,101,110, 10,111,117,116,
-   112,117,116, 40, 39, 35,105,102,100,101,102, 32, 95, 95, 99,
-   112,108,117,115,112,108,117,115, 92,110, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39, 32,100,101,108,101,116,101, 32, 91,
-    93, 39, 44,115,101,108,102, 46,110, 97,109,101, 44, 39, 59,
-    39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,108,115,
-   101, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,
-   102,114,101,101, 40, 39, 44,115,101,108,102, 46,110, 97,109,
-   101, 44, 39, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40,
-    39, 35,101,110,100,105,102, 92,110, 39, 41, 10,101,110,100,
-    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,
-   108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,111,110,
-    58,112, 97,115,115,112, 97,114, 32, 40, 41, 10,105,102, 32,
-   115,101,108,102, 46,112,116,114, 61, 61, 39, 38, 39, 32,116,
-   104,101,110, 10,111,117,116,112,117,116, 40, 39, 42, 39, 46,
-    46,115,101,108,102, 46,110, 97,109,101, 41, 10,101,108,115,
-   101,105,102, 32,115,101,108,102, 46,114,101,116, 61, 61, 39,
-    42, 39, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
-    39, 38, 39, 46, 46,115,101,108,102, 46,110, 97,109,101, 41,
-    10,101,108,115,101,105,102, 32,115,101,108,102, 46,116,121,
-   112,101, 61, 61, 34,116,111,108,117, 97, 95,105,110,100,101,
-   120, 34, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
-    34, 40, 34, 46, 46,115,101,108,102, 46,110, 97,109,101, 46,
-    46, 34, 45, 49, 41, 34, 41, 10,101,108,115,101, 10,111,117,
-   116,112,117,116, 40,115,101,108,102, 46,110, 97,109,101, 41,
-    10,101,110,100, 10,101,110,100, 10,102,117,110, 99,116,105,
-   111,110, 32, 99,108, 97,115,115, 68,101, 99,108, 97,114, 97,
-   116,105,111,110, 58,114,101,116,118, 97,108,117,101, 32, 40,
-    41, 10,105,102, 32,115,101,108,102, 46,114,101,116, 32,126,
-    61, 32, 39, 39, 32,116,104,101,110, 10,108,111, 99, 97,108,
-    32,116, 44, 99,116, 32, 61, 32,105,115, 98, 97,115,105, 99,
-    40,115,101,108,102, 46,116,121,112,101, 41, 10,105,102, 32,
-   116, 32,116,104,101,110, 10,105,102, 32,116, 61, 61, 39,102,
-   117,110, 99,116,105,111,110, 39, 32,116,104,101,110, 32,116,
-    61, 39,118, 97,108,117,101, 39, 32,101,110,100, 10,111,117,
-   116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,117,
-   115,104, 39, 46, 46,116, 46, 46, 39, 40,116,111,108,117, 97,
-    95, 83, 44, 40, 39, 44, 99,116, 44, 39, 41, 39, 46, 46,115,
-   101,108,102, 46,110, 97,109,101, 46, 46, 39, 41, 59, 39, 41,
-    10,101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,
-   116,111,108,117, 97, 95,112,117,115,104,117,115,101,114,116,
-   121,112,101, 40,116,111,108,117, 97, 95, 83, 44, 40,118,111,
-   105,100, 42, 41, 39, 46, 46,115,101,108,102, 46,110, 97,109,
-   101, 46, 46, 39, 44, 34, 39, 44,115,101,108,102, 46,116,121,
-   112,101, 44, 39, 34, 41, 59, 39, 41, 10,101,110,100, 10,114,
-   101,116,117,114,110, 32, 49, 10,101,110,100, 10,114,101,116,
-   117,114,110, 32, 48, 10,101,110,100, 10,102,117,110, 99,116,
-   105,111,110, 32, 95, 68,101, 99,108, 97,114, 97,116,105,111,
-   110, 32, 40,116, 41, 10,115,101,116,109,101,116, 97,116, 97,
-    98,108,101, 40,116, 44, 99,108, 97,115,115, 68,101, 99,108,
-    97,114, 97,116,105,111,110, 41, 10,116, 58, 98,117,105,108,
-   100,110, 97,109,101,115, 40, 41, 10,116, 58, 99,104,101, 99,
-   107,110, 97,109,101, 40, 41, 10,116, 58, 99,104,101, 99,107,
-   116,121,112,101, 40, 41, 10,114,101,116,117,114,110, 32,116,
-    10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 68,
-   101, 99,108, 97,114, 97,116,105,111,110, 32, 40,115, 44,107,
-   105,110,100, 41, 10,115, 32, 61, 32,103,115,117, 98, 40,115,
-    44, 34, 37,115, 42, 61, 37,115, 42, 34, 44, 34, 61, 34, 41,
-    10,105,102, 32,107,105,110,100, 32, 61, 61, 32, 34,118, 97,
-   114, 34, 32,116,104,101,110, 10,105,102, 32,115, 32, 61, 61,
-    32, 39, 39, 32,111,114, 32,115, 32, 61, 61, 32, 39,118,111,
-   105,100, 39, 32,116,104,101,110, 10,114,101,116,117,114,110,
-    32, 95, 68,101, 99,108, 97,114, 97,116,105,111,110,123,116,
-   121,112,101, 32, 61, 32, 39,118,111,105,100, 39, 44, 32,107,
-   105,110,100, 32, 61, 32,107,105,110,100,125, 10,101,110,100,
-    10,101,110,100, 10,108,111, 99, 97,108, 32,116, 32, 61, 32,
-   115,112,108,105,116, 40,115, 44, 39, 37, 42, 37,115, 42, 38,
-    39, 41, 10,105,102, 32,116, 46,110, 32, 61, 61, 32, 50, 32,
-   116,104,101,110, 10,105,102, 32,107,105,110,100, 32, 61, 61,
-    32, 39,102,117,110, 99, 39, 32,116,104,101,110, 10,101,114,
-   114,111,114, 40, 34, 35,105,110,118, 97,108,105,100, 32,102,
-   117,110, 99,116,105,111,110, 32,114,101,116,117,114,110, 32,
-   116,121,112,101, 58, 32, 34, 46, 46,115, 41, 10,101,110,100,
-    10,108,111, 99, 97,108, 32,109, 32, 61, 32,115,112,108,105,
-   116, 40,116, 91, 49, 93, 44, 39, 37,115, 37,115, 42, 39, 41,
-    10,114,101,116,117,114,110, 32, 95, 68,101, 99,108, 97,114,
-    97,116,105,111,110,123, 10,110, 97,109,101, 32, 61, 32,116,
-    91, 50, 93, 44, 10,112,116,114, 32, 61, 32, 39, 42, 39, 44,
-    10,114,101,116, 32, 61, 32, 39, 38, 39, 44, 10,116,121,112,
-   101, 32, 61, 32,109, 91,109, 46,110, 93, 44, 10,109,111,100,
-    32, 61, 32, 99,111,110, 99, 97,116, 40,109, 44, 49, 44,109,
-    46,110, 45, 49, 41, 44, 10,107,105,110,100, 32, 61, 32,107,
-   105,110,100, 10,125, 10,101,110,100, 10,116, 32, 61, 32,115,
-   112,108,105,116, 40,115, 44, 39, 37, 42, 37,115, 42, 37, 42,
-    39, 41, 10,105,102, 32,116, 46,110, 32, 61, 61, 32, 50, 32,
-   116,104,101,110, 10,105,102, 32,107,105,110,100, 32, 61, 61,
-    32, 39,102,117,110, 99, 39, 32,116,104,101,110, 10,101,114,
-   114,111,114, 40, 34, 35,105,110,118, 97,108,105,100, 32,102,
-   117,110, 99,116,105,111,110, 32,114,101,116,117,114,110, 32,
-   116,121,112,101, 58, 32, 34, 46, 46,115, 41, 10,101,110,100,
-    10,108,111, 99, 97,108, 32,109, 32, 61, 32,115,112,108,105,
-   116, 40,116, 91, 49, 93, 44, 39, 37,115, 37,115, 42, 39, 41,
-    10,114,101,116,117,114,110, 32, 95, 68,101, 99,108, 97,114,
-    97,116,105,111,110,123, 10,110, 97,109,101, 32, 61, 32,116,
-    91, 50, 93, 44, 10,112,116,114, 32, 61, 32, 39, 42, 39, 44,
-    10,114,101,116, 32, 61, 32, 39, 42, 39, 44, 10,116,121,112,
-   101, 32, 61, 32,109, 91,109, 46,110, 93, 44, 10,109,111,100,
-    32, 61, 32, 99,111,110, 99, 97,116, 40,109, 44, 49, 44,109,
-    46,110, 45, 49, 41, 44, 10,107,105,110,100, 32, 61, 32,107,
-   105,110,100, 10,125, 10,101,110,100, 10,116, 32, 61, 32,115,
-   112,108,105,116, 40,115, 44, 39, 38, 39, 41, 10,105,102, 32,
-   116, 46,110, 32, 61, 61, 32, 50, 32,116,104,101,110, 10,108,
-   111, 99, 97,108, 32,109, 32, 61, 32,115,112,108,105,116, 40,
-   116, 91, 49, 93, 44, 39, 37,115, 37,115, 42, 39, 41, 10,114,
-   101,116,117,114,110, 32, 95, 68,101, 99,108, 97,114, 97,116,
-   105,111,110,123, 10,110, 97,109,101, 32, 61, 32,116, 91, 50,
-    93, 44, 10,112,116,114, 32, 61, 32, 39, 38, 39, 44, 10,116,
-   121,112,101, 32, 61, 32,109, 91,109, 46,110, 93, 44, 10,109,
-   111,100, 32, 61, 32, 99,111,110, 99, 97,116, 40,109, 44, 49,
-    44,109, 46,110, 45, 49, 41, 32, 44, 10,107,105,110,100, 32,
-    61, 32,107,105,110,100, 10,125, 10,101,110,100, 10,108,111,
-    99, 97,108, 32,115, 49, 32, 61, 32,103,115,117, 98, 40,115,
-    44, 34, 40, 37, 98, 37, 91, 37, 93, 41, 34, 44,102,117,110,
-    99,116,105,111,110, 32, 40,110, 41, 32,114,101,116,117,114,
-   110, 32,103,115,117, 98, 40,110, 44, 39, 37, 42, 39, 44, 39,
-    92, 49, 39, 41, 32,101,110,100, 41, 10,116, 32, 61, 32,115,
-   112,108,105,116, 40,115, 49, 44, 39, 37, 42, 39, 41, 10,105,
-   102, 32,116, 46,110, 32, 61, 61, 32, 50, 32,116,104,101,110,
-    10,116, 91, 50, 93, 32, 61, 32,103,115,117, 98, 40,116, 91,
-    50, 93, 44, 39, 92, 49, 39, 44, 39, 37, 42, 39, 41, 10,108,
-   111, 99, 97,108, 32,109, 32, 61, 32,115,112,108,105,116, 40,
-   116, 91, 49, 93, 44, 39, 37,115, 37,115, 42, 39, 41, 10,114,
-   101,116,117,114,110, 32, 95, 68,101, 99,108, 97,114, 97,116,
-   105,111,110,123, 10,110, 97,109,101, 32, 61, 32,116, 91, 50,
-    93, 44, 10,112,116,114, 32, 61, 32, 39, 42, 39, 44, 10,116,
-   121,112,101, 32, 61, 32,109, 91,109, 46,110, 93, 44, 10,109,
-   111,100, 32, 61, 32, 99,111,110, 99, 97,116, 40,109, 44, 49,
-    44,109, 46,110, 45, 49, 41, 32, 44, 10,107,105,110,100, 32,
-    61, 32,107,105,110,100, 10,125, 10,101,110,100, 10,105,102,
-    32,107,105,110,100, 32, 61, 61, 32, 39,118, 97,114, 39, 32,
-   116,104,101,110, 10,116, 32, 61, 32,115,112,108,105,116, 40,
-   115, 44, 39, 37,115, 37,115, 42, 39, 41, 10,108,111, 99, 97,
-   108, 32,118, 10,105,102, 32,102,105,110,100,116,121,112,101,
-    40,116, 91,116, 46,110, 93, 41, 32,116,104,101,110, 32,118,
-    32, 61, 32, 39, 39, 32,101,108,115,101, 32,118, 32, 61, 32,
-   116, 91,116, 46,110, 93, 59, 32,116, 46,110, 32, 61, 32,116,
-    46,110, 45, 49, 32,101,110,100, 10,114,101,116,117,114,110,
-    32, 95, 68,101, 99,108, 97,114, 97,116,105,111,110,123, 10,
-   110, 97,109,101, 32, 61, 32,118, 44, 10,116,121,112,101, 32,
-    61, 32,116, 91,116, 46,110, 93, 44, 10,109,111,100, 32, 61,
-    32, 99,111,110, 99, 97,116, 40,116, 44, 49, 44,116, 46,110,
-    45, 49, 41, 44, 10,107,105,110,100, 32, 61, 32,107,105,110,
-   100, 10,125, 10,101,108,115,101, 10,116, 32, 61, 32,115,112,
-   108,105,116, 40,115, 44, 39, 37,115, 37,115, 42, 39, 41, 10,
-   108,111, 99, 97,108, 32,118, 32, 61, 32,116, 91,116, 46,110,
-    93, 10,108,111, 99, 97,108, 32,116,112, 44,109,100, 10,105,
-   102, 32,116, 46,110, 62, 49, 32,116,104,101,110, 10,116,112,
-    32, 61, 32,116, 91,116, 46,110, 45, 49, 93, 10,109,100, 32,
-    61, 32, 99,111,110, 99, 97,116, 40,116, 44, 49, 44,116, 46,
-   110, 45, 50, 41, 10,101,110,100, 10,114,101,116,117,114,110,
-    32, 95, 68,101, 99,108, 97,114, 97,116,105,111,110,123, 10,
-   110, 97,109,101, 32, 61, 32,118, 44, 10,116,121,112,101, 32,
-    61, 32,116,112, 44, 10,109,111,100, 32, 61, 32,109,100, 44,
+   108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,116,111,
+   108,117, 97, 95,112,117,115,104,102,105,101,108,100,117,115,
+   101,114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,
+    39, 44,110, 97,114,103, 44, 39, 44,105, 43, 49, 44, 40,118,
+   111,105,100, 42, 41, 39, 44,115,101,108,102, 46,110, 97,109,
+   101, 44, 39, 91,105, 93, 44, 34, 39, 44,116,121,112,101, 44,
+    39, 34, 41, 59, 39, 41, 10,101,110,100, 10,101,110,100, 10,
+   111,117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,101,110,
+   100, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
+    99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,111,
+   110, 58,102,114,101,101, 97,114,114, 97,121, 32, 40, 41, 10,
+   105,102, 32,115,101,108,102, 46,100,105,109, 32,126, 61, 32,
+    39, 39, 32, 97,110,100, 32,116,111,110,117,109, 98,101,114,
+    40,115,101,108,102, 46,100,105,109, 41, 61, 61,110,105,108,
+    32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 35,
+   105,102,100,101,102, 32, 95, 95, 99,112,108,117,115,112,108,
+   117,115, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    32,100,101,108,101,116,101, 32, 91, 93, 39, 44,115,101,108,
+   102, 46,110, 97,109,101, 44, 39, 59, 39, 41, 10,111,117,116,
+   112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39, 41, 10,
+   111,117,116,112,117,116, 40, 39, 32,102,114,101,101, 40, 39,
+    44,115,101,108,102, 46,110, 97,109,101, 44, 39, 41, 59, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,
+   102, 92,110, 39, 41, 10,101,110,100, 10,101,110,100, 10,102,
+   117,110, 99,116,105,111,110, 32, 99,108, 97,115,115, 68,101,
+    99,108, 97,114, 97,116,105,111,110, 58,112, 97,115,115,112,
+    97,114, 32, 40, 41, 10,105,102, 32,115,101,108,102, 46,112,
+   116,114, 61, 61, 39, 38, 39, 32,116,104,101,110, 10,111,117,
+   116,112,117,116, 40, 39, 42, 39, 46, 46,115,101,108,102, 46,
+   110, 97,109,101, 41, 10,101,108,115,101,105,102, 32,115,101,
+   108,102, 46,114,101,116, 61, 61, 39, 42, 39, 32,116,104,101,
+   110, 10,111,117,116,112,117,116, 40, 39, 38, 39, 46, 46,115,
+   101,108,102, 46,110, 97,109,101, 41, 10,101,108,115,101,105,
+   102, 32,115,101,108,102, 46,116,121,112,101, 61, 61, 34,116,
+   111,108,117, 97, 95,105,110,100,101,120, 34, 32,116,104,101,
+   110, 10,111,117,116,112,117,116, 40, 34, 40, 34, 46, 46,115,
+   101,108,102, 46,110, 97,109,101, 46, 46, 34, 45, 49, 41, 34,
+    41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,115,
+   101,108,102, 46,110, 97,109,101, 41, 10,101,110,100, 10,101,
+   110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,
+   115,115, 68,101, 99,108, 97,114, 97,116,105,111,110, 58,114,
+   101,116,118, 97,108,117,101, 32, 40, 41, 10,105,102, 32,115,
+   101,108,102, 46,114,101,116, 32,126, 61, 32, 39, 39, 32,116,
+   104,101,110, 10,108,111, 99, 97,108, 32,116, 44, 99,116, 32,
+    61, 32,105,115, 98, 97,115,105, 99, 40,115,101,108,102, 46,
+   116,121,112,101, 41, 10,105,102, 32,116, 32,116,104,101,110,
+    10,105,102, 32,116, 61, 61, 39,102,117,110, 99,116,105,111,
+   110, 39, 32,116,104,101,110, 32,116, 61, 39,118, 97,108,117,
+   101, 39, 32,101,110,100, 10,111,117,116,112,117,116, 40, 39,
+    32,116,111,108,117, 97, 95,112,117,115,104, 39, 46, 46,116,
+    46, 46, 39, 40,116,111,108,117, 97, 95, 83, 44, 40, 39, 44,
+    99,116, 44, 39, 41, 39, 46, 46,115,101,108,102, 46,110, 97,
+   109,101, 46, 46, 39, 41, 59, 39, 41, 10,101,108,115,101, 10,
+   111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,
+   112,117,115,104,117,115,101,114,116,121,112,101, 40,116,111,
+   108,117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41, 39, 46,
+    46,115,101,108,102, 46,110, 97,109,101, 46, 46, 39, 44, 34,
+    39, 44,115,101,108,102, 46,116,121,112,101, 44, 39, 34, 41,
+    59, 39, 41, 10,101,110,100, 10,114,101,116,117,114,110, 32,
+    49, 10,101,110,100, 10,114,101,116,117,114,110, 32, 48, 10,
+   101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 95, 68,
+   101, 99,108, 97,114, 97,116,105,111,110, 32, 40,116, 41, 10,
+   115,101,116,109,101,116, 97,116, 97, 98,108,101, 40,116, 44,
+    99,108, 97,115,115, 68,101, 99,108, 97,114, 97,116,105,111,
+   110, 41, 10,116, 58, 98,117,105,108,100,110, 97,109,101,115,
+    40, 41, 10,116, 58, 99,104,101, 99,107,110, 97,109,101, 40,
+    41, 10,116, 58, 99,104,101, 99,107,116,121,112,101, 40, 41,
+    10,114,101,116,117,114,110, 32,116, 10,101,110,100, 10,102,
+   117,110, 99,116,105,111,110, 32, 68,101, 99,108, 97,114, 97,
+   116,105,111,110, 32, 40,115, 44,107,105,110,100, 41, 10,115,
+    32, 61, 32,103,115,117, 98, 40,115, 44, 34, 37,115, 42, 61,
+    37,115, 42, 34, 44, 34, 61, 34, 41, 10,105,102, 32,107,105,
+   110,100, 32, 61, 61, 32, 34,118, 97,114, 34, 32,116,104,101,
+   110, 10,105,102, 32,115, 32, 61, 61, 32, 39, 39, 32,111,114,
+    32,115, 32, 61, 61, 32, 39,118,111,105,100, 39, 32,116,104,
+   101,110, 10,114,101,116,117,114,110, 32, 95, 68,101, 99,108,
+    97,114, 97,116,105,111,110,123,116,121,112,101, 32, 61, 32,
+    39,118,111,105,100, 39, 44, 32,107,105,110,100, 32, 61, 32,
+   107,105,110,100,125, 10,101,110,100, 10,101,110,100, 10,108,
+   111, 99, 97,108, 32,116, 32, 61, 32,115,112,108,105,116, 40,
+   115, 44, 39, 37, 42, 37,115, 42, 38, 39, 41, 10,105,102, 32,
+   116, 46,110, 32, 61, 61, 32, 50, 32,116,104,101,110, 10,105,
+   102, 32,107,105,110,100, 32, 61, 61, 32, 39,102,117,110, 99,
+    39, 32,116,104,101,110, 10,101,114,114,111,114, 40, 34, 35,
+   105,110,118, 97,108,105,100, 32,102,117,110, 99,116,105,111,
+   110, 32,114,101,116,117,114,110, 32,116,121,112,101, 58, 32,
+    34, 46, 46,115, 41, 10,101,110,100, 10,108,111, 99, 97,108,
+    32,109, 32, 61, 32,115,112,108,105,116, 40,116, 91, 49, 93,
+    44, 39, 37,115, 37,115, 42, 39, 41, 10,114,101,116,117,114,
+   110, 32, 95, 68,101, 99,108, 97,114, 97,116,105,111,110,123,
+    10,110, 97,109,101, 32, 61, 32,116, 91, 50, 93, 44, 10,112,
+   116,114, 32, 61, 32, 39, 42, 39, 44, 10,114,101,116, 32, 61,
+    32, 39, 38, 39, 44, 10,116,121,112,101, 32, 61, 32,109, 91,
+   109, 46,110, 93, 44, 10,109,111,100, 32, 61, 32, 99,111,110,
+    99, 97,116, 40,109, 44, 49, 44,109, 46,110, 45, 49, 41, 44,
     10,107,105,110,100, 32, 61, 32,107,105,110,100, 10,125, 10,
-   101,110,100, 10,101,110,100,32
+   101,110,100, 10,116, 32, 61, 32,115,112,108,105,116, 40,115,
+    44, 39, 37, 42, 37,115, 42, 37, 42, 39, 41, 10,105,102, 32,
+   116, 46,110, 32, 61, 61, 32, 50, 32,116,104,101,110, 10,105,
+   102, 32,107,105,110,100, 32, 61, 61, 32, 39,102,117,110, 99,
+    39, 32,116,104,101,110, 10,101,114,114,111,114, 40, 34, 35,
+   105,110,118, 97,108,105,100, 32,102,117,110, 99,116,105,111,
+   110, 32,114,101,116,117,114,110, 32,116,121,112,101, 58, 32,
+    34, 46, 46,115, 41, 10,101,110,100, 10,108,111, 99, 97,108,
+    32,109, 32, 61, 32,115,112,108,105,116, 40,116, 91, 49, 93,
+    44, 39, 37,115, 37,115, 42, 39, 41, 10,114,101,116,117,114,
+   110, 32, 95, 68,101, 99,108, 97,114, 97,116,105,111,110,123,
+    10,110, 97,109,101, 32, 61, 32,116, 91, 50, 93, 44, 10,112,
+   116,114, 32, 61, 32, 39, 42, 39, 44, 10,114,101,116, 32, 61,
+    32, 39, 42, 39, 44, 10,116,121,112,101, 32, 61, 32,109, 91,
+   109, 46,110, 93, 44, 10,109,111,100, 32, 61, 32, 99,111,110,
+    99, 97,116, 40,109, 44, 49, 44,109, 46,110, 45, 49, 41, 44,
+    10,107,105,110,100, 32, 61, 32,107,105,110,100, 10,125, 10,
+   101,110,100, 10,116, 32, 61, 32,115,112,108,105,116, 40,115,
+    44, 39, 38, 39, 41, 10,105,102, 32,116, 46,110, 32, 61, 61,
+    32, 50, 32,116,104,101,110, 10,108,111, 99, 97,108, 32,109,
+    32, 61, 32,115,112,108,105,116, 40,116, 91, 49, 93, 44, 39,
+    37,115, 37,115, 42, 39, 41, 10,114,101,116,117,114,110, 32,
+    95, 68,101, 99,108, 97,114, 97,116,105,111,110,123, 10,110,
+    97,109,101, 32, 61, 32,116, 91, 50, 93, 44, 10,112,116,114,
+    32, 61, 32, 39, 38, 39, 44, 10,116,121,112,101, 32, 61, 32,
+   109, 91,109, 46,110, 93, 44, 10,109,111,100, 32, 61, 32, 99,
+   111,110, 99, 97,116, 40,109, 44, 49, 44,109, 46,110, 45, 49,
+    41, 32, 44, 10,107,105,110,100, 32, 61, 32,107,105,110,100,
+    10,125, 10,101,110,100, 10,108,111, 99, 97,108, 32,115, 49,
+    32, 61, 32,103,115,117, 98, 40,115, 44, 34, 40, 37, 98, 37,
+    91, 37, 93, 41, 34, 44,102,117,110, 99,116,105,111,110, 32,
+    40,110, 41, 32,114,101,116,117,114,110, 32,103,115,117, 98,
+    40,110, 44, 39, 37, 42, 39, 44, 39, 92, 49, 39, 41, 32,101,
+   110,100, 41, 10,116, 32, 61, 32,115,112,108,105,116, 40,115,
+    49, 44, 39, 37, 42, 39, 41, 10,105,102, 32,116, 46,110, 32,
+    61, 61, 32, 50, 32,116,104,101,110, 10,116, 91, 50, 93, 32,
+    61, 32,103,115,117, 98, 40,116, 91, 50, 93, 44, 39, 92, 49,
+    39, 44, 39, 37, 42, 39, 41, 10,108,111, 99, 97,108, 32,109,
+    32, 61, 32,115,112,108,105,116, 40,116, 91, 49, 93, 44, 39,
+    37,115, 37,115, 42, 39, 41, 10,114,101,116,117,114,110, 32,
+    95, 68,101, 99,108, 97,114, 97,116,105,111,110,123, 10,110,
+    97,109,101, 32, 61, 32,116, 91, 50, 93, 44, 10,112,116,114,
+    32, 61, 32, 39, 42, 39, 44, 10,116,121,112,101, 32, 61, 32,
+   109, 91,109, 46,110, 93, 44, 10,109,111,100, 32, 61, 32, 99,
+   111,110, 99, 97,116, 40,109, 44, 49, 44,109, 46,110, 45, 49,
+    41, 32, 44, 10,107,105,110,100, 32, 61, 32,107,105,110,100,
+    10,125, 10,101,110,100, 10,105,102, 32,107,105,110,100, 32,
+    61, 61, 32, 39,118, 97,114, 39, 32,116,104,101,110, 10,116,
+    32, 61, 32,115,112,108,105,116, 40,115, 44, 39, 37,115, 37,
+   115, 42, 39, 41, 10,108,111, 99, 97,108, 32,118, 10,105,102,
+    32,102,105,110,100,116,121,112,101, 40,116, 91,116, 46,110,
+    93, 41, 32,116,104,101,110, 32,118, 32, 61, 32, 39, 39, 32,
+   101,108,115,101, 32,118, 32, 61, 32,116, 91,116, 46,110, 93,
+    59, 32,116, 46,110, 32, 61, 32,116, 46,110, 45, 49, 32,101,
+   110,100, 10,114,101,116,117,114,110, 32, 95, 68,101, 99,108,
+    97,114, 97,116,105,111,110,123, 10,110, 97,109,101, 32, 61,
+    32,118, 44, 10,116,121,112,101, 32, 61, 32,116, 91,116, 46,
+   110, 93, 44, 10,109,111,100, 32, 61, 32, 99,111,110, 99, 97,
+   116, 40,116, 44, 49, 44,116, 46,110, 45, 49, 41, 44, 10,107,
+   105,110,100, 32, 61, 32,107,105,110,100, 10,125, 10,101,108,
+   115,101, 10,116, 32, 61, 32,115,112,108,105,116, 40,115, 44,
+    39, 37,115, 37,115, 42, 39, 41, 10,108,111, 99, 97,108, 32,
+   118, 32, 61, 32,116, 91,116, 46,110, 93, 10,108,111, 99, 97,
+   108, 32,116,112, 44,109,100, 10,105,102, 32,116, 46,110, 62,
+    49, 32,116,104,101,110, 10,116,112, 32, 61, 32,116, 91,116,
+    46,110, 45, 49, 93, 10,109,100, 32, 61, 32, 99,111,110, 99,
+    97,116, 40,116, 44, 49, 44,116, 46,110, 45, 50, 41, 10,101,
+   110,100, 10,114,101,116,117,114,110, 32, 95, 68,101, 99,108,
+    97,114, 97,116,105,111,110,123, 10,110, 97,109,101, 32, 61,
+    32,118, 44, 10,116,121,112,101, 32, 61, 32,116,112, 44, 10,
+   109,111,100, 32, 61, 32,109,100, 44, 10,107,105,110,100, 32,
+    61, 32,107,105,110,100, 10,125, 10,101,110,100, 10,101,110,
+   100,32
   };
   luaL_loadbuffer(tolua_S,(char*)B,sizeof(B),"tolua: embedded Lua code") ||
   lua_pcall(tolua_S,0,LUA_MULTRET,0);
@@ -3319,6 +3503,262 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
    101, 99,108,116,121,112,101, 40, 41, 10,105, 32, 61, 32,105,
     43, 49, 10,101,110,100, 10,101,110,100, 10,102,117,110, 99,
    116,105,111,110, 32, 99,108, 97,115,115, 70,117,110, 99,116,
+   105,111,110, 58,105,115,102, 97,115,116, 32, 40, 41, 10,108,
+   111, 99, 97,108, 32,111,118,101,114,108,111, 97,100, 32, 61,
+    32,115,116,114,115,117, 98, 40,115,101,108,102, 46, 99,110,
+    97,109,101, 44, 45, 50, 44, 45, 49, 41, 32, 45, 32, 49, 10,
+   105,102, 32,110,111,116, 32,102,108, 97,103,115, 46, 70, 32,
+   111,114, 32,111,118,101,114,108,111, 97,100, 32, 62, 61, 32,
+    48, 32,111,114, 32,115,101,108,102, 58,105,110, 99,108, 97,
+   115,115, 40, 41, 32,111,114, 10, 40,115,101,108,102, 46,116,
+   121,112,101, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,115,
+   101,108,102, 46,116,121,112,101, 32,126, 61, 32, 39,118,111,
+   105,100, 39, 32, 97,110,100, 10, 40,110,111,116, 32,105,115,
+    98, 97,115,105, 99, 40,115,101,108,102, 46,116,121,112,101,
+    41, 32,111,114, 32,115,101,108,102, 46,116,121,112,101, 32,
+    61, 61, 32, 39,116,111,108,117, 97, 95,105,110,100,101,120,
+    39, 41, 41, 32,116,104,101,110, 10,114,101,116,117,114,110,
+    32,102, 97,108,115,101, 10,101,110,100, 10,105,102, 32,115,
+   101,108,102, 46, 97,114,103,115, 91, 49, 93, 46,116,121,112,
+   101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,116,104,101,
+   110, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,
+   108,101, 32,115,101,108,102, 46, 97,114,103,115, 91,105, 93,
+    32,100,111, 10,105,102, 32,115,101,108,102, 46, 97,114,103,
+   115, 91,105, 93, 46,116,121,112,101, 32, 61, 61, 32, 34, 46,
+    46, 46, 34, 32,111,114, 32,110,111,116, 32,115,101,108,102,
+    46, 97,114,103,115, 91,105, 93, 58,105,115,102, 97,115,116,
+    40, 41, 32,116,104,101,110, 10,114,101,116,117,114,110, 32,
+   102, 97,108,115,101, 10,101,110,100, 10,105, 32, 61, 32,105,
+    43, 49, 10,101,110,100, 10,101,110,100, 10,114,101,116,117,
+   114,110, 32,116,114,117,101, 10,101,110,100, 10, 95,116,114,
+    97,109,112,111,108,105,110,101, 95,116,121,112,101,115, 32,
+    61, 32,123, 10, 91, 39,105,110,116, 39, 93, 32, 61, 32, 39,
+   105, 39, 44, 10, 91, 39,117,110,115,105,103,110,101,100, 32,
+   105,110,116, 39, 93, 32, 61, 32, 39,117, 39, 44, 10, 91, 39,
+   115,104,111,114,116, 39, 93, 32, 61, 32, 39,104, 39, 44, 10,
+    91, 39,117,110,115,105,103,110,101,100, 32,115,104,111,114,
+   116, 39, 93, 32, 61, 32, 39, 72, 39, 44, 10, 91, 39,108,111,
+   110,103, 39, 93, 32, 61, 32, 39,108, 39, 44, 10, 91, 39,117,
+   110,115,105,103,110,101,100, 32,108,111,110,103, 39, 93, 32,
+    61, 32, 39, 76, 39, 44, 10, 91, 39, 99,104, 97,114, 39, 93,
+    32, 61, 32, 39, 99, 39, 44, 10, 91, 39,117,110,115,105,103,
+   110,101,100, 32, 99,104, 97,114, 39, 93, 32, 61, 32, 39, 67,
+    39, 44, 10, 91, 39,102,108,111, 97,116, 39, 93, 32, 61, 32,
+    39,102, 39, 44, 10, 91, 39,100,111,117, 98,108,101, 39, 93,
+    32, 61, 32, 39,100, 39, 44, 10, 91, 39, 98,111,111,108, 39,
+    93, 32, 61, 32, 39, 98, 39, 44, 10, 91, 39, 99,111,110,115,
+   116, 32, 99,104, 97,114, 42, 39, 93, 32, 61, 32, 39,115, 39,
+    44, 10, 91, 39, 99,104, 97,114, 42, 39, 93, 32, 61, 32, 39,
+    83, 39, 44, 10, 91, 39, 99,111,110,115,116, 32,118,111,105,
+   100, 42, 39, 93, 32, 61, 32, 39, 80, 39, 44, 10, 91, 39,118,
+   111,105,100, 42, 39, 93, 32, 61, 32, 39,112, 39, 44, 10,125,
+    10, 95,116,114, 97,109,112,111,108,105,110,101, 95, 99,116,
+   121,112,101,115, 32, 61, 32,123,125, 10,102,111,114, 32, 99,
+   116,121,112,101, 44,108,101,116,116,101,114, 32,105,110, 32,
+   112, 97,105,114,115, 40, 95,116,114, 97,109,112,111,108,105,
+   110,101, 95,116,121,112,101,115, 41, 32,100,111, 10, 95,116,
+   114, 97,109,112,111,108,105,110,101, 95, 99,116,121,112,101,
+   115, 91,108,101,116,116,101,114, 93, 32, 61, 32, 99,116,121,
+   112,101, 10,101,110,100, 10,102,117,110, 99,116,105,111,110,
+    32,116,114, 97,109,112,111,108,105,110,101,107,105,110,100,
+    32, 40, 99,116,121,112,101, 41, 10,108,111, 99, 97,108, 32,
+   108,101,116,116,101,114, 32, 61, 32, 95,116,114, 97,109,112,
+   111,108,105,110,101, 95,116,121,112,101,115, 91, 99,116,121,
+   112,101, 93, 10,105,102, 32,108,101,116,116,101,114, 32, 61,
+    61, 32, 39,115, 39, 32,111,114, 32,108,101,116,116,101,114,
+    32, 61, 61, 32, 39, 83, 39, 32,116,104,101,110, 10,114,101,
+   116,117,114,110, 32, 39,115,116,114,105,110,103, 39, 10,101,
+   108,115,101,105,102, 32,108,101,116,116,101,114, 32, 61, 61,
+    32, 39,112, 39, 32,111,114, 32,108,101,116,116,101,114, 32,
+    61, 61, 32, 39, 80, 39, 32,116,104,101,110, 10,114,101,116,
+   117,114,110, 32, 39,117,115,101,114,100, 97,116, 97, 39, 10,
+   101,108,115,101,105,102, 32,108,101,116,116,101,114, 32, 61,
+    61, 32, 39, 98, 39, 32,116,104,101,110, 10,114,101,116,117,
+   114,110, 32, 39, 98,111,111,108,101, 97,110, 39, 10,101,110,
+   100, 10,114,101,116,117,114,110, 32, 39,110,117,109, 98,101,
+   114, 39, 10,101,110,100, 10, 95,116,114, 97,109,112,111,108,
+   105,110,101,115, 32, 61, 32,123,110, 61, 48,125, 10, 95,116,
+   114, 97,109,112,111,108,105,110,101,100, 32, 61, 32,123,110,
+    61, 48,125, 10,102,117,110, 99,116,105,111,110, 32,116,114,
+    97,109,112,111,108,105,110,101,108,101,116,116,101,114, 32,
+    40,116,121,112,101, 41, 10,108,111, 99, 97,108, 32,109, 44,
+   116, 32, 61, 32, 97,112,112,108,121,116,121,112,101,100,101,
+   102, 40,103,115,117, 98, 40,116,121,112,101, 44, 39, 99,111,
+   110,115,116, 32, 39, 44, 39, 39, 41, 41, 10,105,102, 32,115,
+   116,114,102,105,110,100, 40,116, 44, 39, 37, 42, 36, 39, 41,
+    32,116,104,101,110, 10,105,102, 32,115,116,114,102,105,110,
+   100, 40,116,121,112,101, 44, 39, 94, 99,111,110,115,116, 32,
+    39, 41, 32,116,104,101,110, 10,116, 32, 61, 32, 39, 99,111,
+   110,115,116, 32, 39, 46, 46,116, 10,101,110,100, 10,114,101,
+   116,117,114,110, 32, 95,116,114, 97,109,112,111,108,105,110,
+   101, 95,116,121,112,101,115, 91,116, 93, 10,101,110,100, 10,
+   108,111, 99, 97,108, 32,119,111,114,100,115, 32, 61, 32, 39,
+    32, 39, 46, 46,109, 46, 46, 39, 32, 39, 46, 46,116, 46, 46,
+    39, 32, 39, 10,105,102, 32,115,116,114,102,105,110,100, 40,
+   119,111,114,100,115, 44, 39, 32,115,105,103,110,101,100, 32,
+    39, 41, 32,111,114, 32,115,116,114,102,105,110,100, 40,119,
+   111,114,100,115, 44, 39, 32,108,111,110,103, 32, 46, 42,108,
+   111,110,103, 32, 39, 41, 32,116,104,101,110, 10,114,101,116,
+   117,114,110, 32,110,105,108, 10,101,110,100, 10,105,102, 32,
+   115,116,114,102,105,110,100, 40,119,111,114,100,115, 44, 39,
+    32,115,104,111,114,116, 32, 39, 41, 32,116,104,101,110, 10,
+   116, 32, 61, 32, 39,115,104,111,114,116, 39, 10,101,108,115,
+   101,105,102, 32,115,116,114,102,105,110,100, 40,119,111,114,
+   100,115, 44, 39, 32,108,111,110,103, 32, 39, 41, 32,116,104,
+   101,110, 10,116, 32, 61, 32, 39,108,111,110,103, 39, 10,101,
+   108,115,101,105,102, 32,116, 32, 61, 61, 32, 39,117,110,115,
+   105,103,110,101,100, 39, 32,116,104,101,110, 10,116, 32, 61,
+    32, 39,105,110,116, 39, 10,101,110,100, 10,105,102, 32,115,
+   116,114,102,105,110,100, 40,119,111,114,100,115, 44, 39, 32,
+   117,110,115,105,103,110,101,100, 32, 39, 41, 32,116,104,101,
+   110, 10,116, 32, 61, 32, 39,117,110,115,105,103,110,101,100,
+    32, 39, 46, 46,116, 10,101,110,100, 10,114,101,116,117,114,
+   110, 32, 95,116,114, 97,109,112,111,108,105,110,101, 95,116,
+   121,112,101,115, 91,116, 93, 10,101,110,100, 10,102,117,110,
+    99,116,105,111,110, 32, 99,108, 97,115,115, 70,117,110, 99,
+   116,105,111,110, 58,115,105,103,110, 97,116,117,114,101, 32,
+    40, 41, 10,105,102, 32,110,111,116, 32,102,108, 97,103,115,
+    46, 84, 32,111,114, 32,110,111,116, 32,115,101,108,102, 58,
+   105,115,102, 97,115,116, 40, 41, 32,111,114, 32,115,101,108,
+   102, 46,112,116,114, 32,126, 61, 32, 39, 39, 32,111,114, 10,
+   115,101,108,102, 46,112, 97,114,101,110,116, 46,108,110, 97,
+   109,101,115, 91,115,101,108,102, 46,108,110, 97,109,101, 93,
+    32,126, 61, 32, 48, 32,116,104,101,110, 10,114,101,116,117,
+   114,110, 32,110,105,108, 10,101,110,100, 10,108,111, 99, 97,
+   108, 32,115,105,103, 32, 61, 32, 39,118, 39, 10,105,102, 32,
+   115,101,108,102, 46,116,121,112,101, 32,126, 61, 32, 39, 39,
+    32, 97,110,100, 32,115,101,108,102, 46,116,121,112,101, 32,
+   126, 61, 32, 39,118,111,105,100, 39, 32,116,104,101,110, 10,
+   115,105,103, 32, 61, 32,116,114, 97,109,112,111,108,105,110,
+   101,108,101,116,116,101,114, 40,115,101,108,102, 46,116,121,
+   112,101, 41, 10,105,102, 32,110,111,116, 32,115,105,103, 32,
+   116,104,101,110, 10,114,101,116,117,114,110, 32,110,105,108,
+    10,101,110,100, 10,101,110,100, 10,115,105,103, 32, 61, 32,
+   115,105,103, 46, 46, 39, 95, 39, 10,105,102, 32,115,101,108,
+   102, 46, 97,114,103,115, 91, 49, 93, 46,116,121,112,101, 32,
+   126, 61, 32, 39,118,111,105,100, 39, 32,116,104,101,110, 10,
+   108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101,
+    32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32,100,
+   111, 10,108,111, 99, 97,108, 32,108,101,116,116,101,114, 32,
+    61, 32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 46,
+   112,116,114, 32, 61, 61, 32, 39, 39, 32, 97,110,100, 32,116,
+   114, 97,109,112,111,108,105,110,101,108,101,116,116,101,114,
+    40,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 46,116,
+   121,112,101, 41, 10,105,102, 32,110,111,116, 32,108,101,116,
+   116,101,114, 32,116,104,101,110, 10,114,101,116,117,114,110,
+    32,110,105,108, 10,101,110,100, 10,115,105,103, 32, 61, 32,
+   115,105,103, 46, 46,108,101,116,116,101,114, 10,105, 32, 61,
+    32,105, 43, 49, 10,101,110,100, 10,101,110,100, 10,114,101,
+   116,117,114,110, 32,115,105,103, 10,101,110,100, 10,102,117,
+   110, 99,116,105,111,110, 32,111,117,116,116,114, 97,109,112,
+   111,108,105,110,101, 32, 40,115,105,103, 41, 10,108,111, 99,
+    97,108, 32,114,101,116, 32, 61, 32,115,116,114,115,117, 98,
+    40,115,105,103, 44, 49, 44, 49, 41, 10,108,111, 99, 97,108,
+    32, 97,114,103,115, 32, 61, 32,115,116,114,115,117, 98, 40,
+   115,105,103, 44, 51, 41, 10,108,111, 99, 97,108, 32,114,116,
+   121,112,101, 32, 61, 32, 95,116,114, 97,109,112,111,108,105,
+   110,101, 95, 99,116,121,112,101,115, 91,114,101,116, 93, 32,
+   111,114, 32, 39,118,111,105,100, 39, 10,108,111, 99, 97,108,
+    32,112, 97,114, 97,109,115, 32, 61, 32,123,125, 10,108,111,
+    99, 97,108, 32,112,114,111,116,111, 32, 61, 32, 39, 39, 10,
+   108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101,
+    32,105, 32, 60, 61, 32,115,116,114,108,101,110, 40, 97,114,
+   103,115, 41, 32,100,111, 10,112, 97,114, 97,109,115, 91,105,
+    93, 32, 61, 32, 95,116,114, 97,109,112,111,108,105,110,101,
+    95, 99,116,121,112,101,115, 91,115,116,114,115,117, 98, 40,
+    97,114,103,115, 44,105, 44,105, 41, 93, 10,105,102, 32,105,
+    32, 62, 32, 49, 32,116,104,101,110, 32,112,114,111,116,111,
+    32, 61, 32,112,114,111,116,111, 46, 46, 39, 44, 39, 32,101,
+   110,100, 10,112,114,111,116,111, 32, 61, 32,112,114,111,116,
+   111, 46, 46,112, 97,114, 97,109,115, 91,105, 93, 10,105, 32,
+    61, 32,105, 43, 49, 10,101,110,100, 10,105,102, 32,112,114,
+   111,116,111, 32, 61, 61, 32, 39, 39, 32,116,104,101,110, 32,
+   112,114,111,116,111, 32, 61, 32, 39,118,111,105,100, 39, 32,
+   101,110,100, 10,111,117,116,112,117,116, 40, 39, 47, 42, 32,
+   116,114, 97,109,112,111,108,105,110,101, 58, 32, 39, 46, 46,
+   114,116,121,112,101, 46, 46, 39, 32, 40, 39, 46, 46,112,114,
+   111,116,111, 46, 46, 39, 41, 32, 42, 47, 39, 41, 10,111,117,
+   116,112,117,116, 40, 39,115,116, 97,116,105, 99, 32,105,110,
+   116, 32,116,111,108,117, 97, 95,116,114, 97,109,112,111,108,
+   105,110,101, 95, 39, 46, 46,115,105,103, 46, 46, 39, 32, 40,
+   108,117, 97, 95, 83,116, 97,116,101, 42, 32,116,111,108,117,
+    97, 95, 83, 41, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+   123, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32, 39, 46,
+    46,114,116,121,112,101, 46, 46, 39, 32, 40, 42,116,111,108,
+   117, 97, 95,102, 41, 40, 39, 46, 46,112,114,111,116,111, 46,
+    46, 39, 41, 32, 61, 32, 40, 39, 46, 46,114,116,121,112,101,
+    46, 46, 39, 32, 40, 42, 41, 40, 39, 46, 46,112,114,111,116,
+   111, 46, 46, 39, 41, 41, 32,116,111,108,117, 97, 95,116, 97,
+   114,103,101,116, 40,116,111,108,117, 97, 95, 83, 41, 59, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 35,105,102,110,100,
+   101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83,
+    69, 92,110, 39, 41, 10,108,111, 99, 97,108, 32,110, 97,114,
+   103, 32, 61, 32, 49, 10,119,104,105,108,101, 32,112, 97,114,
+    97,109,115, 91,110, 97,114,103, 93, 32,100,111, 10,111,117,
+   116,102, 97,115,116, 99,104,101, 99,107, 40,116,114, 97,109,
+   112,111,108,105,110,101,107,105,110,100, 40,112, 97,114, 97,
+   109,115, 91,110, 97,114,103, 93, 41, 44,110, 97,114,103, 41,
+    10,110, 97,114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,
+   101,110,100, 10,111,117,116,112,117,116, 40, 39, 32,105,102,
+    32, 40,108,117, 97, 95,103,101,116,116,111,112, 40,116,111,
+   108,117, 97, 95, 83, 41, 32, 62, 32, 39, 46, 46, 40,110, 97,
+   114,103, 45, 49, 41, 46, 46, 39, 41, 92,110, 39, 41, 10,111,
+   117,116,112,117,116, 40, 39, 32,114,101,116,117,114,110, 32,
+   108,117, 97, 76, 95, 97,114,103,101,114,114,111,114, 40,116,
+   111,108,117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46,
+    46, 39, 44, 34,110,111, 32,118, 97,108,117,101, 32,101,120,
+   112,101, 99,116,101,100, 34, 41, 59, 39, 41, 10,111,117,116,
+   112,117,116, 40, 39, 35,101,110,100,105,102, 92,110, 39, 41,
+    10,111,117,116,112,117,116, 40, 39, 32,123, 39, 41, 10,108,
+   111, 99, 97,108, 32, 99, 97,108,108, 32, 61, 32, 39, 39, 10,
+   110, 97,114,103, 32, 61, 32, 49, 10,119,104,105,108,101, 32,
+   112, 97,114, 97,109,115, 91,110, 97,114,103, 93, 32,100,111,
+    10,108,111, 99, 97,108, 32,116, 32, 61, 32,116,114, 97,109,
+   112,111,108,105,110,101,107,105,110,100, 40,112, 97,114, 97,
+   109,115, 91,110, 97,114,103, 93, 41, 10,108,111, 99, 97,108,
+    32,103,101,116, 10,105,102, 32,116, 32, 61, 61, 32, 39,110,
+   117,109, 98,101,114, 39, 32,116,104,101,110, 10,105,102, 32,
+   105,115,102, 97,115,116,105,110,116,101,103,101,114, 40, 39,
+    39, 44,112, 97,114, 97,109,115, 91,110, 97,114,103, 93, 41,
+    32,116,104,101,110, 10,103,101,116, 32, 61, 32, 39,108,117,
+    97, 95,116,111,105,110,116,101,103,101,114, 40,116,111,108,
+   117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46, 46, 39,
+    41, 39, 10,101,108,115,101, 10,103,101,116, 32, 61, 32, 39,
+   108,117, 97, 95,116,111,110,117,109, 98,101,114, 40,116,111,
+   108,117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46, 46,
+    39, 41, 39, 10,101,110,100, 10,101,108,115,101, 10,103,101,
+   116, 32, 61, 32, 39,116,111,108,117, 97, 95,116,111, 39, 46,
+    46,116, 46, 46, 39, 40,116,111,108,117, 97, 95, 83, 44, 39,
+    46, 46,110, 97,114,103, 46, 46, 39, 44, 48, 41, 39, 10,101,
+   110,100, 10,105,102, 32,110, 97,114,103, 32, 62, 32, 49, 32,
+   116,104,101,110, 10, 99, 97,108,108, 32, 61, 32, 99, 97,108,
+   108, 46, 46, 39, 44, 39, 10,101,110,100, 10, 99, 97,108,108,
+    32, 61, 32, 99, 97,108,108, 46, 46, 39, 40, 39, 46, 46,112,
+    97,114, 97,109,115, 91,110, 97,114,103, 93, 46, 46, 39, 41,
+    32, 39, 46, 46,103,101,116, 10,110, 97,114,103, 32, 61, 32,
+   110, 97,114,103, 43, 49, 10,101,110,100, 10,105,102, 32,114,
+   101,116, 32,126, 61, 32, 39,118, 39, 32,116,104,101,110, 10,
+   111,117,116,112,117,116, 40, 39, 32, 39, 46, 46,114,116,121,
+   112,101, 46, 46, 39, 32,116,111,108,117, 97, 95,114,101,116,
+    32, 61, 32,116,111,108,117, 97, 95,102, 40, 39, 46, 46, 99,
+    97,108,108, 46, 46, 39, 41, 59, 39, 41, 10,108,111, 99, 97,
+   108, 32,116, 32, 61, 32,116,114, 97,109,112,111,108,105,110,
+   101,107,105,110,100, 40,114,116,121,112,101, 41, 10,111,117,
+   116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,117,
+   115,104, 39, 46, 46,116, 46, 46, 39, 40,116,111,108,117, 97,
+    95, 83, 44, 40, 39, 44, 95, 98, 97,115,105, 99, 95, 99,116,
+   121,112,101, 91,116, 93, 44, 39, 41,116,111,108,117, 97, 95,
+   114,101,116, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40,
+    39, 32,125, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,
+   114,101,116,117,114,110, 32, 49, 59, 39, 41, 10,101,108,115,
+   101, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117,
+    97, 95,102, 40, 39, 46, 46, 99, 97,108,108, 46, 46, 39, 41,
+    59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,125, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 32,114,101,116,117,
+   114,110, 32, 48, 59, 39, 41, 10,101,110,100, 10,111,117,116,
+   112,117,116, 40, 39,125, 39, 41, 10,111,117,116,112,117,116,
+    40, 39, 92,110, 39, 41, 10,101,110,100, 10,102,117,110, 99,
+   116,105,111,110, 32, 99,108, 97,115,115, 70,117,110, 99,116,
    105,111,110, 58,115,117,112, 99,111,100,101, 32, 40, 41, 10,
    108,111, 99, 97,108, 32,111,118,101,114,108,111, 97,100, 32,
     61, 32,115,116,114,115,117, 98, 40,115,101,108,102, 46, 99,
@@ -3329,360 +3769,438 @@ LUALIB_API int  luaopen_tolua (lua_State* tolua_S)
    108,111, 99, 97,108, 32, 95, 44, 95, 44,115,116, 97,116,105,
     99, 32, 61, 32,115,116,114,102,105,110,100, 40,115,101,108,
    102, 46,109,111,100, 44, 39, 94, 37,115, 42, 40,115,116, 97,
-   116,105, 99, 41, 39, 41, 10,105,102, 32, 99,108, 97,115,115,
-    32,116,104,101,110, 10,111,117,116,112,117,116, 40, 34, 47,
-    42, 32,109,101,116,104,111,100, 58, 34, 44,115,101,108,102,
-    46,110, 97,109,101, 44, 34, 32,111,102, 32, 99,108, 97,115,
-   115, 32, 34, 44, 99,108, 97,115,115, 44, 34, 32, 42, 47, 34,
-    41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40, 34,
-    47, 42, 32,102,117,110, 99,116,105,111,110, 58, 34, 44,115,
-   101,108,102, 46,110, 97,109,101, 44, 34, 32, 42, 47, 34, 41,
-    10,101,110,100, 10,111,117,116,112,117,116, 40, 34,115,116,
-    97,116,105, 99, 32,105,110,116, 34, 44,115,101,108,102, 46,
-    99,110, 97,109,101, 44, 34, 40,108,117, 97, 95, 83,116, 97,
-   116,101, 42, 32,116,111,108,117, 97, 95, 83, 41, 34, 41, 10,
-   111,117,116,112,117,116, 40, 34,123, 34, 41, 10,105,102, 32,
-   111,118,101,114,108,111, 97,100, 32, 60, 32, 48, 32,116,104,
-   101,110, 10,111,117,116,112,117,116, 40, 39, 35,105,102,110,
-   100,101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65,
-    83, 69, 92,110, 39, 41, 10,101,110,100, 10,111,117,116,112,
-   117,116, 40, 39, 32,116,111,108,117, 97, 95, 69,114,114,111,
-   114, 32,116,111,108,117, 97, 95,101,114,114, 59, 39, 41, 10,
-   111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40, 92,110,
-    39, 41, 10,108,111, 99, 97,108, 32,110, 97,114,103, 10,105,
+   116,105, 99, 41, 39, 41, 10,108,111, 99, 97,108, 32,102, 97,
+   115,116, 32, 61, 32,115,101,108,102, 58,105,115,102, 97,115,
+   116, 40, 41, 10,115,101,108,102, 46,116,114, 97,109,112,111,
+   108,105,110,101, 32, 61, 32,115,101,108,102, 58,115,105,103,
+   110, 97,116,117,114,101, 40, 41, 10,105,102, 32,115,101,108,
+   102, 46,116,114, 97,109,112,111,108,105,110,101, 32,116,104,
+   101,110, 10,105,102, 32,110,111,116, 32, 95,116,114, 97,109,
+   112,111,108,105,110,101,115, 91,115,101,108,102, 46,116,114,
+    97,109,112,111,108,105,110,101, 93, 32,116,104,101,110, 10,
+    95,116,114, 97,109,112,111,108,105,110,101,115, 91,115,101,
+   108,102, 46,116,114, 97,109,112,111,108,105,110,101, 93, 32,
+    61, 32,116,114,117,101, 10,116,105,110,115,101,114,116, 40,
+    95,116,114, 97,109,112,111,108,105,110,101,115, 44,115,101,
+   108,102, 46,116,114, 97,109,112,111,108,105,110,101, 41, 10,
+   101,110,100, 10,116,105,110,115,101,114,116, 40, 95,116,114,
+    97,109,112,111,108,105,110,101,100, 44,115,101,108,102, 41,
+    10,114,101,116,117,114,110, 10,101,110,100, 10,105,102, 32,
+    99,108, 97,115,115, 32,116,104,101,110, 10,111,117,116,112,
+   117,116, 40, 34, 47, 42, 32,109,101,116,104,111,100, 58, 34,
+    44,115,101,108,102, 46,110, 97,109,101, 44, 34, 32,111,102,
+    32, 99,108, 97,115,115, 32, 34, 44, 99,108, 97,115,115, 44,
+    34, 32, 42, 47, 34, 41, 10,101,108,115,101, 10,111,117,116,
+   112,117,116, 40, 34, 47, 42, 32,102,117,110, 99,116,105,111,
+   110, 58, 34, 44,115,101,108,102, 46,110, 97,109,101, 44, 34,
+    32, 42, 47, 34, 41, 10,101,110,100, 10,111,117,116,112,117,
+   116, 40, 34,115,116, 97,116,105, 99, 32,105,110,116, 34, 44,
+   115,101,108,102, 46, 99,110, 97,109,101, 44, 34, 40,108,117,
+    97, 95, 83,116, 97,116,101, 42, 32,116,111,108,117, 97, 95,
+    83, 41, 34, 41, 10,111,117,116,112,117,116, 40, 34,123, 34,
+    41, 10,105,102, 32,102, 97,115,116, 32,116,104,101,110, 10,
+   111,117,116,112,117,116, 40, 39, 35,105,102,110,100,101,102,
+    32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83, 69, 92,
+   110, 39, 41, 10,108,111, 99, 97,108, 32,110, 97,114,103, 61,
+    49, 10,105,102, 32,115,101,108,102, 46, 97,114,103,115, 91,
+    49, 93, 46,116,121,112,101, 32,126, 61, 32, 39,118,111,105,
+   100, 39, 32,116,104,101,110, 10,108,111, 99, 97,108, 32,105,
+    61, 49, 10,119,104,105,108,101, 32,115,101,108,102, 46, 97,
+   114,103,115, 91,105, 93, 32,100,111, 10,115,101,108,102, 46,
+    97,114,103,115, 91,105, 93, 58,111,117,116,102, 97,115,116,
+    99,104,101, 99,107, 40,110, 97,114,103, 41, 10,105,102, 32,
+   105,115, 98, 97,115,105, 99, 40,115,101,108,102, 46, 97,114,
+   103,115, 91,105, 93, 46,116,121,112,101, 41, 32,126, 61, 32,
+    39,115,116, 97,116,101, 39, 32,116,104,101,110, 10,110, 97,
+   114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,101,110,100,
+    10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,101,110,
+   100, 10,111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40,
+   108,117, 97, 95,103,101,116,116,111,112, 40,116,111,108,117,
+    97, 95, 83, 41, 32, 62, 32, 39, 46, 46, 40,110, 97,114,103,
+    45, 49, 41, 46, 46, 39, 41, 92,110, 39, 41, 10,111,117,116,
+   112,117,116, 40, 39, 32,114,101,116,117,114,110, 32,108,117,
+    97, 76, 95, 97,114,103,101,114,114,111,114, 40,116,111,108,
+   117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46, 46, 39,
+    44, 34,110,111, 32,118, 97,108,117,101, 32,101,120,112,101,
+    99,116,101,100, 34, 41, 59, 39, 41, 10,111,117,116,112,117,
+   116, 40, 39, 35,101,110,100,105,102, 92,110, 39, 41, 10,111,
+   117,116,112,117,116, 40, 39, 32,123, 39, 41, 10,101,108,115,
+   101, 10,105,102, 32,111,118,101,114,108,111, 97,100, 32, 60,
+    32, 48, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
+    39, 35,105,102,110,100,101,102, 32, 84, 79, 76, 85, 65, 95,
+    82, 69, 76, 69, 65, 83, 69, 92,110, 39, 41, 10,101,110,100,
+    10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97,
+    95, 69,114,114,111,114, 32,116,111,108,117, 97, 95,101,114,
+   114, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,105,
+   102, 32, 40, 92,110, 39, 41, 10,108,111, 99, 97,108, 32,110,
+    97,114,103, 10,105,102, 32, 99,108, 97,115,115, 32,116,104,
+   101,110, 32,110, 97,114,103, 61, 50, 32,101,108,115,101, 32,
+   110, 97,114,103, 61, 49, 32,101,110,100, 10,105,102, 32, 99,
+   108, 97,115,115, 32,116,104,101,110, 10,108,111, 99, 97,108,
+    32,102,117,110, 99, 32, 61, 32, 39,116,111,108,117, 97, 95,
+   105,115,117,115,101,114,116,121,112,101, 39, 10,108,111, 99,
+    97,108, 32,116,121,112,101, 32, 61, 32,115,101,108,102, 46,
+   112, 97,114,101,110,116, 46,116,121,112,101, 10,105,102, 32,
+   115,101,108,102, 46, 99,111,110,115,116, 32,126, 61, 32, 39,
+    39, 32,116,104,101,110, 10,116,121,112,101, 32, 61, 32,115,
+   101,108,102, 46, 99,111,110,115,116, 32, 46, 46, 32, 34, 32,
+    34, 32, 46, 46, 32,116,121,112,101, 10,101,110,100, 10,105,
+   102, 32,115,101,108,102, 46,110, 97,109,101, 61, 61, 39,110,
+   101,119, 39, 32,111,114, 32,115,116, 97,116,105, 99,126, 61,
+   110,105,108, 32,116,104,101,110, 10,102,117,110, 99, 32, 61,
+    32, 39,116,111,108,117, 97, 95,105,115,117,115,101,114,116,
+    97, 98,108,101, 39, 10,116,121,112,101, 32, 61, 32,115,101,
+   108,102, 46,112, 97,114,101,110,116, 46,116,121,112,101, 10,
+   101,110,100, 10,111,117,116,112,117,116, 40, 39, 32, 33, 39,
+    46, 46,102,117,110, 99, 46, 46, 39, 40,116,111,108,117, 97,
+    95, 83, 44, 49, 44, 34, 39, 46, 46,116,121,112,101, 46, 46,
+    39, 34, 44, 48, 44, 38,116,111,108,117, 97, 95,101,114,114,
+    41, 32,124,124, 32, 92,110, 39, 41, 10,101,110,100, 10,108,
+   111, 99, 97,108, 32,118, 97,114, 97,114,103, 32, 61, 32,102,
+    97,108,115,101, 10,105,102, 32,115,101,108,102, 46, 97,114,
+   103,115, 91, 49, 93, 46,116,121,112,101, 32,126, 61, 32, 39,
+   118,111,105,100, 39, 32,116,104,101,110, 10,108,111, 99, 97,
+   108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,
+   102, 46, 97,114,103,115, 91,105, 93, 32, 97,110,100, 32,115,
+   101,108,102, 46, 97,114,103,115, 91,105, 93, 46,116,121,112,
+   101, 32,126, 61, 32, 34, 46, 46, 46, 34, 32,100,111, 10,108,
+   111, 99, 97,108, 32, 98,116,121,112,101, 32, 61, 32,105,115,
+    98, 97,115,105, 99, 40,115,101,108,102, 46, 97,114,103,115,
+    91,105, 93, 46,116,121,112,101, 41, 10,105,102, 32, 98,116,
+   121,112,101, 32,126, 61, 32, 39,115,116, 97,116,101, 39, 32,
+   116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 32, 33,
+    39, 46, 46,115,101,108,102, 46, 97,114,103,115, 91,105, 93,
+    58,111,117,116, 99,104,101, 99,107,116,121,112,101, 40,110,
+    97,114,103, 44,102, 97,108,115,101, 41, 46, 46, 39, 32,124,
+   124, 32, 92,110, 39, 41, 10,101,110,100, 10,105,102, 32, 98,
+   116,121,112,101, 32,126, 61, 32, 39,115,116, 97,116,101, 39,
+    32,116,104,101,110, 10,110, 97,114,103, 32, 61, 32,110, 97,
+   114,103, 43, 49, 10,101,110,100, 10,105, 32, 61, 32,105, 43,
+    49, 10,101,110,100, 10,105,102, 32,115,101,108,102, 46, 97,
+   114,103,115, 91,105, 93, 32,116,104,101,110, 10,118, 97,114,
+    97,114,103, 32, 61, 32,116,114,117,101, 10,101,110,100, 10,
+   101,110,100, 10,105,102, 32,110,111,116, 32,118, 97,114, 97,
+   114,103, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
+    39, 32, 33,116,111,108,117, 97, 95,105,115,110,111,111, 98,
+   106, 40,116,111,108,117, 97, 95, 83, 44, 39, 46, 46,110, 97,
+   114,103, 46, 46, 39, 44, 38,116,111,108,117, 97, 95,101,114,
+   114, 41, 92,110, 39, 41, 10,101,108,115,101, 10,111,117,116,
+   112,117,116, 40, 39, 32, 48, 92,110, 39, 41, 10,101,110,100,
+    10,111,117,116,112,117,116, 40, 39, 32, 41, 39, 41, 10,111,
+   117,116,112,117,116, 40, 39, 32,103,111,116,111, 32,116,111,
+   108,117, 97, 95,108,101,114,114,111,114, 59, 39, 41, 10,111,
+   117,116,112,117,116, 40, 39, 32,101,108,115,101, 92,110, 39,
+    41, 10,105,102, 32,111,118,101,114,108,111, 97,100, 32, 60,
+    32, 48, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
+    39, 35,101,110,100,105,102, 92,110, 39, 41, 10,101,110,100,
+    10,111,117,116,112,117,116, 40, 39, 32,123, 39, 41, 10,101,
+   110,100, 10,108,111, 99, 97,108, 32,110, 97,114,103, 10,105,
    102, 32, 99,108, 97,115,115, 32,116,104,101,110, 32,110, 97,
    114,103, 61, 50, 32,101,108,115,101, 32,110, 97,114,103, 61,
     49, 32,101,110,100, 10,105,102, 32, 99,108, 97,115,115, 32,
-   116,104,101,110, 10,108,111, 99, 97,108, 32,102,117,110, 99,
-    32, 61, 32, 39,116,111,108,117, 97, 95,105,115,117,115,101,
-   114,116,121,112,101, 39, 10,108,111, 99, 97,108, 32,116,121,
-   112,101, 32, 61, 32,115,101,108,102, 46,112, 97,114,101,110,
-   116, 46,116,121,112,101, 10,105,102, 32,115,101,108,102, 46,
-    99,111,110,115,116, 32,126, 61, 32, 39, 39, 32,116,104,101,
-   110, 10,116,121,112,101, 32, 61, 32,115,101,108,102, 46, 99,
-   111,110,115,116, 32, 46, 46, 32, 34, 32, 34, 32, 46, 46, 32,
-   116,121,112,101, 10,101,110,100, 10,105,102, 32,115,101,108,
-   102, 46,110, 97,109,101, 61, 61, 39,110,101,119, 39, 32,111,
-   114, 32,115,116, 97,116,105, 99,126, 61,110,105,108, 32,116,
-   104,101,110, 10,102,117,110, 99, 32, 61, 32, 39,116,111,108,
-   117, 97, 95,105,115,117,115,101,114,116, 97, 98,108,101, 39,
-    10,116,121,112,101, 32, 61, 32,115,101,108,102, 46,112, 97,
-   114,101,110,116, 46,116,121,112,101, 10,101,110,100, 10,111,
-   117,116,112,117,116, 40, 39, 32, 33, 39, 46, 46,102,117,110,
-    99, 46, 46, 39, 40,116,111,108,117, 97, 95, 83, 44, 49, 44,
-    34, 39, 46, 46,116,121,112,101, 46, 46, 39, 34, 44, 48, 44,
-    38,116,111,108,117, 97, 95,101,114,114, 41, 32,124,124, 32,
-    92,110, 39, 41, 10,101,110,100, 10,108,111, 99, 97,108, 32,
-   118, 97,114, 97,114,103, 32, 61, 32,102, 97,108,115,101, 10,
-   105,102, 32,115,101,108,102, 46, 97,114,103,115, 91, 49, 93,
-    46,116,121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39,
-    32,116,104,101,110, 10,108,111, 99, 97,108, 32,105, 61, 49,
-    10,119,104,105,108,101, 32,115,101,108,102, 46, 97,114,103,
-   115, 91,105, 93, 32, 97,110,100, 32,115,101,108,102, 46, 97,
-   114,103,115, 91,105, 93, 46,116,121,112,101, 32,126, 61, 32,
-    34, 46, 46, 46, 34, 32,100,111, 10,108,111, 99, 97,108, 32,
-    98,116,121,112,101, 32, 61, 32,105,115, 98, 97,115,105, 99,
-    40,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 46,116,
-   121,112,101, 41, 10,105,102, 32, 98,116,121,112,101, 32,126,
-    61, 32, 39,115,116, 97,116,101, 39, 32,116,104,101,110, 10,
-   111,117,116,112,117,116, 40, 39, 32, 33, 39, 46, 46,115,101,
-   108,102, 46, 97,114,103,115, 91,105, 93, 58,111,117,116, 99,
-   104,101, 99,107,116,121,112,101, 40,110, 97,114,103, 44,102,
-    97,108,115,101, 41, 46, 46, 39, 32,124,124, 32, 92,110, 39,
-    41, 10,101,110,100, 10,105,102, 32, 98,116,121,112,101, 32,
-   126, 61, 32, 39,115,116, 97,116,101, 39, 32,116,104,101,110,
-    10,110, 97,114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,
-   101,110,100, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100,
-    10,105,102, 32,115,101,108,102, 46, 97,114,103,115, 91,105,
-    93, 32,116,104,101,110, 10,118, 97,114, 97,114,103, 32, 61,
-    32,116,114,117,101, 10,101,110,100, 10,101,110,100, 10,105,
-   102, 32,110,111,116, 32,118, 97,114, 97,114,103, 32,116,104,
-   101,110, 10,111,117,116,112,117,116, 40, 39, 32, 33,116,111,
-   108,117, 97, 95,105,115,110,111,111, 98,106, 40,116,111,108,
-   117, 97, 95, 83, 44, 39, 46, 46,110, 97,114,103, 46, 46, 39,
-    44, 38,116,111,108,117, 97, 95,101,114,114, 41, 92,110, 39,
-    41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40, 39,
-    32, 48, 92,110, 39, 41, 10,101,110,100, 10,111,117,116,112,
-   117,116, 40, 39, 32, 41, 39, 41, 10,111,117,116,112,117,116,
-    40, 39, 32,103,111,116,111, 32,116,111,108,117, 97, 95,108,
-   101,114,114,111,114, 59, 39, 41, 10,111,117,116,112,117,116,
-    40, 39, 32,101,108,115,101, 92,110, 39, 41, 10,105,102, 32,
-   111,118,101,114,108,111, 97,100, 32, 60, 32, 48, 32,116,104,
-   101,110, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,
-   105,102, 92,110, 39, 41, 10,101,110,100, 10,111,117,116,112,
-   117,116, 40, 39, 32,123, 39, 41, 10,108,111, 99, 97,108, 32,
-   110, 97,114,103, 10,105,102, 32, 99,108, 97,115,115, 32,116,
-   104,101,110, 32,110, 97,114,103, 61, 50, 32,101,108,115,101,
-    32,110, 97,114,103, 61, 49, 32,101,110,100, 10,105,102, 32,
-    99,108, 97,115,115, 32, 97,110,100, 32,115,101,108,102, 46,
-   110, 97,109,101,126, 61, 39,110,101,119, 39, 32, 97,110,100,
-    32,115,116, 97,116,105, 99, 61, 61,110,105,108, 32,116,104,
-   101,110, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,115,
-   101,108,102, 46, 99,111,110,115,116, 44,115,101,108,102, 46,
-   112, 97,114,101,110,116, 46,116,121,112,101, 44, 39, 42, 39,
-    44, 39,115,101,108,102, 32, 61, 32, 39, 41, 10,111,117,116,
-   112,117,116, 40, 39, 40, 39, 44,115,101,108,102, 46, 99,111,
+    97,110,100, 32,115,101,108,102, 46,110, 97,109,101,126, 61,
+    39,110,101,119, 39, 32, 97,110,100, 32,115,116, 97,116,105,
+    99, 61, 61,110,105,108, 32,116,104,101,110, 10,111,117,116,
+   112,117,116, 40, 39, 32, 39, 44,115,101,108,102, 46, 99,111,
    110,115,116, 44,115,101,108,102, 46,112, 97,114,101,110,116,
-    46,116,121,112,101, 44, 39, 42, 41, 32, 39, 41, 10,111,117,
-   116,112,117,116, 40, 39,116,111,108,117, 97, 95,116,111,117,
-   115,101,114,116,121,112,101, 40,116,111,108,117, 97, 95, 83,
-    44, 49, 44, 48, 41, 59, 39, 41, 10,101,108,115,101,105,102,
-    32,115,116, 97,116,105, 99, 32,116,104,101,110, 10, 95, 44,
-    95, 44,115,101,108,102, 46,109,111,100, 32, 61, 32,115,116,
-   114,102,105,110,100, 40,115,101,108,102, 46,109,111,100, 44,
-    39, 94, 37,115, 42,115,116, 97,116,105, 99, 37,115, 37,115,
-    42, 40, 46, 42, 41, 39, 41, 10,101,110,100, 10,105,102, 32,
-   115,101,108,102, 46, 97,114,103,115, 91, 49, 93, 46,116,121,
-   112,101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,116,104,
-   101,110, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,
-   105,108,101, 32,115,101,108,102, 46, 97,114,103,115, 91,105,
-    93, 32, 97,110,100, 32,115,101,108,102, 46, 97,114,103,115,
-    91,105, 93, 46,116,121,112,101, 32,126, 61, 32, 34, 46, 46,
-    46, 34, 32,100,111, 10,115,101,108,102, 46, 97,114,103,115,
-    91,105, 93, 58,100,101, 99,108, 97,114,101, 40,110, 97,114,
-   103, 41, 10,105,102, 32,105,115, 98, 97,115,105, 99, 40,115,
-   101,108,102, 46, 97,114,103,115, 91,105, 93, 46,116,121,112,
-   101, 41, 32,126, 61, 32, 34,115,116, 97,116,101, 34, 32,116,
-   104,101,110, 10,110, 97,114,103, 32, 61, 32,110, 97,114,103,
-    43, 49, 10,101,110,100, 10,105, 32, 61, 32,105, 43, 49, 10,
-   101,110,100, 10,101,110,100, 10,105,102, 32, 99,108, 97,115,
-   115, 32, 97,110,100, 32,115,101,108,102, 46,110, 97,109,101,
-   126, 61, 39,110,101,119, 39, 32, 97,110,100, 32,115,116, 97,
-   116,105, 99, 61, 61,110,105,108, 32,116,104,101,110, 10,111,
-   117,116,112,117,116, 40, 39, 35,105,102,110,100,101,102, 32,
-    84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83, 69, 92,110,
-    39, 41, 10,111,117,116,112,117,116, 40, 39, 32,105,102, 32,
-    40, 33,115,101,108,102, 41, 32,116,111,108,117, 97, 95,101,
-   114,114,111,114, 40,116,111,108,117, 97, 95, 83, 44, 34,105,
-   110,118, 97,108,105,100, 32, 92, 39,115,101,108,102, 92, 39,
-    32,105,110, 32,102,117,110, 99,116,105,111,110, 32, 92, 39,
-    39, 46, 46,115,101,108,102, 46,110, 97,109,101, 46, 46, 39,
-    92, 39, 34, 44, 78, 85, 76, 76, 41, 59, 39, 41, 59, 10,111,
-   117,116,112,117,116, 40, 39, 35,101,110,100,105,102, 92,110,
-    39, 41, 10,101,110,100, 10,105,102, 32, 99,108, 97,115,115,
-    32,116,104,101,110, 32,110, 97,114,103, 61, 50, 32,101,108,
-   115,101, 32,110, 97,114,103, 61, 49, 32,101,110,100, 10,105,
-   102, 32,115,101,108,102, 46, 97,114,103,115, 91, 49, 93, 46,
-   116,121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,
-   116,104,101,110, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,
-   119,104,105,108,101, 32,115,101,108,102, 46, 97,114,103,115,
-    91,105, 93, 32, 97,110,100, 32,115,101,108,102, 46, 97,114,
-   103,115, 91,105, 93, 46,116,121,112,101, 32,126, 61, 32, 34,
-    46, 46, 46, 34, 32,100,111, 10,105,102, 32,105,115, 98, 97,
-   115,105, 99, 40,115,101,108,102, 46, 97,114,103,115, 91,105,
-    93, 46,116,121,112,101, 41, 32,126, 61, 32, 34,115,116, 97,
-   116,101, 34, 32,116,104,101,110, 10,115,101,108,102, 46, 97,
-   114,103,115, 91,105, 93, 58,103,101,116, 97,114,114, 97,121,
-    40,110, 97,114,103, 41, 10,110, 97,114,103, 32, 61, 32,110,
-    97,114,103, 43, 49, 10,101,110,100, 10,105, 32, 61, 32,105,
-    43, 49, 10,101,110,100, 10,101,110,100, 10,105,102, 32, 99,
+    46,116,121,112,101, 44, 39, 42, 39, 44, 39,115,101,108,102,
+    32, 61, 32, 39, 41, 10,111,117,116,112,117,116, 40, 39, 40,
+    39, 44,115,101,108,102, 46, 99,111,110,115,116, 44,115,101,
+   108,102, 46,112, 97,114,101,110,116, 46,116,121,112,101, 44,
+    39, 42, 41, 32, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+   116,111,108,117, 97, 95,116,111,117,115,101,114,116,121,112,
+   101, 40,116,111,108,117, 97, 95, 83, 44, 49, 44, 48, 41, 59,
+    39, 41, 10,101,108,115,101,105,102, 32,115,116, 97,116,105,
+    99, 32,116,104,101,110, 10, 95, 44, 95, 44,115,101,108,102,
+    46,109,111,100, 32, 61, 32,115,116,114,102,105,110,100, 40,
+   115,101,108,102, 46,109,111,100, 44, 39, 94, 37,115, 42,115,
+   116, 97,116,105, 99, 37,115, 37,115, 42, 40, 46, 42, 41, 39,
+    41, 10,101,110,100, 10,105,102, 32,115,101,108,102, 46, 97,
+   114,103,115, 91, 49, 93, 46,116,121,112,101, 32,126, 61, 32,
+    39,118,111,105,100, 39, 32,116,104,101,110, 10,108,111, 99,
+    97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,
+   108,102, 46, 97,114,103,115, 91,105, 93, 32, 97,110,100, 32,
+   115,101,108,102, 46, 97,114,103,115, 91,105, 93, 46,116,121,
+   112,101, 32,126, 61, 32, 34, 46, 46, 46, 34, 32,100,111, 10,
+   115,101,108,102, 46, 97,114,103,115, 91,105, 93, 58,100,101,
+    99,108, 97,114,101, 40,110, 97,114,103, 44,102, 97,115,116,
+    41, 10,105,102, 32,105,115, 98, 97,115,105, 99, 40,115,101,
+   108,102, 46, 97,114,103,115, 91,105, 93, 46,116,121,112,101,
+    41, 32,126, 61, 32, 34,115,116, 97,116,101, 34, 32,116,104,
+   101,110, 10,110, 97,114,103, 32, 61, 32,110, 97,114,103, 43,
+    49, 10,101,110,100, 10,105, 32, 61, 32,105, 43, 49, 10,101,
+   110,100, 10,101,110,100, 10,105,102, 32, 99,108, 97,115,115,
+    32, 97,110,100, 32,115,101,108,102, 46,110, 97,109,101,126,
+    61, 39,110,101,119, 39, 32, 97,110,100, 32,115,116, 97,116,
+   105, 99, 61, 61,110,105,108, 32,116,104,101,110, 10,111,117,
+   116,112,117,116, 40, 39, 35,105,102,110,100,101,102, 32, 84,
+    79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83, 69, 92,110, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40,
+    33,115,101,108,102, 41, 32,116,111,108,117, 97, 95,101,114,
+   114,111,114, 40,116,111,108,117, 97, 95, 83, 44, 34,105,110,
+   118, 97,108,105,100, 32, 92, 39,115,101,108,102, 92, 39, 32,
+   105,110, 32,102,117,110, 99,116,105,111,110, 32, 92, 39, 39,
+    46, 46,115,101,108,102, 46,110, 97,109,101, 46, 46, 39, 92,
+    39, 34, 44, 78, 85, 76, 76, 41, 59, 39, 41, 59, 10,111,117,
+   116,112,117,116, 40, 39, 35,101,110,100,105,102, 92,110, 39,
+    41, 10,101,110,100, 10,105,102, 32, 99,108, 97,115,115, 32,
+   116,104,101,110, 32,110, 97,114,103, 61, 50, 32,101,108,115,
+   101, 32,110, 97,114,103, 61, 49, 32,101,110,100, 10,105,102,
+    32,115,101,108,102, 46, 97,114,103,115, 91, 49, 93, 46,116,
+   121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,116,
+   104,101,110, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,
+   104,105,108,101, 32,115,101,108,102, 46, 97,114,103,115, 91,
+   105, 93, 32, 97,110,100, 32,115,101,108,102, 46, 97,114,103,
+   115, 91,105, 93, 46,116,121,112,101, 32,126, 61, 32, 34, 46,
+    46, 46, 34, 32,100,111, 10,105,102, 32,105,115, 98, 97,115,
+   105, 99, 40,115,101,108,102, 46, 97,114,103,115, 91,105, 93,
+    46,116,121,112,101, 41, 32,126, 61, 32, 34,115,116, 97,116,
+   101, 34, 32,116,104,101,110, 10,115,101,108,102, 46, 97,114,
+   103,115, 91,105, 93, 58,103,101,116, 97,114,114, 97,121, 40,
+   110, 97,114,103, 41, 10,110, 97,114,103, 32, 61, 32,110, 97,
+   114,103, 43, 49, 10,101,110,100, 10,105, 32, 61, 32,105, 43,
+    49, 10,101,110,100, 10,101,110,100, 10,105,102, 32, 99,108,
+    97,115,115, 32, 97,110,100, 32,115,101,108,102, 46,110, 97,
+   109,101, 61, 61, 39,100,101,108,101,116,101, 39, 32,116,104,
+   101,110, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,
+   117, 97, 95,114,101,108,101, 97,115,101, 40,116,111,108,117,
+    97, 95, 83, 44,115,101,108,102, 41, 59, 39, 41, 10,111,117,
+   116,112,117,116, 40, 39, 32,100,101,108,101,116,101, 32,115,
+   101,108,102, 59, 39, 41, 10,101,108,115,101,105,102, 32, 99,
    108, 97,115,115, 32, 97,110,100, 32,115,101,108,102, 46,110,
-    97,109,101, 61, 61, 39,100,101,108,101,116,101, 39, 32,116,
-   104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,116,111,
-   108,117, 97, 95,114,101,108,101, 97,115,101, 40,116,111,108,
-   117, 97, 95, 83, 44,115,101,108,102, 41, 59, 39, 41, 10,111,
-   117,116,112,117,116, 40, 39, 32,100,101,108,101,116,101, 32,
-   115,101,108,102, 59, 39, 41, 10,101,108,115,101,105,102, 32,
-    99,108, 97,115,115, 32, 97,110,100, 32,115,101,108,102, 46,
-   110, 97,109,101, 32, 61, 61, 32, 39,111,112,101,114, 97,116,
-   111,114, 38, 91, 93, 39, 32,116,104,101,110, 10,111,117,116,
-   112,117,116, 40, 39, 32,115,101,108,102, 45, 62,111,112,101,
-   114, 97,116,111,114, 91, 93, 40, 39, 44,115,101,108,102, 46,
-    97,114,103,115, 91, 49, 93, 46,110, 97,109,101, 44, 39, 45,
-    49, 41, 32, 61, 32, 39, 44,115,101,108,102, 46, 97,114,103,
-   115, 91, 50, 93, 46,110, 97,109,101, 44, 39, 59, 39, 41, 10,
-   101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,123,
-    39, 41, 10,105,102, 32,115,101,108,102, 46,116,121,112,101,
-    32,126, 61, 32, 39, 39, 32, 97,110,100, 32,115,101,108,102,
-    46,116,121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39,
-    32,116,104,101,110, 10,108,111, 99, 97,108, 32, 99,116,121,
-   112,101, 32, 61, 32,115,101,108,102, 46,116,121,112,101, 10,
-   105,102, 32, 99,116,121,112,101, 32, 61, 61, 32, 39,118, 97,
-   108,117,101, 39, 32,111,114, 32, 99,116,121,112,101, 32, 61,
-    61, 32, 39,102,117,110, 99,116,105,111,110, 39, 32,116,104,
-   101,110, 10, 99,116,121,112,101, 32, 61, 32, 39,105,110,116,
-    39, 10,101,110,100, 10,111,117,116,112,117,116, 40, 39, 32,
-    39, 44,115,101,108,102, 46,109,111,100, 44, 99,116,121,112,
-   101, 44,115,101,108,102, 46,112,116,114, 44, 39,116,111,108,
-   117, 97, 95,114,101,116, 32, 61, 32, 39, 41, 10,105,102, 32,
-   105,115, 98, 97,115,105, 99, 40,115,101,108,102, 46,116,121,
-   112,101, 41, 32,111,114, 32,115,101,108,102, 46,112,116,114,
-    32,126, 61, 32, 39, 39, 32,116,104,101,110, 10,111,117,116,
-   112,117,116, 40, 39, 40, 39, 44,115,101,108,102, 46,109,111,
-   100, 44, 99,116,121,112,101, 44,115,101,108,102, 46,112,116,
-   114, 44, 39, 41, 32, 39, 41, 10,101,110,100, 10,101,108,115,
-   101, 10,111,117,116,112,117,116, 40, 39, 32, 39, 41, 10,101,
-   110,100, 10,105,102, 32, 99,108, 97,115,115, 32, 97,110,100,
-    32,115,101,108,102, 46,110, 97,109,101, 61, 61, 39,110,101,
-   119, 39, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
-    39,110,101,119, 39, 44,115,101,108,102, 46,116,121,112,101,
-    44, 39, 40, 39, 41, 10,101,108,115,101,105,102, 32, 99,108,
-    97,115,115, 32, 97,110,100, 32,115,116, 97,116,105, 99, 32,
-   116,104,101,110, 10,111,117,116,112,117,116, 40, 99,108, 97,
-   115,115, 46, 46, 39, 58, 58, 39, 46, 46,115,101,108,102, 46,
-   110, 97,109,101, 44, 39, 40, 39, 41, 10,101,108,115,101,105,
-   102, 32, 99,108, 97,115,115, 32,116,104,101,110, 10,111,117,
-   116,112,117,116, 40, 39,115,101,108,102, 45, 62, 39, 46, 46,
-   115,101,108,102, 46,110, 97,109,101, 44, 39, 40, 39, 41, 10,
-   101,108,115,101, 10,111,117,116,112,117,116, 40,115,101,108,
-   102, 46,110, 97,109,101, 44, 39, 40, 39, 41, 10,101,110,100,
-    10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,
-   101, 32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32,
-    97,110,100, 32,115,101,108,102, 46, 97,114,103,115, 91,105,
-    93, 46,116,121,112,101, 32,126, 61, 32, 34, 46, 46, 46, 34,
-    32,100,111, 10,115,101,108,102, 46, 97,114,103,115, 91,105,
-    93, 58,112, 97,115,115,112, 97,114, 40, 41, 10,105, 32, 61,
-    32,105, 43, 49, 10,105,102, 32,115,101,108,102, 46, 97,114,
-   103,115, 91,105, 93, 32, 97,110,100, 32,115,101,108,102, 46,
-    97,114,103,115, 91,105, 93, 46,116,121,112,101, 32,126, 61,
-    32, 34, 46, 46, 46, 34, 32,116,104,101,110, 10,111,117,116,
-   112,117,116, 40, 39, 44, 39, 41, 10,101,110,100, 10,101,110,
+    97,109,101, 32, 61, 61, 32, 39,111,112,101,114, 97,116,111,
+   114, 38, 91, 93, 39, 32,116,104,101,110, 10,111,117,116,112,
+   117,116, 40, 39, 32,115,101,108,102, 45, 62,111,112,101,114,
+    97,116,111,114, 91, 93, 40, 39, 44,115,101,108,102, 46, 97,
+   114,103,115, 91, 49, 93, 46,110, 97,109,101, 44, 39, 45, 49,
+    41, 32, 61, 32, 39, 44,115,101,108,102, 46, 97,114,103,115,
+    91, 50, 93, 46,110, 97,109,101, 44, 39, 59, 39, 41, 10,101,
+   108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,123, 39,
+    41, 10,105,102, 32,115,101,108,102, 46,116,121,112,101, 32,
+   126, 61, 32, 39, 39, 32, 97,110,100, 32,115,101,108,102, 46,
+   116,121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,
+   116,104,101,110, 10,108,111, 99, 97,108, 32, 99,116,121,112,
+   101, 32, 61, 32,115,101,108,102, 46,116,121,112,101, 10,105,
+   102, 32, 99,116,121,112,101, 32, 61, 61, 32, 39,118, 97,108,
+   117,101, 39, 32,111,114, 32, 99,116,121,112,101, 32, 61, 61,
+    32, 39,102,117,110, 99,116,105,111,110, 39, 32,116,104,101,
+   110, 10, 99,116,121,112,101, 32, 61, 32, 39,105,110,116, 39,
+    10,101,110,100, 10,111,117,116,112,117,116, 40, 39, 32, 39,
+    44,115,101,108,102, 46,109,111,100, 44, 99,116,121,112,101,
+    44,115,101,108,102, 46,112,116,114, 44, 39,116,111,108,117,
+    97, 95,114,101,116, 32, 61, 32, 39, 41, 10,105,102, 32,105,
+   115, 98, 97,115,105, 99, 40,115,101,108,102, 46,116,121,112,
+   101, 41, 32,111,114, 32,115,101,108,102, 46,112,116,114, 32,
+   126, 61, 32, 39, 39, 32,116,104,101,110, 10,111,117,116,112,
+   117,116, 40, 39, 40, 39, 44,115,101,108,102, 46,109,111,100,
+    44, 99,116,121,112,101, 44,115,101,108,102, 46,112,116,114,
+    44, 39, 41, 32, 39, 41, 10,101,110,100, 10,101,108,115,101,
+    10,111,117,116,112,117,116, 40, 39, 32, 39, 41, 10,101,110,
    100, 10,105,102, 32, 99,108, 97,115,115, 32, 97,110,100, 32,
-   115,101,108,102, 46,110, 97,109,101, 32, 61, 61, 32, 39,111,
-   112,101,114, 97,116,111,114, 91, 93, 39, 32,116,104,101,110,
-    10,111,117,116,112,117,116, 40, 39, 45, 49, 41, 59, 39, 41,
-    10,101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 41,
-    59, 39, 41, 10,101,110,100, 10,105,102, 32,115,101,108,102,
-    46,116,121,112,101, 32,126, 61, 32, 39, 39, 32, 97,110,100,
-    32,115,101,108,102, 46,116,121,112,101, 32,126, 61, 32, 39,
-   118,111,105,100, 39, 32,116,104,101,110, 10,110,114,101,116,
-    32, 61, 32,110,114,101,116, 32, 43, 32, 49, 10,108,111, 99,
-    97,108, 32,116, 44, 99,116, 32, 61, 32,105,115, 98, 97,115,
-   105, 99, 40,115,101,108,102, 46,116,121,112,101, 41, 10,105,
-   102, 32,116, 32,116,104,101,110, 10,105,102, 32,116, 61, 61,
-    39,102,117,110, 99,116,105,111,110, 39, 32,116,104,101,110,
-    32,116, 61, 39,118, 97,108,117,101, 39, 32,101,110,100, 10,
-   105,102, 32,115,101,108,102, 46,116,121,112,101, 32, 61, 61,
-    32, 39,116,111,108,117, 97, 95,105,110,100,101,120, 39, 32,
-   116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,105,
-   102, 32, 40,116,111,108,117, 97, 95,114,101,116, 32, 60, 32,
-    48, 41, 32,108,117, 97, 95,112,117,115,104,110,105,108, 40,
-   116,111,108,117, 97, 95, 83, 41, 59, 39, 41, 10,111,117,116,
-   112,117,116, 40, 39, 32,101,108,115,101, 32,116,111,108,117,
-    97, 95,112,117,115,104, 39, 46, 46,116, 46, 46, 39, 40,116,
-   111,108,117, 97, 95, 83, 44, 40, 39, 44, 99,116, 44, 39, 41,
-   116,111,108,117, 97, 95,114,101,116, 43, 49, 41, 59, 39, 41,
-    10,101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,
-   116,111,108,117, 97, 95,112,117,115,104, 39, 46, 46,116, 46,
-    46, 39, 40,116,111,108,117, 97, 95, 83, 44, 40, 39, 44, 99,
-   116, 44, 39, 41,116,111,108,117, 97, 95,114,101,116, 41, 59,
-    39, 41, 10,101,110,100, 10,101,108,115,101, 10,116, 32, 61,
-    32,115,101,108,102, 46,116,121,112,101, 10,105,102, 32,115,
-   101,108,102, 46,112,116,114, 32, 61, 61, 32, 39, 39, 32,116,
-   104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,123, 39,
-    41, 10,111,117,116,112,117,116, 40, 39, 35,105,102,100,101,
-   102, 32, 95, 95, 99,112,108,117,115,112,108,117,115, 92,110,
-    39, 41, 10,111,117,116,112,117,116, 40, 39, 32,118,111,105,
-   100, 42, 32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,
-   110,101,119, 39, 44,116, 44, 39, 40,116,111,108,117, 97, 95,
-   114,101,116, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40,
+   115,101,108,102, 46,110, 97,109,101, 61, 61, 39,110,101,119,
+    39, 32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39,
+   110,101,119, 39, 44,115,101,108,102, 46,116,121,112,101, 44,
+    39, 40, 39, 41, 10,101,108,115,101,105,102, 32, 99,108, 97,
+   115,115, 32, 97,110,100, 32,115,116, 97,116,105, 99, 32,116,
+   104,101,110, 10,111,117,116,112,117,116, 40, 99,108, 97,115,
+   115, 46, 46, 39, 58, 58, 39, 46, 46,115,101,108,102, 46,110,
+    97,109,101, 44, 39, 40, 39, 41, 10,101,108,115,101,105,102,
+    32, 99,108, 97,115,115, 32,116,104,101,110, 10,111,117,116,
+   112,117,116, 40, 39,115,101,108,102, 45, 62, 39, 46, 46,115,
+   101,108,102, 46,110, 97,109,101, 44, 39, 40, 39, 41, 10,101,
+   108,115,101, 10,111,117,116,112,117,116, 40,115,101,108,102,
+    46,110, 97,109,101, 44, 39, 40, 39, 41, 10,101,110,100, 10,
+   108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101,
+    32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32, 97,
+   110,100, 32,115,101,108,102, 46, 97,114,103,115, 91,105, 93,
+    46,116,121,112,101, 32,126, 61, 32, 34, 46, 46, 46, 34, 32,
+   100,111, 10,115,101,108,102, 46, 97,114,103,115, 91,105, 93,
+    58,112, 97,115,115,112, 97,114, 40, 41, 10,105, 32, 61, 32,
+   105, 43, 49, 10,105,102, 32,115,101,108,102, 46, 97,114,103,
+   115, 91,105, 93, 32, 97,110,100, 32,115,101,108,102, 46, 97,
+   114,103,115, 91,105, 93, 46,116,121,112,101, 32,126, 61, 32,
+    34, 46, 46, 46, 34, 32,116,104,101,110, 10,111,117,116,112,
+   117,116, 40, 39, 44, 39, 41, 10,101,110,100, 10,101,110,100,
+    10,105,102, 32, 99,108, 97,115,115, 32, 97,110,100, 32,115,
+   101,108,102, 46,110, 97,109,101, 32, 61, 61, 32, 39,111,112,
+   101,114, 97,116,111,114, 91, 93, 39, 32,116,104,101,110, 10,
+   111,117,116,112,117,116, 40, 39, 45, 49, 41, 59, 39, 41, 10,
+   101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 41, 59,
+    39, 41, 10,101,110,100, 10,105,102, 32,115,101,108,102, 46,
+   116,121,112,101, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,
+   115,101,108,102, 46,116,121,112,101, 32,126, 61, 32, 39,118,
+   111,105,100, 39, 32,116,104,101,110, 10,110,114,101,116, 32,
+    61, 32,110,114,101,116, 32, 43, 32, 49, 10,108,111, 99, 97,
+   108, 32,116, 44, 99,116, 32, 61, 32,105,115, 98, 97,115,105,
+    99, 40,115,101,108,102, 46,116,121,112,101, 41, 10,105,102,
+    32,116, 32,116,104,101,110, 10,105,102, 32,116, 61, 61, 39,
+   102,117,110, 99,116,105,111,110, 39, 32,116,104,101,110, 32,
+   116, 61, 39,118, 97,108,117,101, 39, 32,101,110,100, 10,105,
+   102, 32,115,101,108,102, 46,116,121,112,101, 32, 61, 61, 32,
+    39,116,111,108,117, 97, 95,105,110,100,101,120, 39, 32,116,
+   104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,105,102,
+    32, 40,116,111,108,117, 97, 95,114,101,116, 32, 60, 32, 48,
+    41, 32,108,117, 97, 95,112,117,115,104,110,105,108, 40,116,
+   111,108,117, 97, 95, 83, 41, 59, 39, 41, 10,111,117,116,112,
+   117,116, 40, 39, 32,101,108,115,101, 32,116,111,108,117, 97,
+    95,112,117,115,104, 39, 46, 46,116, 46, 46, 39, 40,116,111,
+   108,117, 97, 95, 83, 44, 40, 39, 44, 99,116, 44, 39, 41,116,
+   111,108,117, 97, 95,114,101,116, 43, 49, 41, 59, 39, 41, 10,
+   101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,116,
+   111,108,117, 97, 95,112,117,115,104, 39, 46, 46,116, 46, 46,
+    39, 40,116,111,108,117, 97, 95, 83, 44, 40, 39, 44, 99,116,
+    44, 39, 41,116,111,108,117, 97, 95,114,101,116, 41, 59, 39,
+    41, 10,101,110,100, 10,101,108,115,101, 10,116, 32, 61, 32,
+   115,101,108,102, 46,116,121,112,101, 10,105,102, 32,115,101,
+   108,102, 46,112,116,114, 32, 61, 61, 32, 39, 39, 32,116,104,
+   101,110, 10,111,117,116,112,117,116, 40, 39, 32,123, 39, 41,
+    10,111,117,116,112,117,116, 40, 39, 35,105,102,100,101,102,
+    32, 95, 95, 99,112,108,117,115,112,108,117,115, 92,110, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 32,118,111,105,100,
+    42, 32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,110,
+   101,119, 39, 44,116, 44, 39, 40,116,111,108,117, 97, 95,114,
+   101,116, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+    32,116,111,108,117, 97, 95,112,117,115,104,117,115,101,114,
+   116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,116,111,
+   108,117, 97, 95, 99,108,111,110,101, 40,116,111,108,117, 97,
+    95, 83, 44,116,111,108,117, 97, 95,111, 98,106, 44, 39, 46,
+    46, 32, 40, 95, 99,111,108,108,101, 99,116, 91,116, 93, 32,
+   111,114, 32, 39, 78, 85, 76, 76, 39, 41, 32, 46, 46, 39, 41,
+    44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,117,
+   116,112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39, 41,
+    10,111,117,116,112,117,116, 40, 39, 32,118,111,105,100, 42,
+    32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,116,111,
+   108,117, 97, 95, 99,111,112,121, 40,116,111,108,117, 97, 95,
+    83, 44, 40,118,111,105,100, 42, 41, 38,116,111,108,117, 97,
+    95,114,101,116, 44,115,105,122,101,111,102, 40, 39, 44,116,
+    44, 39, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40,
     39, 32,116,111,108,117, 97, 95,112,117,115,104,117,115,101,
    114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,116,
    111,108,117, 97, 95, 99,108,111,110,101, 40,116,111,108,117,
-    97, 95, 83, 44,116,111,108,117, 97, 95,111, 98,106, 44, 39,
-    46, 46, 32, 40, 95, 99,111,108,108,101, 99,116, 91,116, 93,
-    32,111,114, 32, 39, 78, 85, 76, 76, 39, 41, 32, 46, 46, 39,
-    41, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,
-   117,116,112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39,
-    41, 10,111,117,116,112,117,116, 40, 39, 32,118,111,105,100,
-    42, 32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,116,
-   111,108,117, 97, 95, 99,111,112,121, 40,116,111,108,117, 97,
-    95, 83, 44, 40,118,111,105,100, 42, 41, 38,116,111,108,117,
-    97, 95,114,101,116, 44,115,105,122,101,111,102, 40, 39, 44,
-   116, 44, 39, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116,
-    40, 39, 32,116,111,108,117, 97, 95,112,117,115,104,117,115,
-   101,114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,
-   116,111,108,117, 97, 95, 99,108,111,110,101, 40,116,111,108,
-   117, 97, 95, 83, 44,116,111,108,117, 97, 95,111, 98,106, 44,
-    78, 85, 76, 76, 41, 44, 34, 39, 44,116, 44, 39, 34, 41, 59,
-    39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,
-   105,102, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,
-    32,125, 39, 41, 10,101,108,115,101,105,102, 32,115,101,108,
-   102, 46,112,116,114, 32, 61, 61, 32, 39, 38, 39, 32,116,104,
-   101,110, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,
-   117, 97, 95,112,117,115,104,117,115,101,114,116,121,112,101,
-    40,116,111,108,117, 97, 95, 83, 44, 40,118,111,105,100, 42,
-    41, 38,116,111,108,117, 97, 95,114,101,116, 44, 34, 39, 44,
-   116, 44, 39, 34, 41, 59, 39, 41, 10,101,108,115,101, 10,111,
-   117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,
-   117,115,104,117,115,101,114,116,121,112,101, 40,116,111,108,
-   117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41,116,111,108,
-   117, 97, 95,114,101,116, 44, 34, 39, 44,116, 44, 39, 34, 41,
-    59, 39, 41, 10,105,102, 32,115,101,108,102, 46,109,111,100,
-    32, 61, 61, 32, 39,116,111,108,117, 97, 95,111,119,110, 39,
-    32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,
-   108,117, 97, 95,112,117,115,104, 99,102,117,110, 99,116,105,
-   111,110, 40,116,111,108,117, 97, 95, 83, 44, 32,116,111,108,
-   117, 97, 95, 98,110,100, 95,116, 97,107,101,111,119,110,101,
-   114,115,104,105,112, 41, 59, 39, 41, 10,111,117,116,112,117,
-   116, 40, 39, 32,108,117, 97, 95,112,117,115,104,118, 97,108,
-   117,101, 40,116,111,108,117, 97, 95, 83, 44, 32, 45, 50, 41,
-    59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,108,117,
-    97, 95, 99, 97,108,108, 40,116,111,108,117, 97, 95, 83, 44,
-    32, 49, 44, 32, 48, 41, 59, 39, 41, 10,101,110,100, 10,101,
-   110,100, 10,101,110,100, 10,101,110,100, 10,108,111, 99, 97,
-   108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,
-   102, 46, 97,114,103,115, 91,105, 93, 32,100,111, 10,110,114,
-   101,116, 32, 61, 32,110,114,101,116, 32, 43, 32,115,101,108,
-   102, 46, 97,114,103,115, 91,105, 93, 58,114,101,116,118, 97,
-   108,117,101, 40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,
-   110,100, 10,111,117,116,112,117,116, 40, 39, 32,125, 39, 41,
-    10,105,102, 32, 99,108, 97,115,115, 32,116,104,101,110, 32,
-   110, 97,114,103, 61, 50, 32,101,108,115,101, 32,110, 97,114,
-   103, 61, 49, 32,101,110,100, 10,105,102, 32,115,101,108,102,
-    46, 97,114,103,115, 91, 49, 93, 46,116,121,112,101, 32,126,
-    61, 32, 39,118,111,105,100, 39, 32,116,104,101,110, 10,108,
-   111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,
-   115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32,100,111,
-    10,105,102, 32,105,115, 98, 97,115,105, 99, 40,115,101,108,
-   102, 46, 97,114,103,115, 91,105, 93, 46,116,121,112,101, 41,
-    32,126, 61, 32, 34,115,116, 97,116,101, 34, 32,116,104,101,
-   110, 10,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 58,
-   115,101,116, 97,114,114, 97,121, 40,110, 97,114,103, 41, 10,
-   110, 97,114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,101,
-   110,100, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,
-   101,110,100, 10,105,102, 32,115,101,108,102, 46, 97,114,103,
-   115, 91, 49, 93, 46,116,121,112,101, 32,126, 61, 32, 39,118,
-   111,105,100, 39, 32,116,104,101,110, 10,108,111, 99, 97,108,
+    97, 95, 83, 44,116,111,108,117, 97, 95,111, 98,106, 44, 78,
+    85, 76, 76, 41, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,
+   102, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,
+   125, 39, 41, 10,101,108,115,101,105,102, 32,115,101,108,102,
+    46,112,116,114, 32, 61, 61, 32, 39, 38, 39, 32,116,104,101,
+   110, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117,
+    97, 95,112,117,115,104,117,115,101,114,116,121,112,101, 40,
+   116,111,108,117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41,
+    38,116,111,108,117, 97, 95,114,101,116, 44, 34, 39, 44,116,
+    44, 39, 34, 41, 59, 39, 41, 10,101,108,115,101, 10,111,117,
+   116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,117,
+   115,104,117,115,101,114,116,121,112,101, 40,116,111,108,117,
+    97, 95, 83, 44, 40,118,111,105,100, 42, 41,116,111,108,117,
+    97, 95,114,101,116, 44, 34, 39, 44,116, 44, 39, 34, 41, 59,
+    39, 41, 10,105,102, 32,115,101,108,102, 46,109,111,100, 32,
+    61, 61, 32, 39,116,111,108,117, 97, 95,111,119,110, 39, 32,
+   116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,108,
+   117, 97, 95,112,117,115,104, 99,102,117,110, 99,116,105,111,
+   110, 40,116,111,108,117, 97, 95, 83, 44, 32,116,111,108,117,
+    97, 95, 98,110,100, 95,116, 97,107,101,111,119,110,101,114,
+   115,104,105,112, 41, 59, 39, 41, 10,111,117,116,112,117,116,
+    40, 39, 32,108,117, 97, 95,112,117,115,104,118, 97,108,117,
+   101, 40,116,111,108,117, 97, 95, 83, 44, 32, 45, 50, 41, 59,
+    39, 41, 10,111,117,116,112,117,116, 40, 39, 32,108,117, 97,
+    95, 99, 97,108,108, 40,116,111,108,117, 97, 95, 83, 44, 32,
+    49, 44, 32, 48, 41, 59, 39, 41, 10,101,110,100, 10,101,110,
+   100, 10,101,110,100, 10,101,110,100, 10,108,111, 99, 97,108,
     32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,102,
-    46, 97,114,103,115, 91,105, 93, 32,100,111, 10,115,101,108,
-   102, 46, 97,114,103,115, 91,105, 93, 58,102,114,101,101, 97,
-   114,114, 97,121, 40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,
-   101,110,100, 10,101,110,100, 10,101,110,100, 10,111,117,116,
-   112,117,116, 40, 39, 32,125, 39, 41, 10,111,117,116,112,117,
-   116, 40, 39, 32,114,101,116,117,114,110, 32, 39, 46, 46,110,
-   114,101,116, 46, 46, 39, 59, 39, 41, 10,105,102, 32,111,118,
-   101,114,108,111, 97,100, 32, 60, 32, 48, 32,116,104,101,110,
-    10,111,117,116,112,117,116, 40, 39, 35,105,102,110,100,101,
-   102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83, 69,
-    92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,116,111,
-   108,117, 97, 95,108,101,114,114,111,114, 58, 92,110, 39, 41,
-    10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97,
-    95,101,114,114,111,114, 40,116,111,108,117, 97, 95, 83, 44,
-    34, 35,102,101,114,114,111,114, 32,105,110, 32,102,117,110,
-    99,116,105,111,110, 32, 92, 39, 39, 46, 46,115,101,108,102,
-    46,108,110, 97,109,101, 46, 46, 39, 92, 39, 46, 34, 44, 38,
-   116,111,108,117, 97, 95,101,114,114, 41, 59, 39, 41, 10,111,
-   117,116,112,117,116, 40, 39, 32,114,101,116,117,114,110, 32,
-    48, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,
-   110,100,105,102, 92,110, 39, 41, 10,101,108,115,101, 10,111,
-   117,116,112,117,116, 40, 39,116,111,108,117, 97, 95,108,101,
-   114,114,111,114, 58, 92,110, 39, 41, 10,111,117,116,112,117,
-   116, 40, 39, 32,114,101,116,117,114,110, 32, 39, 46, 46,115,
-   116,114,115,117, 98, 40,115,101,108,102, 46, 99,110, 97,109,
-   101, 44, 49, 44, 45, 51, 41, 46, 46,102,111,114,109, 97,116,
-    40, 34, 37, 48, 50,100, 34, 44,111,118,101,114,108,111, 97,
-   100, 41, 46, 46, 39, 40,116,111,108,117, 97, 95, 83, 41, 59,
-    39, 41, 10,101,110,100, 10,111,117,116,112,117,116, 40, 39,
-   125, 39, 41, 10,111,117,116,112,117,116, 40, 39, 92,110, 39,
-    41, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
-    99,108, 97,115,115, 70,117,110, 99,116,105,111,110, 58,114,
-   101,103,105,115,116,101,114, 32, 40, 41, 10,111,117,116,112,
-   117,116, 40, 39, 32,116,111,108,117, 97, 95,102,117,110, 99,
-   116,105,111,110, 40,116,111,108,117, 97, 95, 83, 44, 34, 39,
-    46, 46,115,101,108,102, 46,108,110, 97,109,101, 46, 46, 39,
-    34, 44, 39, 46, 46,115,101,108,102, 46, 99,110, 97,109,101,
-    46, 46, 39, 41, 59, 39, 41, 10,101,110,100, 10,102,117,110,
+    46, 97,114,103,115, 91,105, 93, 32,100,111, 10,110,114,101,
+   116, 32, 61, 32,110,114,101,116, 32, 43, 32,115,101,108,102,
+    46, 97,114,103,115, 91,105, 93, 58,114,101,116,118, 97,108,
+   117,101, 40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,
+   100, 10,111,117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,
+   105,102, 32, 99,108, 97,115,115, 32,116,104,101,110, 32,110,
+    97,114,103, 61, 50, 32,101,108,115,101, 32,110, 97,114,103,
+    61, 49, 32,101,110,100, 10,105,102, 32,115,101,108,102, 46,
+    97,114,103,115, 91, 49, 93, 46,116,121,112,101, 32,126, 61,
+    32, 39,118,111,105,100, 39, 32,116,104,101,110, 10,108,111,
+    99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,
+   101,108,102, 46, 97,114,103,115, 91,105, 93, 32,100,111, 10,
+   105,102, 32,105,115, 98, 97,115,105, 99, 40,115,101,108,102,
+    46, 97,114,103,115, 91,105, 93, 46,116,121,112,101, 41, 32,
+   126, 61, 32, 34,115,116, 97,116,101, 34, 32,116,104,101,110,
+    10,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 58,115,
+   101,116, 97,114,114, 97,121, 40,110, 97,114,103, 41, 10,110,
+    97,114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,101,110,
+   100, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,101,
+   110,100, 10,105,102, 32,115,101,108,102, 46, 97,114,103,115,
+    91, 49, 93, 46,116,121,112,101, 32,126, 61, 32, 39,118,111,
+   105,100, 39, 32,116,104,101,110, 10,108,111, 99, 97,108, 32,
+   105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,102, 46,
+    97,114,103,115, 91,105, 93, 32,100,111, 10,115,101,108,102,
+    46, 97,114,103,115, 91,105, 93, 58,102,114,101,101, 97,114,
+   114, 97,121, 40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,
+   110,100, 10,101,110,100, 10,101,110,100, 10,111,117,116,112,
+   117,116, 40, 39, 32,125, 39, 41, 10,111,117,116,112,117,116,
+    40, 39, 32,114,101,116,117,114,110, 32, 39, 46, 46,110,114,
+   101,116, 46, 46, 39, 59, 39, 41, 10,105,102, 32,102, 97,115,
+   116, 32,116,104,101,110, 10,101,108,115,101,105,102, 32,111,
+   118,101,114,108,111, 97,100, 32, 60, 32, 48, 32,116,104,101,
+   110, 10,111,117,116,112,117,116, 40, 39, 35,105,102,110,100,
+   101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83,
+    69, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,116,
+   111,108,117, 97, 95,108,101,114,114,111,114, 58, 92,110, 39,
+    41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117,
+    97, 95,101,114,114,111,114, 40,116,111,108,117, 97, 95, 83,
+    44, 34, 35,102,101,114,114,111,114, 32,105,110, 32,102,117,
+   110, 99,116,105,111,110, 32, 92, 39, 39, 46, 46,115,101,108,
+   102, 46,108,110, 97,109,101, 46, 46, 39, 92, 39, 46, 34, 44,
+    38,116,111,108,117, 97, 95,101,114,114, 41, 59, 39, 41, 10,
+   111,117,116,112,117,116, 40, 39, 32,114,101,116,117,114,110,
+    32, 48, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,
+   101,110,100,105,102, 92,110, 39, 41, 10,101,108,115,101, 10,
+   111,117,116,112,117,116, 40, 39,116,111,108,117, 97, 95,108,
+   101,114,114,111,114, 58, 92,110, 39, 41, 10,111,117,116,112,
+   117,116, 40, 39, 32,114,101,116,117,114,110, 32, 39, 46, 46,
+   115,116,114,115,117, 98, 40,115,101,108,102, 46, 99,110, 97,
+   109,101, 44, 49, 44, 45, 51, 41, 46, 46,102,111,114,109, 97,
+   116, 40, 34, 37, 48, 50,100, 34, 44,111,118,101,114,108,111,
+    97,100, 41, 46, 46, 39, 40,116,111,108,117, 97, 95, 83, 41,
+    59, 39, 41, 10,101,110,100, 10,111,117,116,112,117,116, 40,
+    39,125, 39, 41, 10,111,117,116,112,117,116, 40, 39, 92,110,
+    39, 41, 10,101,110,100, 10,102,117,110, 99,116,105,111,110,
+    32, 99,108, 97,115,115, 70,117,110, 99,116,105,111,110, 58,
+   114,101,103,105,115,116,101,114, 32, 40, 41, 10,105,102, 32,
+   115,101,108,102, 46,116,114, 97,109,112,111,108,105,110,101,
+    32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,
+   116,111,108,117, 97, 95, 98,105,110,100,105,110,103, 40,116,
+   111,108,117, 97, 95, 83, 44, 38,116,111,108,117, 97, 95,116,
+   114, 97,109,112,111,108,105,110,101,100, 91, 39, 46, 46,115,
+   101,108,102, 46,105,110,100,101,120, 46, 46, 39, 93, 41, 59,
+    39, 41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,
+    39, 32,116,111,108,117, 97, 95,102,117,110, 99,116,105,111,
+   110, 40,116,111,108,117, 97, 95, 83, 44, 34, 39, 46, 46,115,
+   101,108,102, 46,108,110, 97,109,101, 46, 46, 39, 34, 44, 39,
+    46, 46,115,101,108,102, 46, 99,110, 97,109,101, 46, 46, 39,
+    41, 59, 39, 41, 10,101,110,100, 10,101,110,100, 10,102,117,
+   110, 99,116,105,111,110, 32, 99,108, 97,115,115, 70,117,110,
+    99,116,105,111,110, 58,116,114, 97,109,112,111,108,105,110,
+   101, 98,105,110,100,105,110,103, 32, 40, 41, 10,114,101,116,
+   117,114,110, 32, 39,123, 34, 39, 46, 46,115,101,108,102, 46,
+   108,110, 97,109,101, 46, 46, 39, 34, 44,116,111,108,117, 97,
+    95,116,114, 97,109,112,111,108,105,110,101, 95, 39, 46, 46,
+   115,101,108,102, 46,116,114, 97,109,112,111,108,105,110,101,
+    46, 46, 10, 39, 44, 48, 44, 78, 85, 76, 76, 44, 40,116,111,
+   108,117, 97, 95, 67, 70,117,110, 99,116,105,111,110, 41, 39,
+    46, 46,115,101,108,102, 46,110, 97,109,101, 46, 46, 39,125,
+    39, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
+    99,108, 97,115,115, 70,117,110, 99,116,105,111,110, 58,108,
+    97,122,121,114,101,103,105,115,116,101,114, 32, 40, 98,105,
+   110,100,105,110,103,115, 41, 10,105,102, 32,115,101,108,102,
+    46,116,114, 97,109,112,111,108,105,110,101, 32,116,104,101,
+   110, 10, 98,105,110,100,105,110,103,115, 91,115,101,108,102,
+    46,108,110, 97,109,101, 93, 32, 61, 32,115,101,108,102, 58,
+   116,114, 97,109,112,111,108,105,110,101, 98,105,110,100,105,
+   110,103, 40, 41, 10,115,101,108,102, 46,108, 97,122,121, 32,
+    61, 32,116,114,117,101, 10,101,108,115,101, 10, 98,105,110,
+   100,105,110,103,115, 91,115,101,108,102, 46,108,110, 97,109,
+   101, 93, 32, 61, 32, 39,123, 34, 39, 46, 46,115,101,108,102,
+    46,108,110, 97,109,101, 46, 46, 39, 34, 44, 39, 46, 46,115,
+   101,108,102, 46, 99,110, 97,109,101, 46, 46, 39, 44, 48, 44,
+    78, 85, 76, 76,125, 39, 10,101,110,100, 10,114,101,116,117,
+   114,110, 32,116,114,117,101, 10,101,110,100, 10,102,117,110,
     99,116,105,111,110, 32, 99,108, 97,115,115, 70,117,110, 99,
    116,105,111,110, 58,112,114,105,110,116, 32, 40,105,100,101,
    110,116, 44, 99,108,111,115,101, 41, 10,112,114,105,110,116,
@@ -17,8 +17,30 @@
 
 #include "tolua.h"
 
+/* registry keys of the tolua tables, see tolua_open */
+extern char tolua_uboxkey;
+extern char tolua_peerkey;
+extern char tolua_superkey;
+extern char tolua_gckey;
+
+/* bound functions have no upvalues, so push them without a closure
+ * when the Lua core supports light C functions
+ */
+#ifdef LUA_LIGHTCFUNCTIONS
+#define tolua_pushcfunction(L,f) lua_pushlightcfunction(L,f)
+#else
+#define tolua_pushcfunction(L,f) lua_pushcfunction(L,f)
+#endif
+
 TOLUA_API void tolua_moduleevents (lua_State* L);
 TOLUA_API int tolua_ismodulemetatable (lua_State* L);
 TOLUA_API void tolua_classevents (lua_State* L);
 
+/* results of tolua_typecheck */
+#define TOLUA_CHECK_TYPE   1    /* instances are of the type or of a derived type */
+#define TOLUA_CHECK_TABLE  2    /* class table is the type or its const counterpart */
+
+TOLUA_API int tolua_typecheck (lua_State* L, const char* type);
+TOLUA_API void tolua_gettypemetatable (lua_State* L, const char* type);
+
 #endif
@@ -29,6 +29,25 @@ static const char* TOLUANAME (const char* n)
   return toluaname;
 }
 
+/* Registry keys
+ * The tolua tables are kept in the registry under the addresses of these
+ * variables, so that they are found without interning their names.
+ */
+char tolua_uboxkey;
+char tolua_peerkey;
+char tolua_superkey;
+char tolua_gckey;
+
+/* Type check keys
+ * Their addresses are used as keys too: the first marks the metatables created
+ * by tolua, the second maps in the registry the metatable of each type to the
+ * one of its const type, the third maps the address of each type name to the
+ * metatable of the type.
+ */
+static char tolua_typecheckskey;
+static char tolua_constmapkey;
+static char tolua_typemetatablekey;
+
 /* Create metatable
  * Create and register new metatable
  */
@@ -39,6 +58,9 @@ void tolua_newmetatable (lua_State* L, const char* name)
     lua_pushvalue(L,-1);
     lua_pushstring(L,name);
     lua_rawset(L,LUA_REGISTRYINDEX);
+    lua_pushlightuserdata(L,&tolua_typecheckskey);
+    lua_pushboolean(L,1);
+    lua_rawset(L,-3);                  /* mark as tolua metatable */
   }
 
   /* set meta events */
@@ -54,13 +76,106 @@ void tolua_getmetatable (lua_State* L, const char* name)
   luaL_getmetatable(L,TOLUANAME(name));
 }
 
+/* Get metatable of type
+ * Like tolua_getmetatable, but the metatable is cached keyed by the address of 'type',
+ * which therefore must have static storage, as the type names in bound code have.
+ */
+TOLUA_API void tolua_gettypemetatable (lua_State* L, const char* type)
+{
+  lua_pushlightuserdata(L,&tolua_typemetatablekey);
+  lua_rawget(L,LUA_REGISTRYINDEX);     /* stack: cache */
+  lua_pushlightuserdata(L,(void*)type);
+  lua_rawget(L,-2);                    /* stack: cache mt */
+  if (lua_isnil(L,-1))
+  {
+    lua_pop(L,1);
+    tolua_getmetatable(L,type);         /* stack: cache mt */
+    if (!lua_isnil(L,-1))
+    {
+      lua_pushlightuserdata(L,(void*)type);
+      lua_pushvalue(L,-2);
+      lua_rawset(L,-4);
+    }
+  }
+  lua_remove(L,-2);                    /* stack: mt */
+}
+
+/* Compute type check
+ * It relates the class metatable at 'mt' to 'type' by metatable identity.
+ */
+static int maptypecheck (lua_State* L, int mt, const char* type)
+{
+  int r = 0;
+  tolua_getmetatable(L,type);          /* stack: type_mt */
+  if (lua_rawequal(L,mt,-1))
+    r = TOLUA_CHECK_TYPE | TOLUA_CHECK_TABLE;
+  else if (!lua_isnil(L,-1))
+  {
+    /* check if it is a specialized class */
+    lua_pushlightuserdata(L,&tolua_superkey);
+    lua_rawget(L,LUA_REGISTRYINDEX);   /* stack: type_mt super */
+    lua_pushvalue(L,mt);
+    lua_rawget(L,-2);                  /* stack: type_mt super super[mt] */
+    if (lua_istable(L,-1))
+    {
+      lua_pushvalue(L,-3);
+      lua_rawget(L,-2);                /* stack: type_mt super super[mt] super[mt][type_mt] */
+      if (lua_toboolean(L,-1))
+        r |= TOLUA_CHECK_TYPE;
+      lua_pop(L,1);
+    }
+    lua_pop(L,2);
+    /* check if it is the const class */
+    lua_pushlightuserdata(L,&tolua_constmapkey);
+    lua_rawget(L,LUA_REGISTRYINDEX);   /* stack: type_mt constmap */
+    lua_pushvalue(L,mt);
+    lua_rawget(L,-2);                  /* stack: type_mt constmap constmap[mt] */
+    if (lua_rawequal(L,-1,-3))
+      r |= TOLUA_CHECK_TABLE;
+    lua_pop(L,2);
+  }
+  lua_pop(L,1);
+  return r;
+}
+
+/* Type check
+ * It relates the metatable on the top of the stack to 'type', returning TOLUA_CHECK_* flags.
+ * Results are cached in the metatable keyed by the address of 'type', which therefore
+ * must have static storage, as the type names in bound code have. Metatables not
+ * created by tolua match no type.
+ */
+TOLUA_API int tolua_typecheck (lua_State* L, const char* type)
+{
+  int r;
+  int mt = lua_gettop(L);
+  lua_pushlightuserdata(L,(void*)type);
+  lua_rawget(L,mt);                    /* stack: mt mt[type] */
+  r = (int)lua_tonumber(L,-1);
+  if (r == 0 && !lua_isnumber(L,-1))
+  {
+    lua_pushlightuserdata(L,&tolua_typecheckskey);
+    lua_rawget(L,mt);                  /* stack: mt nil mark */
+    if (lua_toboolean(L,-1))
+    {
+      r = maptypecheck(L,mt,type);
+      lua_pushlightuserdata(L,(void*)type);
+      lua_pushnumber(L,r);
+      lua_rawset(L,mt);
+    }
+    lua_pop(L,1);
+  }
+  lua_pop(L,1);
+  return r;
+}
+
 /* Map super classes
- * It sets 'name' as being also a 'base', mapping all super classes of 'base' in 'name'
+ * It sets 'name' as being also a 'base', mapping all super classes of 'base' in 'name'.
+ * Super classes are keyed both by name and by metatable.
  */
 static void mapsuper (lua_State* L, const char* name, const char* base)
 {
   /* push registry.super */
-  lua_pushstring(L,"tolua_super");
+  lua_pushlightuserdata(L,&tolua_superkey);
   lua_rawget(L,LUA_REGISTRYINDEX);    /* stack: super */
   tolua_getmetatable(L,name);          /* stack: super mt */
   lua_rawget(L,-2);                   /* stack: super table */
@@ -78,6 +193,32 @@ static void mapsuper (lua_State* L, const char* name, const char* base)
   lua_pushstring(L,base);
   lua_pushboolean(L,1);
   lua_rawset(L,-3);                    /* stack: super table */
+  tolua_getmetatable(L,base);          /* stack: super table base_mt */
+  if (lua_isnil(L,-1))
+    lua_pop(L,1);
+  else
+  {
+    lua_pushboolean(L,1);
+    lua_rawset(L,-3);                  /* stack: super table */
+  }
+
+  /* drop type checks cached in name */
+  tolua_getmetatable(L,name);          /* stack: super table mt */
+  if (lua_istable(L,-1))
+  {
+    lua_pushnil(L);
+    while (lua_next(L,-2) != 0)
+    {
+      lua_pop(L,1);                    /* stack: super table mt key */
+      if (lua_islightuserdata(L,-1) && lua_touserdata(L,-1) != &tolua_typecheckskey)
+      {
+        lua_pushvalue(L,-1);
+        lua_pushnil(L);
+        lua_rawset(L,-4);
+      }
+    }
+  }
+  lua_pop(L,1);                        /* stack: super table */
 
   /* set all super class of base as super class of name */
   tolua_getmetatable(L,base);          /* stack: super table base_mt */
@@ -151,7 +292,7 @@ static int tolua_bnd_releaseownership (lua_State* L)
   if (lua_isuserdata(L,1))
   {
     void* u = *((void**)lua_touserdata(L,1));
-    lua_pushstring(L,"tolua_gc");
+    lua_pushlightuserdata(L,&tolua_gckey);
     lua_rawget(L,LUA_REGISTRYINDEX);
     lua_pushlightuserdata(L,u);
     lua_rawget(L,-2);
@@ -173,11 +314,15 @@ static int tolua_bnd_cast (lua_State* L)
   if (!v)
     lua_pushnil(L);
   else if (v && s) {
-    tolua_getmetatable(L,s);             /* stack: ubox[u] super super[mt] flag mt */
+    tolua_getmetatable(L,s);             /* stack: mt */
     if (lua_isnil(L,-1)) {
       tolua_error(L,"Unknown 'type' for 'tolua.cast' function",NULL);
     }
-    tolua_pushusertype(L,v,s);
+    else {
+      /* use the registered name, whose address is stable as tolua_pushusertype requires */
+      lua_rawget(L,LUA_REGISTRYINDEX);   /* stack: name */
+      tolua_pushusertype(L,v,lua_tostring(L,-1));
+    }
   }
   else {
     tolua_error(L,"Invalid arguments for 'tolua.cast' function",NULL);
@@ -206,7 +351,7 @@ TOLUA_API void tolua_open (lua_State* L)
   if (!lua_isboolean(L,-1))
   {
     lua_pushstring(L,"tolua_opened"); lua_pushboolean(L,1); lua_rawset(L,LUA_REGISTRYINDEX);
-    lua_pushstring(L,"tolua_ubox"); 
+    lua_pushlightuserdata(L,&tolua_uboxkey);
     lua_newtable(L); 
     lua_pushvalue(L, -1); /* metatable: for weak table */
     lua_pushstring(L, "__mode");
@@ -214,7 +359,7 @@ TOLUA_API void tolua_open (lua_State* L)
     lua_rawset(L, -3);
     lua_setmetatable(L, -2);
     lua_rawset(L,LUA_REGISTRYINDEX);
-    lua_pushstring(L,"tolua_peer"); 
+    lua_pushlightuserdata(L,&tolua_peerkey);
     lua_newtable(L); 
     lua_pushvalue(L, -1); /* metatable: for weak table */
     lua_pushstring(L, "__mode");
@@ -222,8 +367,10 @@ TOLUA_API void tolua_open (lua_State* L)
     lua_rawset(L, -3);
     lua_setmetatable(L, -2);
     lua_rawset(L,LUA_REGISTRYINDEX);
-    lua_pushstring(L,"tolua_super"); lua_newtable(L); lua_rawset(L,LUA_REGISTRYINDEX);
-    lua_pushstring(L,"tolua_gc"); lua_newtable(L); lua_rawset(L,LUA_REGISTRYINDEX);
+    lua_pushlightuserdata(L,&tolua_superkey); lua_newtable(L); lua_rawset(L,LUA_REGISTRYINDEX);
+    lua_pushlightuserdata(L,&tolua_gckey); lua_newtable(L); lua_rawset(L,LUA_REGISTRYINDEX);
+    lua_pushlightuserdata(L,&tolua_constmapkey); lua_newtable(L); lua_rawset(L,LUA_REGISTRYINDEX);
+    lua_pushlightuserdata(L,&tolua_typemetatablekey); lua_newtable(L); lua_rawset(L,LUA_REGISTRYINDEX);
 
     tolua_newmetatable(L,"tolua_commonclass");
 
@@ -260,7 +407,7 @@ TOLUA_API void* tolua_copy (lua_State* L, void* value, unsigned int size)
 TOLUA_API void tolua_release (lua_State* L, void* value)
 {
   void** p;
-  lua_pushstring(L,"tolua_ubox");
+  lua_pushlightuserdata(L,&tolua_uboxkey);
   lua_rawget(L,LUA_REGISTRYINDEX); /* stack: ubox */
   lua_pushlightuserdata(L,value);  /* stack: ubox u */
   /* set userdata pointer to NULL: this pointer might be reused by C/C++ */
@@ -280,10 +427,10 @@ TOLUA_API void tolua_release (lua_State* L, void* value)
  */
 TOLUA_API void* tolua_clone (lua_State* L, void* value, lua_CFunction func)
 {
-  lua_pushstring(L,"tolua_gc");
+  lua_pushlightuserdata(L,&tolua_gckey);
   lua_rawget(L,LUA_REGISTRYINDEX);
   lua_pushlightuserdata(L,value);
-  lua_pushcfunction(L,func);
+  tolua_pushcfunction(L,func);
   lua_rawset(L,-3);
   lua_pop(L,1);
   return value;
@@ -302,6 +449,13 @@ TOLUA_API void tolua_usertype (lua_State* L, const char* type)
   tolua_newmetatable(L,type);
 
   mapsuper(L,type,ctype);             /* 'type' is also a 'const type' */
+
+  lua_pushlightuserdata(L,&tolua_constmapkey);
+  lua_rawget(L,LUA_REGISTRYINDEX);     /* stack: constmap */
+  tolua_getmetatable(L,type);
+  tolua_getmetatable(L,ctype);
+  lua_rawset(L,-3);                    /* constmap[mt] = cmt */
+  lua_pop(L,1);
 }
 
 
@@ -415,7 +569,7 @@ TOLUA_API void tolua_cclass (lua_State* L, const char* lname, const char* name,
   lua_pushstring(L,lname);
   tolua_getmetatable(L,name);
   lua_pushstring(L,".collector");
-  lua_pushcfunction(L,col);
+  tolua_pushcfunction(L,col);
   lua_rawset(L,-3);              /* store collector function into metatable */
   lua_rawset(L,-3);              /* assign class metatable to module */
 }
@@ -426,7 +580,7 @@ TOLUA_API void tolua_cclass (lua_State* L, const char* lname, const char* name,
 TOLUA_API void tolua_function (lua_State* L, const char* name, lua_CFunction func)
 {
   lua_pushstring(L,name);
-  lua_pushcfunction(L,func);
+  tolua_pushcfunction(L,func);
   lua_rawset(L,-3);
 }
 
@@ -468,7 +622,7 @@ TOLUA_API void tolua_variable (lua_State* L, const char* name, lua_CFunction get
     lua_rawset(L,-4);
   }
   lua_pushstring(L,name);
-  lua_pushcfunction(L,get);
+  tolua_pushcfunction(L,get);
   lua_rawset(L,-3);                  /* store variable */
   lua_pop(L,1);                      /* pop .get table */
 
@@ -487,7 +641,7 @@ TOLUA_API void tolua_variable (lua_State* L, const char* name, lua_CFunction get
       lua_rawset(L,-4);
     }
     lua_pushstring(L,name);
-    lua_pushcfunction(L,set);
+    tolua_pushcfunction(L,set);
     lua_rawset(L,-3);                  /* store variable */
     lua_pop(L,1);                      /* pop .set table */
   }
@@ -524,13 +678,141 @@ TOLUA_API void tolua_array (lua_State* L, const char* name, lua_CFunction get, l
   lua_pushvalue(L,-1);
   lua_setmetatable(L,-2);    /* set the own table as metatable (for modules) */
   lua_pushstring(L,"__index");
-  lua_pushcfunction(L,get);
+  tolua_pushcfunction(L,get);
   lua_rawset(L,-3);
   lua_pushstring(L,"__newindex");
-  lua_pushcfunction(L,set?set:const_array);
+  tolua_pushcfunction(L,set?set:const_array);
   lua_rawset(L,-3);
 
   lua_rawset(L,-3);                  /* store variable */
   lua_pop(L,1);                      /* pop .get table */
 }
 
+/* Push the value of a lazy binding
+*/
+static void tolua_pushlazybinding (lua_State* L, const tolua_LazyBinding* binding)
+{
+  if (binding->target)
+  {
+    /* the trampoline finds the function to call in its binding */
+    lua_pushlightuserdata(L,(void*)binding);
+    lua_pushcclosure(L,binding->func,1);
+  }
+  else if (binding->func)
+    tolua_pushcfunction(L,binding->func);
+  else if (binding->string)
+    tolua_pushstring(L,binding->string);
+  else
+    tolua_pushnumber(L,binding->number);
+}
+
+/* Map binding
+ * It assigns the function or constant of a binding into the current
+ * module at once. The binding must outlive the Lua state.
+ */
+TOLUA_API void tolua_binding (lua_State* L, const tolua_LazyBinding* binding)
+{
+  lua_pushstring(L,binding->name);
+  tolua_pushlazybinding(L,binding);
+  lua_rawset(L,-3);
+}
+
+/* Index a module with lazy bindings
+ * Upvalues are the bindings, their number and the previous __index
+ * of the module. A binding is stored in the module when it is first
+ * accessed, so later accesses do not get here.
+ */
+static int tolua_lazyindex (lua_State* L)
+{
+  if (lua_type(L,2) == LUA_TSTRING)
+  {
+    const tolua_LazyBinding* bindings =
+      (const tolua_LazyBinding*) lua_touserdata(L,lua_upvalueindex(1));
+    const char* name = lua_tostring(L,2);
+    int low = 0;
+    int high = (int) lua_tonumber(L,lua_upvalueindex(2)) - 1;
+    while (low <= high)
+    {
+      int middle = (low+high)/2;
+      int c = strcmp(name,bindings[middle].name);
+      if (c == 0)
+      {
+        tolua_pushlazybinding(L,&bindings[middle]);
+        lua_pushvalue(L,2);
+        lua_pushvalue(L,-2);
+        lua_rawset(L,1);
+        return 1;
+      }
+      else if (c < 0)
+        high = middle-1;
+      else
+        low = middle+1;
+    }
+  }
+
+  /* not a binding, use the previous __index */
+  if (lua_isfunction(L,lua_upvalueindex(3)))
+  {
+    lua_pushvalue(L,lua_upvalueindex(3));
+    lua_pushvalue(L,1);
+    lua_pushvalue(L,2);
+    lua_call(L,2,1);
+    return 1;
+  }
+  else if (lua_istable(L,lua_upvalueindex(3)))
+  {
+    lua_pushvalue(L,2);
+    lua_gettable(L,lua_upvalueindex(3));
+    return 1;
+  }
+  return 0;
+}
+
+/* Map lazy bindings
+ * It binds functions and constants of the current module on first
+ * access, through an __index metamethod. The bindings must be sorted
+ * by name (as by strcmp) and must outlive the Lua state. Unless lazy
+ * bindings are turned off with tolua_setlazybindings, in which case
+ * all of them are assigned into the module at once.
+ */
+TOLUA_API void tolua_lazymodule (lua_State* L, const tolua_LazyBinding* bindings, int count)
+{
+  int i;
+  lua_pushstring(L,"tolua_eagerbindings");
+  lua_rawget(L,LUA_REGISTRYINDEX);
+  if (lua_toboolean(L,-1))
+  {
+    lua_pop(L,1);
+    for (i=0; i<count; ++i)
+      tolua_binding(L,&bindings[i]);
+    return;
+  }
+  lua_pop(L,1);
+
+  if (!lua_getmetatable(L,-1))
+  {
+    lua_newtable(L);
+    lua_pushvalue(L,-1);
+    lua_setmetatable(L,-3);
+  }
+  lua_pushstring(L,"__index");
+  lua_pushlightuserdata(L,(void*)bindings);
+  lua_pushnumber(L,count);
+  lua_pushstring(L,"__index");
+  lua_rawget(L,-5);          /* previous __index */
+  lua_pushcclosure(L,tolua_lazyindex,3);
+  lua_rawset(L,-3);
+  lua_pop(L,1);              /* pop metatable */
+}
+
+/* Turn lazy bindings on or off
+ * It applies to modules mapped after the call. Lazy bindings are on
+ * by default.
+ */
+TOLUA_API void tolua_setlazybindings (lua_State* L, int lazy)
+{
+  lua_pushstring(L,"tolua_eagerbindings");
+  lua_pushboolean(L,!lazy);
+  lua_rawset(L,LUA_REGISTRYINDEX);
+}
+
@@ -13,6 +13,7 @@
  */
 
 #include "tolua.h"
+#include "tolua_event.h"
 #include "lauxlib.h"
 
 #include <stdlib.h>
@@ -54,7 +55,7 @@ TOLUA_API void tolua_pushusertype (lua_State* L, void* value, const char* type)
     lua_pushnil(L);
   else
   {
-    lua_pushstring(L,"tolua_ubox");
+    lua_pushlightuserdata(L,&tolua_uboxkey);
     lua_rawget(L,LUA_REGISTRYINDEX);        /* stack: ubox */
     lua_pushlightuserdata(L,value);
     lua_rawget(L,-2);                       /* stack: ubox ubox[u] */
@@ -68,33 +69,24 @@ TOLUA_API void tolua_pushusertype (lua_State* L, void* value, const char* type)
       lua_insert(L,-4);                      /* stack: newud ubox u newud */
       lua_rawset(L,-3);                      /* stack: newud ubox */
       lua_pop(L,1);                          /* stack: newud */
-      tolua_getmetatable(L,type);             /* stack: newud mt */
+      tolua_gettypemetatable(L,type);         /* stack: newud mt */
       lua_setmetatable(L,-2);                /* stack: newud */
     }
     else
     {
       /* reusing ubox of value */
+      lua_remove(L,-2);                       /* stack: ubox[u] */
       /* check the need of updating the metatable to a more specialized class */
-      lua_insert(L,-2);                       /* stack: ubox[u] ubox */
-      lua_pop(L,1);                           /* stack: ubox[u] */
-      lua_pushstring(L,"tolua_super");
-      lua_rawget(L,LUA_REGISTRYINDEX);        /* stack: ubox[u] super */
-      lua_getmetatable(L,-2);                 /* stack: ubox[u] super mt */
-      lua_rawget(L,-2);                       /* stack: ubox[u] super super[mt] */
-      if (lua_istable(L,-1))
+      if (lua_getmetatable(L,-1))             /* stack: ubox[u] mt */
       {
-        lua_pushstring(L,type);                 /* stack: ubox[u] super super[mt] type */
-        lua_rawget(L,-2);                       /* stack: ubox[u] super super[mt] flag */
-        if (lua_toboolean(L,-1) == 1)           /* if true */
-        {
-          lua_pop(L,3);                         /* stack: ubox[u] */
+        int r = tolua_typecheck(L,type) & TOLUA_CHECK_TYPE;
+        lua_pop(L,1);                         /* stack: ubox[u] */
+        if (r)
           return;
-        }
       }
       /* type represents a more specilized type */
-      tolua_getmetatable(L,type);             /* stack: ubox[u] super super[mt] flag mt */
-      lua_setmetatable(L,-5);                /* stack: ubox[u] super super[mt] flag */
-      lua_pop(L,3);                          /* stack: ubox[u] */
+      tolua_gettypemetatable(L,type);         /* stack: ubox[u] mt */
+      lua_setmetatable(L,-2);                /* stack: ubox[u] */
     }
   }
 }
@@ -14,7 +14,7 @@ Tst_B* Tst_B::last;
 Tst_C* Tst_C::last;
 
 
-int main ()
+int main (int argc, char* argv[])
 {
   Tst_B* b = new Tst_B;         // instance used in Lua code
   int  tolua_tclass_open (lua_State*);
@@ -23,7 +23,7 @@ int main ()
   luaL_openlibs(L);
   tolua_tclass_open(L);
 
-  if (luaL_dofile(L,"tclass.lua")) {
+  if (luaL_dofile(L,argc>1 ? argv[1] : "tclass.lua")) {
     printf("Error: %s\n",lua_tostring(L,-1));
   }
 
@@ -0,0 +1,83 @@
+-- class benchmark: ./tclass tclassbench.lua
+-- Each bound method checks the type of its self argument with tolua_isusertype;
+-- the last part pushes and indexes many objects through the ubox and peer tables.
+
+local N = 1000000
+
+local function bench (label, obj, method)
+  local f = obj[method]
+  local t = os.clock()
+  for i=1,N do
+    f(obj)
+  end
+  t = os.clock() - t
+  print(string.format("%-32s %8.1f ns/call", label, t*1e9/N))
+end
+
+local a = A:new()
+local c = luaC:new(0)
+local bb = A.BB:new()
+
+bench("A:a() same class", a, "a")
+bench("luaC:a() base class", c, "a")
+bench("luaC:b() base class", c, "b")
+bench("BB:aa() base class", bb, "aa")
+bench("BB:classname() const class", bb, "classname")
+
+local t = os.clock()
+for i=1,N do
+  A.BB.classname(bb)
+end
+t = os.clock() - t
+print(string.format("%-32s %8.1f ns/call", "A.BB.classname(bb) via table", t*1e9/N))
+
+-- push and index over many objects
+local M = 10000
+local R = N/M
+local objs = {}
+
+local function report (label, t)
+  print(string.format("%-32s %8.1f ns/op", label, t*1e9/N))
+end
+
+t = os.clock()
+for r=1,R do
+  for i=1,M do
+    objs[i] = A.BB:new()
+  end
+end
+report("push new object", os.clock() - t)
+
+t = os.clock()
+for r=1,R do
+  for i=1,M do
+    local o = objs[i]:Base()
+  end
+end
+report("push mapped object", os.clock() - t)
+
+t = os.clock()
+for r=1,R do
+  for i=1,M do
+    local f = objs[i].aa
+  end
+end
+report("index inherited method", os.clock() - t)
+
+t = os.clock()
+for r=1,R do
+  for i=1,M do
+    objs[i].x = i
+  end
+end
+report("store field at peer", os.clock() - t)
+
+t = os.clock()
+for r=1,R do
+  for i=1,M do
+    local x = objs[i].x
+  end
+end
+report("index field at peer", os.clock() - t)
+
+print("Class benchmark OK")
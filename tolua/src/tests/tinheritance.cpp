@@ -4,7 +4,7 @@ extern "C" {
 #include "lauxlib.h"
 }
 
-int main ()
+int main (int argc, char* argv[])
 {
 	int  tolua_tinheritance_open (lua_State*);
 
@@ -12,7 +12,7 @@ int main ()
 	luaL_openlibs(L);
 	tolua_tinheritance_open(L);
 
-	luaL_dofile(L,"tinheritance.lua");
+	luaL_dofile(L,argc>1 ? argv[1] : "tinheritance.lua");
 
 	lua_close(L);
 
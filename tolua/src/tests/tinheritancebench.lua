@@ -0,0 +1,22 @@
+-- type check benchmark: ./tinheritance tinheritancebench.lua
+-- Methods of A called on objects 0 to 3 levels down the hierarchy A <- B <- C <- D.
+
+local N = 1000000
+
+local function bench (label, obj, method)
+  local f = obj[method]
+  local t = os.clock()
+  for i=1,N do
+    f(obj)
+  end
+  t = os.clock() - t
+  print(string.format("%-32s %8.1f ns/call", label, t*1e9/N))
+end
+
+bench("A:aname() depth 0", A:new(), "aname")
+bench("B:aname() depth 1", B:new(), "aname")
+bench("C:aname() depth 2", C:new(), "aname")
+bench("D:aname() depth 3", D:new(), "aname")
+bench("D:name() same class", D:new(), "name")
+
+print("Inheritance benchmark OK")